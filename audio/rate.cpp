@@ -139,6 +139,8 @@ public:
 	void setInputRate(st_rate_t inputRate) override { _inRate = inputRate; _pendingRepeats = 0; }
 	void setOutputRate(st_rate_t outputRate) override { _outRate = outputRate; _pendingRepeats = 0; }
 
+	void reset() override;
+
 	st_rate_t getInputRate() const override { return _inRate; }
 	st_rate_t getOutputRate() const override { return _outRate; }
 
@@ -500,6 +502,17 @@ RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_ra
 	_bufferPos(nullptr),
 	_pendingRepeats(0) {}
 
+template<bool inStereo, bool outStereo, bool reverseStereo>
+void RateConverter_Impl<inStereo, outStereo, reverseStereo>::reset() {
+	_outPos = 1;
+	_outPosFrac = FRAC_ONE_LOW;
+	_inLastL = _inLastR = 0;
+	_inCurL = _inCurR = 0;
+	_bufferSize = 0;
+	_bufferPos = nullptr;
+	_pendingRepeats = 0;
+}
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
 template<typename st_sample_t, MixMode mixMode>
 int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convertForType(AudioStream &input, byte *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
@@ -116,6 +116,12 @@ public:
 	virtual st_rate_t getInputRate() const = 0;
 	virtual st_rate_t getOutputRate() const = 0;
 
+	/**
+	 * Discard any buffered input and interpolation state, so that the
+	 * converter can be used for a new stream as if it had just been created.
+	 */
+	virtual void reset() = 0;
+
 	/**
 	 * Does the internal buffer still have some leftover data?
 	 *
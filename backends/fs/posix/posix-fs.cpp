@@ -120,6 +120,24 @@ POSIXFilesystemNode::POSIXFilesystemNode(const Common::String &p) {
 	setFlags();
 }
 
+// fstatat() is part of POSIX.1-2008, only use it where it is known to be there
+#if defined(AT_FDCWD) && !defined(__ANDROID__) && (defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__))
+#define POSIX_FS_HAS_FSTATAT
+#endif
+
+/**
+ * Get the status of an entry of an open directory. When possible, the name
+ * is resolved relative to the directory instead of walking its whole path
+ * again, which matters for big directories with many symbolic links.
+ */
+static bool statDirectoryEntry(DIR *dirp, const char *name, const Common::String &path, struct stat *st) {
+#ifdef POSIX_FS_HAS_FSTATAT
+	return fstatat(dirfd(dirp), name, st, 0) == 0;
+#else
+	return stat(path.c_str(), st) == 0;
+#endif
+}
+
 AbstractFSNode *POSIXFilesystemNode::getChild(const Common::String &n) const {
 	assert(!_path.empty());
 	assert(_isDirectory);
@@ -185,13 +203,23 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 			continue;
 		}
 
+#if !defined(SYSTEM_NOT_SUPPORTING_D_TYPE)
+		// Regular files and directories can be filtered out before building
+		// their paths, which matters for big directories
+		if ((mode == Common::FSNode::kListFilesOnly && dp->d_type == DT_DIR) ||
+			(mode == Common::FSNode::kListDirectoriesOnly && dp->d_type == DT_REG))
+			continue;
+#endif
+
 		// Start with a clone of this node, with the correct path set
-		POSIXFilesystemNode entry(*this);
+		POSIXFilesystemNode *entryPtr = new POSIXFilesystemNode(*this);
+		POSIXFilesystemNode &entry = *entryPtr;
 		entry._displayName = dp->d_name;
 		if (_path.lastChar() != '/')
 			entry._path += '/';
 		entry._path += entry._displayName;
 
+		struct stat st;
 #if defined(SYSTEM_NOT_SUPPORTING_D_TYPE)
 		/* TODO: d_type is not part of POSIX, so it might not be supported
 		 * on some of our targets. For those systems where it isn't supported,
@@ -200,7 +228,8 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 		 * The d_type method is used to avoid costly recurrent stat() calls in big
 		 * directories.
 		 */
-		entry.setFlags();
+		entry._isValid = statDirectoryEntry(dirp, dp->d_name, entry._path, &st);
+		entry._isDirectory = entry._isValid ? S_ISDIR(st.st_mode) : false;
 #else
 		switch (dp->d_type) {
 		case DT_DIR:
@@ -210,8 +239,7 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 			break;
 		case DT_LNK:
 			entry._isValid = true;
-			struct stat st;
-			if (stat(entry._path.c_str(), &st) == 0)
+			if (statDirectoryEntry(dirp, dp->d_name, entry._path, &st))
 				entry._isDirectory = S_ISDIR(st.st_mode);
 			else
 				entry._isDirectory = false;
@@ -224,22 +252,27 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 			// be unreliable on some OSes and filesystems; a confirmed example is
 			// macOS 10.4, where d_type can hold bogus values when iterating over
 			// the files of a cddafs mount point (as used by MacOSXAudioCDManager).
-			entry.setFlags();
+			entry._isValid = statDirectoryEntry(dirp, dp->d_name, entry._path, &st);
+			entry._isDirectory = entry._isValid ? S_ISDIR(st.st_mode) : false;
 			break;
 		}
 #endif
 
 		// Skip files that are invalid for some reason (e.g. because we couldn't
 		// properly stat them).
-		if (!entry._isValid)
+		if (!entry._isValid) {
+			delete entryPtr;
 			continue;
+		}
 
 		// Honor the chosen mode
 		if ((mode == Common::FSNode::kListFilesOnly && entry._isDirectory) ||
-			(mode == Common::FSNode::kListDirectoriesOnly && !entry._isDirectory))
+			(mode == Common::FSNode::kListDirectoriesOnly && !entry._isDirectory)) {
+			delete entryPtr;
 			continue;
+		}
 
-		myList.push_back(new POSIXFilesystemNode(entry));
+		myList.push_back(entryPtr);
 	}
 	closedir(dirp);
 
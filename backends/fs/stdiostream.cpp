@@ -53,6 +53,8 @@ StdioStream::StdioStream(void *handle) : _handle(handle), _path(nullptr) {
 }
 
 StdioStream::~StdioStream() {
+	// Do not replace the previous file with an incomplete one
+	const bool failed = _path && (fflush((FILE *)_handle) != 0 || ferror((FILE *)_handle) != 0);
 	fclose((FILE *)_handle);
 
 	if (!_path) {
@@ -64,7 +66,10 @@ StdioStream::~StdioStream() {
 	Common::String tmpPath(*_path);
 	tmpPath += ".tmp";
 
-	if (!moveFile(tmpPath, *_path)) {
+	if (failed) {
+		(void)remove(tmpPath.c_str());
+		warning("Couldn't save file %s", _path->c_str());
+	} else if (!moveFile(tmpPath, *_path)) {
 		warning("Couldn't save file %s", _path->c_str());
 	}
 
@@ -52,9 +52,9 @@ typedef void (*sighandler_t)(int);
 #include "backends/modular-backend.h"
 #include "backends/mutex/null/null-mutex.h"
 #include "base/main.h"
+#include "backends/saves/default/default-saves.h"
 
 #ifndef NULL_DRIVER_USE_FOR_TEST
-#include "backends/saves/default/default-saves.h"
 #include "backends/timer/default/default-timer.h"
 #include "backends/events/default/default-events.h"
 #include "backends/mixer/null/null-mixer.h"
@@ -144,6 +144,9 @@ void OSystem_NULL::initBackend() {
 	_startTime = GetTickCount();
 #endif
 
+	// Tests use the save manager, directly or through the cloud code
+	_savefileManager = new DefaultSaveFileManager();
+
 #ifndef NULL_DRIVER_USE_FOR_TEST
 #ifdef POSIX
 	last_handler = signal(SIGINT, intHandler);
@@ -151,7 +154,6 @@ void OSystem_NULL::initBackend() {
 
 	_timerManager = new DefaultTimerManager();
 	_eventManager = new DefaultEventManager(this);
-	_savefileManager = new DefaultSaveFileManager();
 	_graphicsManager = new NullGraphicsManager();
 	_mixerManager = new NullMixerManager();
 	// Setup and start mixer
@@ -37,6 +37,10 @@
 #include "common/archive.h"
 #include "common/config-manager.h"
 #include "common/compression/deflate.h"
+#include "common/compression/delta.h"
+#include "common/crc.h"
+#include "common/memstream.h"
+#include "common/substream.h"
 
 #include <errno.h>	// for removeSavefile()
 
@@ -44,13 +48,77 @@
 const char *const DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+/**
+ * Save file collecting the data in memory, which is then handed over
+ * to the DefaultSaveFileManager to be written in the background.
+ */
+class AsyncOutSaveFile : public Common::OutSaveFile {
+public:
+	AsyncOutSaveFile(DefaultSaveFileManager *manager, const DefaultSaveFileManager::AsyncSave &save) :
+		Common::OutSaveFile(new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO)),
+		_manager(manager), _save(save), _err(false) {
+	}
+
+	~AsyncOutSaveFile() override {
+		finalize();
+	}
+
+	void finalize() override {
+		if (!_wrapped)
+			return;
+
+		// Hand the data over along with its ownership. Writing
+		// past this point fails, as documented for finalize().
+		Common::MemoryWriteStreamDynamic *buffer = (Common::MemoryWriteStreamDynamic *)_wrapped;
+
+		_save.data = buffer->getData();
+		_save.size = _save.stateSize = buffer->size();
+		delete _wrapped;
+		_wrapped = nullptr;
+		_manager->queueAsyncSave(_save);
+	}
+
+	bool err() const override { return _wrapped ? OutSaveFile::err() : _err; }
+	void clearErr() override {
+		if (_wrapped)
+			OutSaveFile::clearErr();
+		_err = false;
+	}
+
+	bool flush() override { return _wrapped ? OutSaveFile::flush() : !_err; }
+
+	uint32 write(const void *dataPtr, uint32 dataSize) override {
+		if (_wrapped)
+			return OutSaveFile::write(dataPtr, dataSize);
+
+		_err = true;
+		return 0;
+	}
+
+	int64 pos() const override { return _wrapped ? OutSaveFile::pos() : _save.stateSize; }
+	int64 size() const override { return _wrapped ? OutSaveFile::size() : _save.stateSize; }
+	bool seek(int64 offset, int whence) override { return _wrapped && OutSaveFile::seek(offset, whence); }
+
+private:
+	DefaultSaveFileManager *_manager;
+	DefaultSaveFileManager::AsyncSave _save;
+	bool _err;
+};
+
+DefaultSaveFileManager::DefaultSaveFileManager() : _revision(1), _scanRevision(1), _deltaSaving(false), _asyncSaving(false) {
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::Path &defaultSavepath) {
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::Path &defaultSavepath) : _revision(1), _scanRevision(1), _deltaSaving(false), _asyncSaving(false) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+DefaultSaveFileManager::~DefaultSaveFileManager() {
+	waitForAsyncSaves();
+
+	for (auto &base : _deltaBases)
+		freeDeltaBase(base._value);
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -66,6 +134,7 @@ void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 void DefaultSaveFileManager::updateSavefilesList(Common::StringArray &lockedFiles) {
 	//make it refresh the cache next time it lists the saves
 	_cachedDirectory = "";
+	_scanRevision = ++_revision;
 
 	//remember the locked files list because some of these files don't exist yet
 	_lockedFiles = lockedFiles;
@@ -92,6 +161,8 @@ Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &filename) {
+	waitForAsyncSave(filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -108,6 +179,8 @@ Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &fi
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String &filename) {
+	waitForAsyncSave(filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -127,11 +200,14 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 	} else {
 		// Open the file for loading.
 		Common::SeekableReadStream *sf = file->_value.createReadStream();
-		return Common::wrapCompressedReadStream(sf);
+		return readSavedState(filename, sf);
 	}
 }
 
 Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String &filename, bool compress) {
+	// Do not let a pending save overwrite the new one
+	waitForAsyncSave(filename);
+
 	// Assure the savefile name cache is up-to-date.
 	const Common::Path savePathName = getSavePath();
 	assureCached(savePathName);
@@ -163,19 +239,50 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 		fileNode = file->_value;
 	}
 
-	// Open the file for saving.
-	Common::SeekableWriteStream *const sf = fileNode.createWriteStream(false);
-	if (!sf)
-		return nullptr;
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	Common::OutSaveFile *result;
+	if (_asyncSaving) {
+		AsyncSave save;
+		save.filename = filename;
+		save.pos = 0;
+		save.stream = nullptr;
+		save.success = false;
+		save.writeTime = 0;
+		save.delta = _deltaSaving && compress;
+		save.rebase = false;
+		save.node = fileNode;
+
+		if (!save.delta) {
+			dropDelta(filename);
+
+			// Open the file for saving. It replaces the previous
+			// one only once it is completely written.
+			Common::SeekableWriteStream *const sf = fileNode.createWriteStream(true);
+			if (!sf)
+				return nullptr;
+			save.stream = compress ? Common::wrapCompressedWriteStream(sf) : sf;
+		}
+
+		result = new AsyncOutSaveFile(this, save);
+	} else {
+		dropDelta(filename);
+
+		// Open the file for saving.
+		Common::SeekableWriteStream *const sf = fileNode.createWriteStream(false);
+		if (!sf)
+			return nullptr;
+		result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	}
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+	touchSavefile(filename);
 
 	return result;
 }
 
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
+	waitForAsyncSave(filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -200,6 +307,9 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 		// Remove from cache, this invalidates the 'file' iterator.
 		_saveFileCache.erase(file);
 		file = _saveFileCache.end();
+		touchSavefile(filename);
+
+		dropDelta(filename);
 
 		Common::ErrorCode result = removeFile(fileNode);
 		if (result == Common::kNoError)
@@ -221,6 +331,21 @@ Common::ErrorCode DefaultSaveFileManager::removeFile(const Common::FSNode &fileN
 	return Common::kUnknownError;
 }
 
+uint32 DefaultSaveFileManager::getSavefileRevision(const Common::String &name) {
+	// Rescanning the save directory counts as a change of every file
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError)
+		return 0;
+
+	return MAX(_fileRevisions.getValOrDefault(name, 0), _scanRevision);
+}
+
+void DefaultSaveFileManager::touchSavefile(const Common::String &name) {
+	// Taking the value from _revision makes it larger than any revision
+	// returned for this file before, even after a rescan
+	_fileRevisions[name] = ++_revision;
+}
+
 bool DefaultSaveFileManager::exists(const Common::String &filename) {
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
@@ -235,6 +360,310 @@ bool DefaultSaveFileManager::exists(const Common::String &filename) {
 	return _saveFileCache.contains(filename);
 }
 
+bool DefaultSaveFileManager::setAsyncSaving(bool enable, Common::AsyncSaveCallback *callback) {
+	_asyncSaving = enable;
+	_asyncCallback.reset(callback);
+	return true;
+}
+
+bool DefaultSaveFileManager::setDeltaSaving(bool enable) {
+	_deltaSaving = enable;
+	return true;
+}
+
+void DefaultSaveFileManager::pollAsyncSaves() {
+	if (_asyncSaves.empty())
+		return;
+
+	AsyncSaveList completed;
+	processAsyncSaves(kAsyncSaveSliceSize, completed);
+	completeAsyncSaves(completed);
+}
+
+void DefaultSaveFileManager::waitForAsyncSaves() {
+	AsyncSaveList completed;
+	while (!_asyncSaves.empty())
+		processAsyncSaves(0xFFFFFFFF, completed);
+
+	completeAsyncSaves(completed);
+}
+
+void DefaultSaveFileManager::waitForAsyncSave(const Common::String &filename) {
+	AsyncSaveList completed;
+
+	// Saves are written in order, so finish everything
+	// up to the last pending save of this file
+	for (;;) {
+		bool pending = false;
+		for (const auto &save : _asyncSaves) {
+			if (save.filename.equalsIgnoreCase(filename)) {
+				pending = true;
+				break;
+			}
+		}
+
+		if (!pending)
+			break;
+
+		processAsyncSaves(0xFFFFFFFF, completed);
+	}
+
+	completeAsyncSaves(completed);
+}
+
+void DefaultSaveFileManager::queueAsyncSave(const AsyncSave &save) {
+	_asyncSaves.push_back(save);
+	_asyncSaves.back().callback = _asyncCallback;
+}
+
+void DefaultSaveFileManager::processAsyncSaves(uint32 maxSize, AsyncSaveList &completed) {
+	while (!_asyncSaves.empty() && maxSize) {
+		AsyncSave &save = _asyncSaves.front();
+		const uint32 start = g_system->getMillis(true);
+
+		if (save.delta && !save.stream)
+			prepareDeltaSave(save);
+
+		if (save.stream) {
+			const uint32 size = MIN(maxSize, save.size - save.pos);
+			save.stream->write(save.data + save.pos, size);
+			save.pos += size;
+			maxSize -= size;
+
+			if (save.pos == save.size)
+				save.stream->finalize();
+		}
+
+		save.writeTime += g_system->getMillis(true) - start;
+
+		if (save.stream && save.pos < save.size)
+			break;
+
+		// Closing the stream moves the file into place
+		save.success = save.stream && !save.stream->err();
+		delete save.stream;
+		save.stream = nullptr;
+
+		if (save.delta)
+			completeDeltaSave(save);
+
+		completed.push_back(save);
+		_asyncSaves.pop_front();
+	}
+}
+
+void DefaultSaveFileManager::completeAsyncSaves(AsyncSaveList &completed) {
+	for (auto &save : completed) {
+		Common::AsyncSaveResult result;
+		result.name = save.filename;
+		result.success = save.success;
+		result.size = save.stateSize;
+		result.writeTime = save.writeTime;
+
+		free(save.data);
+
+		// The file only now holds its new contents
+		touchSavefile(save.filename);
+
+		if (!result.success)
+			warning("DefaultSaveFileManager: Failed to write savefile '%s'", save.filename.c_str());
+
+		if (save.callback)
+			(*save.callback)(result);
+	}
+
+#ifdef USE_CLOUD
+	if (!completed.empty())
+		CloudMan.syncSaves();
+#endif
+
+	completed.clear();
+}
+
+uint32 DefaultSaveFileManager::getTailChecksum(const byte *data, uint32 size) {
+	const uint32 tailSize = MIN<uint32>(size, kSignatureSize);
+	return Common::CRC32().crcFast(data + size - tailSize, tailSize);
+}
+
+bool DefaultSaveFileManager::getFileSignature(const Common::FSNode &fileNode, uint32 &size, uint32 &checksum) {
+	Common::ScopedPtr<Common::SeekableReadStream> stream(fileNode.createReadStream());
+	if (!stream)
+		return false;
+
+	byte tail[kSignatureSize];
+	size = stream->size();
+	const uint32 tailSize = MIN<uint32>(size, kSignatureSize);
+	if (!stream->seek(size - tailSize) || stream->read(tail, tailSize) != tailSize)
+		return false;
+
+	checksum = getTailChecksum(tail, tailSize);
+	return true;
+}
+
+void DefaultSaveFileManager::freeDeltaBase(DeltaBase &base) {
+	free(base.data);
+	free(base.packedData);
+}
+
+void DefaultSaveFileManager::prepareDeltaSave(AsyncSave &save) {
+	DeltaBaseMap::iterator base = _deltaBases.find(save.filename);
+
+	// The file may have been replaced since, e.g. by a cloud download
+	uint32 fileSize, fileChecksum;
+	if (base != _deltaBases.end() && (!getFileSignature(save.node, fileSize, fileChecksum) ||
+			fileSize != base->_value.fileSize || fileChecksum != base->_value.fileChecksum)) {
+		warning("DefaultSaveFileManager: Savefile '%s' changed, writing it in full", save.filename.c_str());
+		dropDelta(save.filename);
+		base = _deltaBases.end();
+	}
+
+	Common::MemoryWriteStreamDynamic delta(DisposeAfterUse::YES);
+	if (base != _deltaBases.end() && base->_value.deltas < kMaxDeltas) {
+		delta.writeUint32BE(base->_value.checksum);
+		delta.writeUint32BE(base->_value.size);
+		delta.writeUint32BE(save.size);
+		Common::createDelta(base->_value.data, base->_value.size, save.data, save.size, delta);
+
+		// Past some point, a new base is cheaper to load
+		if (delta.size() > save.size / 4)
+			delta.seek(0);
+	}
+
+	bool writeDelta = false;
+	if (delta.pos() != 0) {
+		Common::MemoryWriteStreamDynamic *const packed = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES);
+		Common::ScopedPtr<Common::WriteStream> packer(Common::wrapCompressedWriteStream(packed));
+		packer->write(delta.getData(), delta.size());
+		packer->finalize();
+		writeDelta = !packer->err();
+
+		if (writeDelta) {
+			// Store the compressed base as is, followed by the compressed delta
+			const DeltaBase &current = base->_value;
+			free(save.data);
+			save.size = 8 + current.packedSize + packed->size();
+			save.data = (byte *)malloc(save.size);
+			WRITE_BE_UINT32(save.data, MKTAG('S', 'D', 'L', 'T'));
+			WRITE_BE_UINT32(save.data + 4, current.packedSize);
+			memcpy(save.data + 8, current.packedData, current.packedSize);
+			memcpy(save.data + 8 + current.packedSize, packed->getData(), packed->size());
+			base->_value.deltas++;
+		}
+	}
+
+	// Keep the previous file until the new one is completely written
+	Common::SeekableWriteStream *const sf = save.node.createWriteStream(true);
+	if (!sf)
+		return;
+
+	if (writeDelta) {
+		save.stream = sf;
+	} else {
+		// Write the full state, which becomes the new base
+		save.rebase = true;
+		save.stream = Common::wrapCompressedWriteStream(sf);
+	}
+}
+
+void DefaultSaveFileManager::completeDeltaSave(AsyncSave &save) {
+	const bool success = save.success;
+
+	if (!save.rebase) {
+		// The file now holds the delta, the base state is unchanged
+		DeltaBaseMap::iterator base = _deltaBases.find(save.filename);
+		if (!success) {
+			dropDelta(save.filename);
+		} else if (base != _deltaBases.end()) {
+			base->_value.fileSize = save.size;
+			base->_value.fileChecksum = getTailChecksum(save.data, save.size);
+		}
+		return;
+	}
+
+	// The new base state is now on disk, keep it for the next deltas
+	dropDelta(save.filename);
+	if (!success)
+		return;
+
+	// Read back its compressed form, to store it again along with the deltas
+	Common::ScopedPtr<Common::SeekableReadStream> stream(save.node.createReadStream());
+	if (!stream)
+		return;
+
+	DeltaBase base;
+	base.packedSize = stream->size();
+	base.packedData = (byte *)malloc(base.packedSize);
+	if (!base.packedData || stream->read(base.packedData, base.packedSize) != base.packedSize) {
+		free(base.packedData);
+		return;
+	}
+
+	base.data = save.data;
+	base.size = save.size;
+	base.checksum = Common::CRC32().crcFast(save.data, save.size);
+	base.deltas = 0;
+	base.fileSize = base.packedSize;
+	base.fileChecksum = getTailChecksum(base.packedData, base.packedSize);
+	_deltaBases[save.filename] = base;
+	save.data = nullptr;
+}
+
+void DefaultSaveFileManager::dropDelta(const Common::String &filename) {
+	DeltaBaseMap::iterator base = _deltaBases.find(filename);
+	if (base != _deltaBases.end()) {
+		freeDeltaBase(base->_value);
+		_deltaBases.erase(base);
+	}
+}
+
+Common::SeekableReadStream *DefaultSaveFileManager::readSavedState(const Common::String &filename, Common::SeekableReadStream *sf) {
+	Common::ScopedPtr<Common::SeekableReadStream> stream(sf);
+	if (!stream)
+		return nullptr;
+
+	const uint32 fileSize = stream->size();
+	if (fileSize < 8 || stream->readUint32BE() != MKTAG('S', 'D', 'L', 'T')) {
+		stream->seek(0);
+		return Common::wrapCompressedReadStream(stream.release());
+	}
+
+	const uint32 packedSize = stream->readUint32BE();
+	if (packedSize > fileSize - 8) {
+		warning("DefaultSaveFileManager: Savefile '%s' is truncated", filename.c_str());
+		return nullptr;
+	}
+
+	Common::ScopedPtr<Common::SeekableReadStream> baseStream(Common::wrapCompressedReadStream(
+		new Common::SafeSeekableSubReadStream(stream.get(), 8, 8 + packedSize)));
+	Common::ScopedPtr<Common::SeekableReadStream> delta(Common::wrapCompressedReadStream(
+		new Common::SafeSeekableSubReadStream(stream.get(), 8 + packedSize, fileSize)));
+	if (!baseStream || !delta)
+		return nullptr;
+
+	// The base state alone is still a usable, older state
+	const uint32 baseSize = baseStream->size();
+	byte *base = (byte *)malloc(baseSize);
+	if ((baseSize && !base) || baseStream->read(base, baseSize) != baseSize) {
+		warning("DefaultSaveFileManager: Savefile '%s' is truncated", filename.c_str());
+		free(base);
+		return nullptr;
+	}
+
+	const uint32 checksum = delta->readUint32BE();
+	const uint32 deltaBaseSize = delta->readUint32BE();
+	const uint32 size = delta->readUint32BE();
+	byte *data = nullptr;
+	if (delta->eos() || deltaBaseSize != baseSize || Common::CRC32().crcFast(base, baseSize) != checksum ||
+			!(data = (byte *)malloc(size)) || !Common::applyDelta(base, baseSize, *delta, data, size)) {
+		warning("DefaultSaveFileManager: Ignoring delta not matching savefile '%s'", filename.c_str());
+		free(data);
+		return new Common::MemoryReadStream(base, baseSize, DisposeAfterUse::YES);
+	}
+
+	free(base);
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
 Common::Path DefaultSaveFileManager::getSavePath() const {
 
 	Common::Path dir;
@@ -269,6 +698,7 @@ void DefaultSaveFileManager::assureCached(const Common::Path &savePathName) {
 
 	_saveFileCache.clear();
 	_cachedDirectory.clear();
+	_scanRevision = ++_revision;
 
 	if (getError().getCode() != Common::kNoError) {
 		warning("DefaultSaveFileManager::assureCached: Can not cache path '%s': '%s'", savePathName.toString(Common::Path::kNativeSeparator).c_str(), getErrorDesc().c_str());
@@ -27,6 +27,8 @@
 #include "common/str.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
+#include "common/list.h"
+#include "common/ptr.h"
 
 /**
  * Provides a default savefile manager implementation for common platforms.
@@ -35,6 +37,7 @@ class DefaultSaveFileManager : public Common::SaveFileManager {
 public:
 	DefaultSaveFileManager();
 	DefaultSaveFileManager(const Common::Path &defaultSavepath);
+	~DefaultSaveFileManager() override;
 
 	void updateSavefilesList(Common::StringArray &lockedFiles) override;
 	Common::StringArray listSavefiles(const Common::String &pattern) override;
@@ -43,6 +46,12 @@ public:
 	Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true) override;
 	bool removeSavefile(const Common::String &filename) override;
 	bool exists(const Common::String &filename) override;
+	uint32 getSavefilesRevision() override { return _revision; }
+	uint32 getSavefileRevision(const Common::String &name) override;
+	bool setAsyncSaving(bool enable, Common::AsyncSaveCallback *callback = nullptr) override;
+	bool setDeltaSaving(bool enable) override;
+	void pollAsyncSaves() override;
+	void waitForAsyncSaves() override;
 
 #ifdef USE_CLOUD
 
@@ -93,6 +102,21 @@ protected:
 	 */
 	SaveFileCache _saveFileCache;
 
+	/**
+	 * Incremented whenever the save files change, see getSavefilesRevision().
+	 */
+	uint32 _revision;
+
+	/**
+	 * Value of _revision when each save file was last written or removed,
+	 * and when the save directory was last scanned, see getSavefileRevision().
+	 */
+	Common::HashMap<Common::String, uint32> _fileRevisions;
+	uint32 _scanRevision;
+
+	/** Record a change of the given save file. */
+	void touchSavefile(const Common::String &name);
+
 	/**
 	 * List of "locked" files. These cannot be used for saving/loading
 	 * because CloudManager is downloading those.
@@ -104,6 +128,117 @@ private:
 	 * The currently cached directory.
 	 */
 	Common::Path _cachedDirectory;
+
+	friend class AsyncOutSaveFile;
+
+	/**
+	 * A save file whose data is complete, and which is waiting
+	 * to be compressed and written to disk.
+	 */
+	struct AsyncSave {
+		Common::String filename;
+		byte *data;
+		uint32 size;
+		uint32 stateSize;
+		uint32 pos;
+		Common::WriteStream *stream; ///< Deleted, moving the file into place, once written
+		bool success;
+		uint32 writeTime;
+		Common::SharedPtr<Common::AsyncSaveCallback> callback;
+
+		/**
+		 * For saves which may be stored as a delta, the file is only opened
+		 * once it is known whether a full save or a delta is written.
+		 */
+		bool delta;
+		bool rebase;
+		Common::FSNode node;
+	};
+
+	typedef Common::List<AsyncSave> AsyncSaveList;
+
+	/**
+	 * Maximum amount of data compressed and written
+	 * in one go by pollAsyncSaves().
+	 */
+	static const uint32 kAsyncSaveSliceSize = 64 * 1024;
+
+	void queueAsyncSave(const AsyncSave &save);
+
+	/**
+	 * Write the next slice of the given pending saves,
+	 * and move the completed ones to the given list.
+	 */
+	void processAsyncSaves(uint32 maxSize, AsyncSaveList &completed);
+
+	/** Report the completed saves, and trigger the cloud sync. */
+	void completeAsyncSaves(AsyncSaveList &completed);
+
+	/** Wait for the pending saves of the given file, if any. */
+	void waitForAsyncSave(const Common::String &filename);
+
+	/**
+	 * @name Delta saves
+	 *
+	 * Saves written in the background while delta saving is enabled are
+	 * either written in full, and their state becomes the base state, or
+	 * stored as the compressed base state followed by the compressed delta
+	 * to the latest state. The base state is kept in memory along with its
+	 * compressed form, which is written again as is, so only the delta needs
+	 * to be compressed. A new base is written every kMaxDeltas saves, when
+	 * the delta grows too large, or when the file on disk is not the one last
+	 * written.
+	 *
+	 * Each file is self-contained. openForLoading() returns the latest state,
+	 * while openRawFile() returns the file as stored.
+	 * @{
+	 */
+	static const uint kMaxDeltas = 16;
+	static const uint32 kSignatureSize = 64;
+
+	struct DeltaBase {
+		byte *data;
+		uint32 size;
+		uint32 checksum;
+		byte *packedData;    ///< Base state as compressed in its file
+		uint32 packedSize;
+		uint deltas;
+		uint32 fileSize;     ///< Size of the file last written
+		uint32 fileChecksum; ///< Checksum of the end of that file
+	};
+
+	typedef Common::HashMap<Common::String, DeltaBase, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> DeltaBaseMap;
+
+	/** Open the file for a delta save, encoding the delta if possible. */
+	void prepareDeltaSave(AsyncSave &save);
+
+	/** Update the base state of a delta save once it is written. */
+	void completeDeltaSave(AsyncSave &save);
+
+	/** Forget the base state of the given file. */
+	void dropDelta(const Common::String &filename);
+
+	static void freeDeltaBase(DeltaBase &base);
+
+	/** Checksum of the last bytes of a file, see getFileSignature(). */
+	static uint32 getTailChecksum(const byte *data, uint32 size);
+
+	/**
+	 * Read the size and the checksum of the last bytes of a file, to check
+	 * cheaply whether it is still the one last written.
+	 */
+	static bool getFileSignature(const Common::FSNode &fileNode, uint32 &size, uint32 &checksum);
+
+	/** Return the latest state stored in a save file, which may hold a delta. */
+	static Common::SeekableReadStream *readSavedState(const Common::String &filename, Common::SeekableReadStream *stream);
+
+	bool _deltaSaving;
+	DeltaBaseMap _deltaBases;
+	/** @} */
+
+	bool _asyncSaving;
+	Common::SharedPtr<Common::AsyncSaveCallback> _asyncCallback;
+	AsyncSaveList _asyncSaves;
 };
 
 #endif
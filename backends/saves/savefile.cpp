@@ -31,6 +31,11 @@ namespace Common {
 OutSaveFile::OutSaveFile(WriteStream *w): _wrapped(w) {}
 
 OutSaveFile::~OutSaveFile() {
+	// Save files written in the background hand over their stream,
+	// and trigger the sync once they are on disk
+	if (!_wrapped)
+		return;
+
 	delete _wrapped;
 #ifdef USE_CLOUD
 	CloudMan.syncSaves();
@@ -31,6 +31,7 @@
 #include "base/version.h"
 
 #include "common/config-manager.h"
+#include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
 #include "common/md5.h"
@@ -40,6 +41,13 @@
 #include "common/textconsole.h"
 #include "common/tokenizer.h"
 #include "common/zip-set.h"
+#include "common/compression/clickteam.h"
+#include "common/compression/gentee_installer.h"
+#include "common/compression/installshield_cab.h"
+#include "common/compression/installshieldv3_archive.h"
+#include "common/compression/stuffit.h"
+#include "common/compression/unzip.h"
+#include "common/compression/vise.h"
 
 #include "gui/ThemeEngine.h"
 
@@ -267,6 +275,13 @@ static const char HELP_STRING4[] =
 	"  --md5-engine=ENGINE_ID   Used with --md5 to specify the engine for which number of bytes\n"
 	"                           to be hashed must be calculated. This option overrides --md5-length\n"
 	"                           if used along with it. Use --list-engines to find all engineIds\n"
+	"  --unpack-archive         Extract the installer archive given by --unpack-path=PATH into\n"
+	"                           the directory given by --unpack-dir=PATH, showing the MD5 hash\n"
+	"                           of each extracted file and the detection entries it matches or\n"
+	"                           not. --md5-length=NUM sets the number of bytes hashed for the\n"
+	"                           displayed MD5 (default: 5000)\n"
+	"  --unpack-type=TYPE       Type of the archive to extract: clickteam, gentee, installshield,\n"
+	"                           installshieldv3, stuffit, vise or zip\n"
 	"\n"
 	"The meaning of boolean long options can be inverted by prefixing them with\n"
 	"\"no-\", e.g. \"--no-aspect-ratio\".\n"
@@ -359,6 +374,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("dump_scripts", false);
 	ConfMan.registerDefault("save_slot", -1);
 	ConfMan.registerDefault("autosave_period", 5 * 60); // By default, trigger autosave every 5 minutes
+	ConfMan.registerDefault("autosave_deltas", false);
 	ConfMan.registerDefault("engine_speed", 60); // FPS limit for 3D games
 
 #if defined(ENABLE_SCUMM) || defined(ENABLE_SWORD2)
@@ -739,6 +755,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_COMMAND("md5mac")
 			END_COMMAND
 
+			DO_LONG_COMMAND("unpack-archive")
+			END_COMMAND
+
 #ifdef DETECTOR_TESTING_HACK
 			// HACK FIXME TODO: This command is intentionally *not* documented!
 			DO_LONG_COMMAND("test-detector")
@@ -974,6 +993,15 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION("md5-engine")
 			END_OPTION
 
+			DO_LONG_OPTION("unpack-path")
+			END_OPTION
+
+			DO_LONG_OPTION("unpack-dir")
+			END_OPTION
+
+			DO_LONG_OPTION("unpack-type")
+			END_OPTION
+
 			DO_LONG_OPTION_INT("talkspeed")
 			END_OPTION
 
@@ -1822,6 +1850,152 @@ static void calcMD5Mac(Common::Path &filePath, int32 length) {
 	}
 }
 
+static const char *const s_unpackTypes[] = {
+	"clickteam", "gentee", "installshield", "installshieldv3", "stuffit", "vise", "zip", nullptr
+};
+
+static bool isUnpackType(const Common::String &type) {
+	for (const char *const *t = s_unpackTypes; *t; t++) {
+		if (type == *t)
+			return true;
+	}
+	return false;
+}
+
+static Common::Archive *openInstallerArchive(const Common::String &type, const Common::FSNode &node) {
+	if (type == "clickteam")
+		return Common::ClickteamInstaller::open(node);
+	if (type == "installshield")
+		return Common::makeInstallShieldArchive(node);
+	if (type == "stuffit")
+		return Common::createStuffItArchive(node.getPath());
+	if (type == "zip")
+		return Common::makeZipArchive(node);
+
+	if (type == "installshieldv3") {
+		Common::InstallShieldV3 *archive = new Common::InstallShieldV3();
+		if (!archive->open(node)) {
+			delete archive;
+			return nullptr;
+		}
+		return archive;
+	}
+
+	Common::SeekableReadStream *stream = node.createReadStream();
+	if (!stream)
+		return nullptr;
+
+	Common::Archive *archive = nullptr;
+	if (type == "gentee")
+		archive = Common::createGenteeInstallerArchive(stream, nullptr, node.getName().hasSuffixIgnoreCase(".exe"), false);
+	else if (type == "vise")
+		archive = Common::createMacVISEArchive(stream);
+
+	if (!archive)
+		delete stream;
+	return archive;
+}
+
+// Member names come from the archive, make sure they cannot point outside of
+// the output directory
+static bool getUnpackPath(const Common::Path &path, Common::Path &outPath) {
+	if (path.empty() || path.toString('/').hasPrefix("/"))
+		return false;
+
+	outPath = path.normalize();
+	const Common::StringArray components = outPath.splitComponents();
+	for (const Common::String &component : components) {
+		if (component == "..")
+			return false;
+#ifdef WIN32
+		// Drive letters and alternate separators
+		if (component.contains(':') || component.contains('\\'))
+			return false;
+#endif
+	}
+
+	return !components.empty();
+}
+
+static bool unpackArchive(const Common::String &type, const Common::FSNode &node, const Common::Path &outDir, int32 md5Length) {
+	Common::ScopedPtr<Common::Archive> archive(openInstallerArchive(type, node));
+	if (!archive) {
+		printf("Could not open '%s' as a %s archive\n", node.getPath().toString(Common::Path::kNativeSeparator).c_str(), type.c_str());
+		return false;
+	}
+
+	Common::ArchiveMemberList members;
+	archive->listMembers(members);
+
+	const PluginList &plugins = EngineMan.getPlugins(PLUGIN_TYPE_ENGINE_DETECTION);
+	int extracted = 0, failed = 0;
+	for (const Common::ArchiveMemberPtr &member : members) {
+		if (member->isDirectory())
+			continue;
+
+		Common::Path path = member->getPathInArchive();
+		Common::Path outPath;
+		if (!getUnpackPath(path, outPath)) {
+			printf("%s: refusing to write outside of the output directory\n", path.toString(Common::Path::kNativeSeparator).c_str());
+			failed++;
+			continue;
+		}
+
+		Common::ScopedPtr<Common::SeekableReadStream> dataFork(member->createReadStream());
+		Common::ScopedPtr<Common::SeekableReadStream> resFork(member->createReadStreamForAltStream(Common::AltStreamType::MacResourceFork));
+		if (!dataFork && !resFork) {
+			printf("%s: could not be read\n", path.toString(Common::Path::kNativeSeparator).c_str());
+			failed++;
+			continue;
+		}
+
+		Common::DumpFile out;
+		if (!out.open(outDir.join(outPath), true)) {
+			printf("%s: could not be written\n", path.toString(Common::Path::kNativeSeparator).c_str());
+			failed++;
+			continue;
+		}
+
+		Common::String md5;
+		if (resFork) {
+			// Keep both forks, in a format MacResManager can read
+			Common::MacFinderInfo finderInfo;
+			Common::MacResManager::getFileFinderInfo(path, *archive, finderInfo);
+			Common::MacResManager::writeMacBinary(&out, dataFork.get(), resFork.get(), path.baseName(), finderInfo);
+			resFork->seek(0);
+			md5 = Common::computeStreamMD5AsString(*resFork, md5Length) + " (resource)";
+		} else {
+			out.writeStream(dataFork.get());
+			dataFork->seek(0);
+			md5 = Common::computeStreamMD5AsString(*dataFork, md5Length);
+		}
+
+		if (!out.flush() || out.err()) {
+			printf("%s: could not be written\n", path.toString(Common::Path::kNativeSeparator).c_str());
+			failed++;
+			continue;
+		}
+
+		out.close();
+		printf("%s: %s, %llu bytes\n", path.toString(Common::Path::kNativeSeparator).c_str(), md5.c_str(), (unsigned long long)(dataFork ? dataFork->size() : resFork->size()));
+		extracted++;
+
+		// Check the file against the detection entries describing it
+		const Common::FSNode outNode(outDir.join(outPath));
+		for (const Plugin *plugin : plugins) {
+			Common::StringArray matches, mismatches;
+			plugin->get<MetaEngineDetection>().checkDetectionEntries(outNode, matches, mismatches);
+			for (const Common::String &entry : matches)
+				printf("  matches %s\n", entry.c_str());
+			for (const Common::String &entry : mismatches)
+				printf("  does not match %s\n", entry.c_str());
+		}
+	}
+
+	printf("Extracted %d files, %d failed\n", extracted, failed);
+	return failed == 0;
+}
+
 static bool addGames(const Common::Path &path, const Common::String &engineId, const Common::String &gameId, bool recursive) {
 	//Current directory
 	Common::FSNode dir(path);
@@ -2187,6 +2361,24 @@ bool processSettings(Common::String &command, Common::StringMap &settings, Commo
 		Common::Path path(Common::Path::fromConfig(settings["path"]));
 		addGames(path, gameOption.engineId, gameOption.gameId, settings["recursive"] == "true");
 		return cmdDoExit;
+	} else if (command == "unpack-archive") {
+		if (!settings.contains("unpack-path") || !settings.contains("unpack-dir") || !settings.contains("unpack-type")) {
+			usage("Usage : --unpack-archive --unpack-type=TYPE --unpack-path=<PATH> --unpack-dir=<PATH> [--md5-length=NUM]");
+			return cmdDoExit;
+		}
+
+		if (!isUnpackType(settings["unpack-type"]))
+			usage("Unknown archive type '%s'", settings["unpack-type"].c_str());
+
+		int32 md5Length = 5000;
+		if (settings.contains("md5-length"))
+			md5Length = strtol(settings["md5-length"].c_str(), nullptr, 10);
+
+		Common::FSNode archiveNode(Common::Path(settings["unpack-path"], Common::Path::kNativeSeparator));
+		Common::Path outDir(settings["unpack-dir"], Common::Path::kNativeSeparator);
+		if (!unpackArchive(settings["unpack-type"], archiveNode, outDir, md5Length))
+			err = Common::kUnknownError;
+		return cmdDoExit;
 	} else if (command == "md5" || command == "md5mac") {
 		Common::String filename = settings.getValOrDefault("md5-path", "scummvm");
 		// Assume '/' separator except on Windows if the path contain at least one `\`
@@ -43,6 +43,7 @@
 #include "common/events.h"
 #include "gui/EventRecorder.h"
 #include "common/fs.h"
+#include "common/macresman.h"
 #ifdef ENABLE_EVENTRECORDER
 #include "common/recorderfile.h"
 #endif
@@ -345,6 +346,7 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 
 	// Free up memory
 	metaEngine.deleteInstance(engine, game, meDescriptor);
+	MetaEngine::clearSaveMetaInfosCache();
 
 	// Inform backend that the engine has been deleted
 	system.engineAfterDelete();
@@ -352,6 +354,9 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 	// Reset the file/directory mappings
 	SearchMan.clear();
 
+	// Parsed resource maps are keyed by archive, drop them with the game files
+	Common::MacResMapCache::destroy();
+
 #ifdef USE_TRANSLATION
 	TransMan.setLanguage(previousLanguage);
 	Common::TextToSpeechManager *ttsMan;
@@ -958,6 +963,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	GUI::EventRecorder::destroy();
 #endif
 	Common::SearchManager::destroy();
+	Common::MacResMapCache::destroy();
 #ifdef USE_TRANSLATION
 	Common::MainTranslationManager::destroy();
 #endif
@@ -273,50 +273,90 @@ SeekableReadStream *MemcachingCaseInsensitiveArchive::createReadStreamForMemberI
 	cacheKey.path = translatePath(path);
 	cacheKey.altStreamType = isAltStream ? altStreamType : AltStreamType::Invalid;
 
-	bool isNew = false;
-	if (!_cache.contains(cacheKey)) {
-		SharedArchiveContents readResult = isAltStream ? readContentsForPathAltStream(cacheKey.path, altStreamType) : readContentsForPath(cacheKey.path);
-		if (readResult._bypass)
-			return readResult._bypass;
-		_cache[cacheKey] = readResult;
-		isNew = true;
+	CacheEntry *entry = &_cache[cacheKey];
+
+	// Check whether the entry is valid, as it may be new or
+	// its WeakPtr might have expired.
+	if (entry->contents.isFileMissing() && entry->lastUse == 0) {
+		entry = nullptr;
+	} else if (!entry->contents.makeStrong()) {
+		entry = nullptr;
 	}
 
-	SharedArchiveContents* entry = &_cache[cacheKey];
-
-	// Errors and missing files. Just return nullptr,
-	// no need to create stream.
-	if (entry->isFileMissing())
-		return nullptr;
-
-	// Check whether the entry is still valid as WeakPtr might have expired.
-	if (!entry->makeStrong()) {
-		// If it's expired, recreate the entry.
+	if (entry) {
+		_hits++;
+	} else {
+		_misses++;
 		SharedArchiveContents readResult = isAltStream ? readContentsForPathAltStream(cacheKey.path, altStreamType) : readContentsForPath(cacheKey.path);
-		if (readResult._bypass)
+		if (readResult._bypass) {
+			_cache.erase(cacheKey);
 			return readResult._bypass;
-		_cache[cacheKey] = readResult;
+		}
+
 		entry = &_cache[cacheKey];
-		isNew = true;
+		entry->contents = readResult;
 	}
 
-	// It's possible that recreation failed in case of e.g. network
-	// share going offline.
-	if (entry->isFileMissing())
+	entry->lastUse = ++_useCounter;
+
+	// Errors and missing files, e.g. if a network share went offline.
+	// Just return nullptr, no need to create stream.
+	if (entry->contents.isFileMissing())
 		return nullptr;
 
 	// Now we have a valid contents reference. Make stream for it.
-	Common::MemoryReadStream *memStream = new Common::MemoryReadStream(entry->getContents(), entry->getSize());
-
-	// If the entry was just created and it's too big for strong caching,
-	// mark the copy in cache as weak
-	if (isNew && entry->getSize() > _maxStronglyCachedSize) {
-		entry->makeWeak();
+	uint32 size = entry->contents.getSize();
+	Common::MemoryReadStream *memStream = new Common::MemoryReadStream(entry->contents.getContents(), size);
+
+	// Only keep small contents once the stream is gone, others are
+	// freed as soon as they are not used anymore.
+	if (entry->kept) {
+		// Already accounted for
+		_keptEntries.erase(entry->keptPosition);
+		_keptEntries.push_front(cacheKey);
+		entry->keptPosition = _keptEntries.begin();
+	} else if (size <= _maxStronglyCachedSize && size <= _cacheBudget) {
+		entry->kept = true;
+		_keptEntries.push_front(cacheKey);
+		entry->keptPosition = _keptEntries.begin();
+		_cachedBytes += size;
+		enforceCacheBudget();
+	} else {
+		entry->contents.makeWeak();
 	}
 
 	return memStream;
 }
 
+void MemcachingCaseInsensitiveArchive::enforceCacheBudget() const {
+	while (_cachedBytes > _cacheBudget && !_keptEntries.empty()) {
+		CacheMap::iterator it = _cache.find(_keptEntries.back());
+		_keptEntries.pop_back();
+		assert(it != _cache.end() && it->_value.kept);
+
+		CacheEntry *oldest = &it->_value;
+		uint32 size = oldest->contents.getSize();
+		oldest->contents.makeWeak();
+		oldest->kept = false;
+		_cachedBytes -= size;
+		_evictedBytes += size;
+	}
+}
+
+void MemcachingCaseInsensitiveArchive::setCacheBudget(uint32 budget) {
+	_cacheBudget = budget;
+	enforceCacheBudget();
+}
+
+MemcachingCaseInsensitiveArchive::CacheStats MemcachingCaseInsensitiveArchive::getCacheStats() const {
+	CacheStats stats;
+	stats.hits = _hits;
+	stats.misses = _misses;
+	stats.cachedBytes = _cachedBytes;
+	stats.evictedBytes = _evictedBytes;
+	return stats;
+}
+
 SharedArchiveContents MemcachingCaseInsensitiveArchive::readContentsForPathAltStream(const Path &translatedPath, AltStreamType altStreamType) const {
 	return SharedArchiveContents();
 }
@@ -332,6 +372,8 @@ uint MemcachingCaseInsensitiveArchive::CacheKey_Hash::operator()(const CacheKey
 	return static_cast<uint>(x.path.hashIgnoreCase() * 1000003u) ^ static_cast<uint>(x.altStreamType);
 }
 
+uint32 SearchSet::_lastRevision = 0;
+
 SearchSet::ArchiveNodeList::iterator SearchSet::find(const String &name) {
 	ArchiveNodeList::iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
@@ -362,6 +404,7 @@ void SearchSet::insert(const Node &node) {
 			break;
 	}
 	_list.insert(it, node);
+	updateNestedSets();
 }
 
 void SearchSet::add(const String &name, Archive *archive, int priority, bool autoFree) {
@@ -458,6 +501,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		updateNestedSets();
 	}
 }
 
@@ -481,6 +525,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	updateNestedSets();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -499,16 +544,70 @@ void SearchSet::setPriority(const String &name, int priority) {
 	insert(node);
 }
 
-bool SearchSet::hasFile(const Path &path) const {
-	if (path.empty())
-		return false;
+void SearchSet::updateNestedSets() {
+	_nestedSets.clear();
+	for (const auto &archive : _list) {
+		const SearchSet *nested = dynamic_cast<const SearchSet *>(archive._arc);
+		if (nested)
+			_nestedSets.push_back(nested);
+	}
+
+	invalidatePathIndex();
+}
+
+uint32 SearchSet::getRevision() const {
+	// Revisions are taken from a single counter, so the largest one changes
+	// whenever any of the search sets is modified
+	uint32 revision = _revision;
+	for (const auto &nested : _nestedSets)
+		revision = MAX(revision, nested->getRevision());
+	return revision;
+}
+
+Archive *SearchSet::lookupArchive(const Path &path) const {
+	const uint32 revision = getRevision();
 
+	// Don't let the cache grow without bounds when engines probe lots of names
+	if (_pathIndexRevision != revision || _pathIndex.size() >= 65536) {
+		_pathIndex.clear(true);
+		_pathIndexRevision = revision;
+	}
+
+	PathIndex::const_iterator i = _pathIndex.find(path);
+	if (i != _pathIndex.end()) {
+		_pathIndexHits++;
+		return i->_value;
+	}
+
+	_pathIndexMisses++;
+
+	Archive *result = nullptr;
 	for (const auto &archive : _list) {
-		if (archive._arc->hasFile(path))
-			return true;
+		if (archive._arc->hasFile(path)) {
+			result = archive._arc;
+			break;
+		}
 	}
 
-	return false;
+	// Missing files are not cached, as they may be added to an archive at
+	// any time. Querying the archives may also have modified a search set.
+	if (result && getRevision() == revision)
+		_pathIndex[path] = result;
+
+	return result;
+}
+
+void SearchSet::getPathIndexStats(uint &entries, uint &hits, uint &misses) const {
+	entries = (_pathIndexRevision == getRevision()) ? _pathIndex.size() : 0;
+	hits = _pathIndexHits;
+	misses = _pathIndexMisses;
+}
+
+bool SearchSet::hasFile(const Path &path) const {
+	if (path.empty())
+		return false;
+
+	return lookupArchive(path) != nullptr;
 }
 
 bool SearchSet::isPathDirectory(const Path &path) const {
@@ -583,16 +682,13 @@ const ArchiveMemberPtr SearchSet::getMember(const Path &path, Archive **containe
 	if (path.empty())
 		return ArchiveMemberPtr();
 
-	for (const auto &archive : _list) {
-		if (archive._arc->hasFile(path)) {
-			if (container) {
-				*container = archive._arc;
-			}
-			return archive._arc->getMember(path);
-		}
-	}
+	Archive *archive = lookupArchive(path);
+	if (!archive)
+		return ArchiveMemberPtr();
 
-	return ArchiveMemberPtr();
+	if (container)
+		*container = archive;
+	return archive->getMember(path);
 }
 
 const ArchiveMemberPtr SearchSet::getMember(const Path &path) const {
@@ -603,7 +699,19 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const Path &path) const
 	if (path.empty())
 		return nullptr;
 
+	Archive *found = lookupArchive(path);
+	if (found) {
+		SeekableReadStream *stream = found->createReadStreamForMember(path);
+		if (stream)
+			return stream;
+	}
+
+	// Some archives open files they don't report in hasFile(), so ask all of
+	// them when the lookup failed, like when there was no cache
 	for (const auto &archive : _list) {
+		if (archive._arc == found)
+			continue;
+
 		SeekableReadStream *stream = archive._arc->createReadStreamForMember(path);
 		if (stream)
 			return stream;
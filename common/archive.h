@@ -283,10 +283,24 @@ private:
 
 /**
  * An archive that caches the resulting contents.
+ *
+ * Contents are shared with all the streams created for them. Once no stream
+ * references them anymore, they are only kept if they are small enough, and
+ * the least recently used ones are dropped when the total size of the kept
+ * contents exceeds the cache budget.
  */
 class MemcachingCaseInsensitiveArchive : public Archive {
 public:
-	MemcachingCaseInsensitiveArchive(uint32 maxStronglyCachedSize = 512) : _maxStronglyCachedSize(maxStronglyCachedSize) {}
+	/** Statistics about the cached contents. */
+	struct CacheStats {
+		uint32 hits;         //!< Number of streams created from cached contents.
+		uint32 misses;       //!< Number of times contents were read from the archive.
+		uint32 cachedBytes;  //!< Size of the contents currently kept by the cache.
+		uint64 evictedBytes; //!< Total size of the contents dropped to stay within the budget.
+	};
+
+	MemcachingCaseInsensitiveArchive(uint32 maxStronglyCachedSize = 512, uint32 cacheBudget = 1024 * 1024)
+		: _maxStronglyCachedSize(maxStronglyCachedSize), _cacheBudget(cacheBudget), _cachedBytes(0), _useCounter(0), _hits(0), _misses(0), _evictedBytes(0) {}
 	SeekableReadStream *createReadStreamForMember(const Path &path) const override;
 	SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, Common::AltStreamType altStreamType) const override;
 
@@ -297,6 +311,14 @@ public:
 	virtual SharedArchiveContents readContentsForPath(const Path &translatedPath) const = 0;
 	virtual SharedArchiveContents readContentsForPathAltStream(const Path &translatedPath, AltStreamType altStreamType) const;
 
+	/**
+	 * Set the maximum total size of the contents kept once no stream references them.
+	 * Least recently used contents are dropped first.
+	 */
+	void setCacheBudget(uint32 budget);
+
+	CacheStats getCacheStats() const;
+
 private:
 	struct CacheKey {
 		CacheKey();
@@ -313,10 +335,30 @@ private:
 		uint operator()(const CacheKey &x) const;
 	};
 
+	typedef List<CacheKey> KeptList;
+
+	struct CacheEntry {
+		CacheEntry() : lastUse(0), kept(false) {}
+
+		SharedArchiveContents contents;
+		uint32 lastUse;
+		bool kept; //!< Whether the contents are strongly referenced by the cache
+		KeptList::iterator keptPosition; //!< Position in the kept list, if kept
+	};
+
+	typedef HashMap<CacheKey, CacheEntry, CacheKey_Hash, CacheKey_EqualTo> CacheMap;
+
 	SeekableReadStream *createReadStreamForMemberImpl(const Path &path, bool isAltStream, Common::AltStreamType altStreamType) const;
+	void enforceCacheBudget() const;
 
-	mutable HashMap<CacheKey, SharedArchiveContents, CacheKey_Hash, CacheKey_EqualTo> _cache;
+	mutable CacheMap _cache;
+	mutable KeptList _keptEntries; //!< Keys of the kept contents, most recently used first
 	uint32 _maxStronglyCachedSize;
+	uint32 _cacheBudget;
+	mutable uint32 _cachedBytes;
+	mutable uint32 _useCounter;
+	mutable uint32 _hits, _misses;
+	mutable uint64 _evictedBytes;
 };
 
 /**
@@ -347,8 +389,32 @@ class SearchSet : public Archive {
 
 	bool _ignoreClashes;
 
+	/**
+	 * Cache of the archive a given path resolves to.
+	 *
+	 * Only paths which were found are cached, so files added to an archive
+	 * later on are still picked up. It is flushed whenever this SearchSet or
+	 * one of the search sets nested into it is modified.
+	 *
+	 * Lookups update the cache, so a SearchSet must not be used from several
+	 * threads at once.
+	 */
+	typedef HashMap<Path, Archive *, Path::Hash, Path::EqualTo> PathIndex;
+	mutable PathIndex _pathIndex;
+	mutable uint32 _pathIndexRevision;
+	mutable uint32 _pathIndexHits, _pathIndexMisses;
+
+	uint32 _revision; //!< Value of _lastRevision when this search set was last modified.
+	static uint32 _lastRevision;
+	Array<const SearchSet *> _nestedSets;
+
+	uint32 getRevision() const; //!< Return the revision of the most recently modified search set among this one and the nested ones.
+	void updateNestedSets();
+
+	Archive *lookupArchive(const Path &path) const; //!< Return the first archive containing the given path.
+
 public:
-	SearchSet() : _ignoreClashes(false) { }
+	SearchSet() : _ignoreClashes(false), _pathIndexRevision(0), _pathIndexHits(0), _pathIndexMisses(0), _revision(0) { }
 	virtual ~SearchSet() { clear(); }
 
 	char getPathSeparator() const override { return '/'; }
@@ -477,6 +543,25 @@ public:
 	void setIgnoreClashes(bool ignoreClashes) { _ignoreClashes = ignoreClashes; }
 
 	bool getChildren(const Common::Path &path, Common::Array<Common::String> &list, ListMode mode = kListDirectoriesOnly, bool hidden = true) const override;
+
+	/**
+	 * Flush the cached path lookups of this search set, and of the search sets
+	 * it is nested into.
+	 *
+	 * This only needs to be called when a file is removed from an archive which
+	 * is part of this search set, or when it is added to an archive which takes
+	 * precedence over the one the path was previously found in.
+	 */
+	void invalidatePathIndex() { _revision = ++_lastRevision; }
+
+	/**
+	 * Get statistics about the cached path lookups.
+	 *
+	 * @param entries Number of paths currently cached.
+	 * @param hits    Number of lookups answered from the cache.
+	 * @param misses  Number of lookups which needed to query the archives.
+	 */
+	void getPathIndexStats(uint &entries, uint &hits, uint &misses) const;
 };
 
 
@@ -21,6 +21,7 @@
 
 #include "common/compression/dcl.h"
 #include "common/debug.h"
+#include "common/endian.h"
 #include "common/memstream.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
@@ -29,75 +30,157 @@ namespace Common {
 
 class DecompressorDCL {
 public:
-	bool unpack(SeekableReadStream *sourceStream, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize);
+	/**
+	 * Unpack data held in memory into a buffer of targetSize bytes.
+	 */
+	bool unpack(const byte *source, uint32 sourceSize, byte *target, uint32 targetSize);
+
+	/**
+	 * Unpack data from a stream. The source is read in chunks, data read
+	 * ahead of what the decompressor needed is given back to the stream.
+	 * If target is set, the output is written there, otherwise it is
+	 * appended to targetStream.
+	 */
+	bool unpack(SeekableReadStream *sourceStream, byte *target, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize);
 
 protected:
+	/**
+	 * Entry of a table resolving the first kHuffmanFastBits bits of a
+	 * code at once, indexed by the next bits of the source.
+	 */
+	struct HuffmanFastEntry {
+		uint16 value;	///< decoded value, or tree position to continue from
+		byte bits;		///< number of bits consumed
+		bool leaf;		///< true if value is a decoded value
+	};
+
+	enum {
+		kHuffmanFastBits = 8,
+		kChunkSize = 4096
+	};
+
 	/**
 	 * Initialize decompressor.
-	 * @param sourceStream	source stream to read from
-	 * @param targetStream	target memory stream to write to
+	 * @param source		source data in memory
+	 * @param sourceSize	size of the source data in memory
+	 * @param sourceStream	source stream to read more data from, may be nullptr
+	 * @param target		target buffer to write to, or nullptr to write to targetStream
+	 * @param targetStream	target stream to write to
+	 */
+	void init(const byte *source, uint32 sourceSize, SeekableReadStream *sourceStream, byte *target, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize);
+
+	bool unpack();
+
+	/**
+	 * Fill the bits buffer with whole bytes, reading a word at a time
+	 * when enough source data is available.
+	 */
+	void fetchBitsLSB();
+
+	/**
+	 * Read the next chunk of the source stream.
+	 * @return false if there is nothing left to read
 	 */
-	void init(SeekableReadStream *sourceStream, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize);
+	bool fetchChunk();
 
 	/**
-	 * Get a number of bits from _src stream, starting with the least
-	 * significant unread bit of the current four byte block.
+	 * Get a number of bits from the source, starting with the least
+	 * significant unread bit of the bits buffer.
 	 * @param n		number of bits to get
 	 * @return n-bits number
 	 */
 	uint32 getBitsLSB(int n);
 
 	/**
-	 * Get one byte from _src stream.
+	 * Get one byte from the source.
 	 * @return byte
 	 */
 	byte getByteLSB();
 
-	void fetchBitsLSB();
-
 	/**
-	 * Write one byte into _dest stream
+	 * Write one byte into the target
 	 * @param b byte to put
 	 */
 	void putByte(byte b);
 
-	int huffman_lookup(const int *tree);
+	int huffman_lookup(const int *tree, const HuffmanFastEntry *table);
 
-	uint32 _dwBits;			///< bits buffer
-	byte _nBits;			///< number of unread bits in _dwBits
-	uint32 _sourceSize;		///< size of the source stream
+	static void buildFastTable(const int *tree, HuffmanFastEntry *table);
+	static void buildFastTables();
+
+	uint64 _dwBits;			///< bits buffer
+	uint _nBits;			///< number of unread bits in _dwBits
+	uint32 _overrun;		///< number of zero bytes fetched past the end of the source
+	const byte *_source;	///< next unread source byte
+	const byte *_sourceEnd;	///< end of the source data currently in memory
 	uint32 _targetSize;		///< size of the target stream (if fixed)
 	bool _targetFixedSize;  ///< if target stream is fixed size or dynamic size
-	uint32 _bytesRead;		///< number of bytes read from _sourceStream
-	uint32 _bytesWritten;	///< number of bytes written to _targetStream
+	uint32 _bytesWritten;	///< number of bytes written to the target
 	SeekableReadStream *_sourceStream;
+	byte *_target;
 	WriteStream *_targetStream;
+	byte _chunk[kChunkSize];	///< source stream data currently in memory
+
+	static HuffmanFastEntry _lengthTable[1 << kHuffmanFastBits];
+	static HuffmanFastEntry _distanceTable[1 << kHuffmanFastBits];
+	static HuffmanFastEntry _asciiTable[1 << kHuffmanFastBits];
+	static bool _fastTablesBuilt;
 };
 
-void DecompressorDCL::init(SeekableReadStream *sourceStream, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize) {
+void DecompressorDCL::init(const byte *source, uint32 sourceSize, SeekableReadStream *sourceStream, byte *target, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize) {
+	_source = source;
+	_sourceEnd = source + sourceSize;
 	_sourceStream = sourceStream;
+	_target = target;
 	_targetStream = targetStream;
-	_sourceSize = sourceStream->size();
 	_targetSize = targetSize;
 	_targetFixedSize = targetFixedSize;
 	_nBits = 0;
-	_bytesRead = _bytesWritten = 0;
+	_overrun = 0;
+	_bytesWritten = 0;
 	_dwBits = 0;
+
+	if (!_fastTablesBuilt)
+		buildFastTables();
+}
+
+bool DecompressorDCL::fetchChunk() {
+	if (!_sourceStream)
+		return false;
+
+	uint32 size = _sourceStream->read(_chunk, kChunkSize);
+	_source = _chunk;
+	_sourceEnd = _chunk + size;
+	return size != 0;
 }
 
 void DecompressorDCL::fetchBitsLSB() {
-	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_sourceStream->readByte()) << _nBits;
+	if (_sourceEnd - _source >= 8) {
+		const uint bytes = (64 - _nBits) >> 3;
+		uint64 word = READ_LE_UINT64(_source);
+		if (bytes < 8)
+			word &= ((uint64)1 << (bytes * 8)) - 1;
+		_dwBits |= word << _nBits;
+		_nBits += bytes * 8;
+		_source += bytes;
+		return;
+	}
+
+	// Near the end of the data, missing bytes are read as zero
+	while (_nBits <= 56) {
+		if (_source != _sourceEnd || fetchChunk())
+			_dwBits |= ((uint64)*_source++) << _nBits;
+		else
+			_overrun++;
 		_nBits += 8;
-		_bytesRead++;
 	}
 }
 
 uint32 DecompressorDCL::getBitsLSB(int n) {
 	// Fetching more data to buffer if needed
-	if (_nBits < n)
+	if (_nBits < (uint)n)
 		fetchBitsLSB();
-	uint32 ret = (_dwBits & ~(~0UL << n));
+	uint32 ret = (uint32)_dwBits & ~(0xFFFFFFFFU << n);
 	_dwBits >>= n;
 	_nBits -= n;
 	return ret;
@@ -108,7 +191,10 @@ byte DecompressorDCL::getByteLSB() {
 }
 
 void DecompressorDCL::putByte(byte b) {
-	_targetStream->writeByte(b);
+	if (_target)
+		_target[_bytesWritten] = b;
+	else
+		_targetStream->writeByte(b);
 	_bytesWritten++;
 }
 
@@ -315,16 +401,53 @@ static const int ascii_tree[] = {
 	LN(509, 128)      LN(510, 26)
 };
 
-int DecompressorDCL::huffman_lookup(const int *tree) {
-	int pos = 0;
+DecompressorDCL::HuffmanFastEntry DecompressorDCL::_lengthTable[1 << kHuffmanFastBits];
+DecompressorDCL::HuffmanFastEntry DecompressorDCL::_distanceTable[1 << kHuffmanFastBits];
+DecompressorDCL::HuffmanFastEntry DecompressorDCL::_asciiTable[1 << kHuffmanFastBits];
+bool DecompressorDCL::_fastTablesBuilt = false;
+
+void DecompressorDCL::buildFastTable(const int *tree, HuffmanFastEntry *table) {
+	for (int i = 0; i < (1 << kHuffmanFastBits); i++) {
+		int pos = 0;
+		byte bits = 0;
 
+		while (!(tree[pos] & HUFFMAN_LEAF) && bits < kHuffmanFastBits) {
+			int bit = (i >> bits) & 1;
+			pos = bit ? tree[pos] & 0xFFF : tree[pos] >> 12;
+			bits++;
+		}
+
+		table[i].leaf = (tree[pos] & HUFFMAN_LEAF) != 0;
+		table[i].value = table[i].leaf ? (tree[pos] & 0xFFFF) : pos;
+		table[i].bits = bits;
+	}
+}
+
+void DecompressorDCL::buildFastTables() {
+	buildFastTable(length_tree, _lengthTable);
+	buildFastTable(distance_tree, _distanceTable);
+	buildFastTable(ascii_tree, _asciiTable);
+	_fastTablesBuilt = true;
+}
+
+int DecompressorDCL::huffman_lookup(const int *tree, const HuffmanFastEntry *table) {
+	// The longest code is 13 bits
+	if (_nBits < 16)
+		fetchBitsLSB();
+
+	const HuffmanFastEntry &entry = table[_dwBits & ((1 << kHuffmanFastBits) - 1)];
+	_dwBits >>= entry.bits;
+	_nBits -= entry.bits;
+	if (entry.leaf)
+		return entry.value;
+
+	// Codes longer than the table are finished one bit at a time
+	int pos = entry.value;
 	while (!(tree[pos] & HUFFMAN_LEAF)) {
 		int bit = getBitsLSB(1);
-		debug(8, "[%d]:%d->", pos, bit);
 		pos = bit ? tree[pos] & 0xFFF : tree[pos] >> 12;
 	}
 
-	debug(8, "=%02x\n", tree[pos] & 0xffff);
 	return tree[pos] & 0xFFFF;
 }
 
@@ -333,7 +456,23 @@ int DecompressorDCL::huffman_lookup(const int *tree) {
 
 #define MIDI_SETUP_BUNDLE_FILE_MAXIMUM_DICTIONARY_SIZE 4096
 
-bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize) {
+bool DecompressorDCL::unpack(const byte *source, uint32 sourceSize, byte *target, uint32 targetSize) {
+	init(source, sourceSize, nullptr, target, nullptr, targetSize, true);
+	return unpack();
+}
+
+bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, byte *target, WriteStream *targetStream, uint32 targetSize, bool targetFixedSize) {
+	init(_chunk, 0, sourceStream, target, targetStream, targetSize, targetFixedSize);
+	bool success = unpack();
+
+	// Give back the data read ahead but never fetched into the bits buffer
+	if (_sourceEnd != _source)
+		sourceStream->seek(-(int32)(_sourceEnd - _source), SEEK_CUR);
+
+	return success;
+}
+
+bool DecompressorDCL::unpack() {
 	byte   dictionary[MIDI_SETUP_BUNDLE_FILE_MAXIMUM_DICTIONARY_SIZE];
 	uint16 dictionaryPos = 0;
 	uint16 dictionarySize = 0;
@@ -342,8 +481,6 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 	uint16 tokenOffset = 0;
 	uint16 tokenLength = 0;
 
-	init(sourceStream, targetStream, targetSize, targetFixedSize);
-
 	byte mode = getByteLSB();
 	byte dictionaryType = getByteLSB();
 
@@ -371,9 +508,15 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 	}
 	dictionaryMask = dictionarySize - 1;
 
-	while ((!targetFixedSize) || (_bytesWritten < _targetSize)) {
+	while ((!_targetFixedSize) || (_bytesWritten < _targetSize)) {
+		if (!_targetFixedSize && _overrun * 8 > _nBits) {
+			// Without a size limit, decoding padding would never stop
+			warning("DCL-IMPLODE Error: Reached the end of the source data without an end of stream marker");
+			return false;
+		}
+
 		if (getBitsLSB(1)) { // (length,distance) pair
-			value = huffman_lookup(length_tree);
+			value = huffman_lookup(length_tree, _lengthTable);
 
 			if (value < 8)
 				tokenLength = value + 2;
@@ -385,7 +528,7 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 
 			debug(8, " | ");
 
-			value = huffman_lookup(distance_tree);
+			value = huffman_lookup(distance_tree, _distanceTable);
 
 			if (tokenLength == 2)
 				tokenOffset = (value << 2) | getBitsLSB(2);
@@ -409,41 +552,44 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 				return false;
 			}
 
-			uint16 dictionaryBaseIndex = (dictionaryPos - tokenOffset) & dictionaryMask;
-			uint16 dictionaryIndex = dictionaryBaseIndex;
-			uint16 dictionaryNextIndex = dictionaryPos;
+			if (_target) {
+				// The whole output is at hand, copy straight from it
+				byte *dest = _target + _bytesWritten;
+				const byte *src = dest - tokenOffset;
+				for (uint16 i = 0; i < tokenLength; i++)
+					dest[i] = src[i];
+				_bytesWritten += tokenLength;
+				continue;
+			}
+
+			// Each byte is copied from tokenOffset bytes back, so overlapping
+			// copies repeat the last tokenOffset bytes. This also holds when
+			// the copy wraps around into the bytes it is reading.
+			uint16 dictionaryIndex = (dictionaryPos - tokenOffset) & dictionaryMask;
 
 			while (tokenLength) {
 				// Write byte from dictionary
-				putByte(dictionary[dictionaryIndex]);
-				debug(9, "\33[32;31m%02x\33[37;37m ", dictionary[dictionaryIndex]);
-
-				dictionary[dictionaryNextIndex] = dictionary[dictionaryIndex];
+				byte b = dictionary[dictionaryIndex];
+				putByte(b);
+				dictionary[dictionaryPos] = b;
 
-				dictionaryNextIndex = (dictionaryNextIndex + 1) & dictionaryMask;
+				dictionaryPos = (dictionaryPos + 1) & dictionaryMask;
 				dictionaryIndex = (dictionaryIndex + 1) & dictionaryMask;
 
-				if (dictionaryIndex == dictionaryPos)
-					dictionaryIndex = dictionaryBaseIndex;
-				if (dictionaryNextIndex == dictionarySize)
-					dictionaryNextIndex = 0;
-
 				tokenLength--;
 			}
-			dictionaryPos = dictionaryNextIndex;
-			debug(9, "\n");
 
 		} else { // Copy byte verbatim
-			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree) : getByteLSB();
+			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree, _asciiTable) : getByteLSB();
 			putByte(value);
 
 			// Also remember it inside dictionary
-			dictionary[dictionaryPos] = value;
-			dictionaryPos++;
-			if (dictionaryPos >= dictionarySize)
-				dictionaryPos = 0;
-
-			debug(9, "\33[32;31m%02x \33[37;37m", value);
+			if (!_target) {
+				dictionary[dictionaryPos] = value;
+				dictionaryPos++;
+				if (dictionaryPos >= dictionarySize)
+					dictionaryPos = 0;
+			}
 		}
 	}
 
@@ -467,31 +613,23 @@ bool decompressDCL(ReadStream *src, byte *dest, uint32 packedSize, uint32 unpack
 		return false;
 
 	// Read source into memory
-	src->read(sourceBufferPtr, packedSize);
-
-	Common::MemoryReadStream  *sourceStream = new MemoryReadStream(sourceBufferPtr, packedSize, DisposeAfterUse::YES);
-	Common::MemoryWriteStream *targetStream = new MemoryWriteStream(dest, unpackedSize);
+	uint32 sourceSize = src->read(sourceBufferPtr, packedSize);
 
-	success = dcl.unpack(sourceStream, targetStream, unpackedSize, true);
-	delete sourceStream;
-	delete targetStream;
+	success = dcl.unpack(sourceBufferPtr, sourceSize, dest, unpackedSize);
+	free(sourceBufferPtr);
 	return success;
 }
 
 SeekableReadStream *decompressDCL(SeekableReadStream *sourceStream, uint32 packedSize, uint32 unpackedSize) {
 	bool success = false;
 	byte *targetPtr = nullptr;
-	Common::MemoryWriteStream *targetStream;
 	DecompressorDCL dcl;
 
 	targetPtr = (byte *)malloc(unpackedSize);
 	if (!targetPtr)
 		return nullptr;
 
-	targetStream = new MemoryWriteStream(targetPtr, unpackedSize);
-
-	success = dcl.unpack(sourceStream, targetStream, unpackedSize, true);
-	delete targetStream;
+	success = dcl.unpack(sourceStream, targetPtr, nullptr, unpackedSize, true);
 
 	if (!success) {
 		free(targetPtr);
@@ -508,12 +646,13 @@ SeekableReadStream *decompressDCL(SeekableReadStream *sourceStream) {
 
 	targetStream = new MemoryWriteStreamDynamic(DisposeAfterUse::NO);
 
-	if (dcl.unpack(sourceStream, targetStream, 0, false)) {
+	if (dcl.unpack(sourceStream, nullptr, targetStream, 0, false)) {
 		byte *targetPtr = targetStream->getData();
 		uint32 unpackedSize = targetStream->size();
 		delete targetStream;
 		return new MemoryReadStream(targetPtr, unpackedSize, DisposeAfterUse::YES);
 	}
+	free(targetStream->getData());
 	delete targetStream;
 	return nullptr;
 }
@@ -0,0 +1,113 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/compression/delta.h"
+#include "common/stream.h"
+
+namespace Common {
+
+// Shorter runs of identical bytes are kept in the literals,
+// as a new record would take about as much room
+static const uint32 kMinCopyLength = 8;
+
+static void writeVarint(WriteStream &out, uint32 value) {
+	while (value >= 0x80) {
+		out.writeByte((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+	out.writeByte(value);
+}
+
+static bool readVarint(ReadStream &in, uint32 &value) {
+	value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		byte b = in.readByte();
+		if (in.eos() || in.err())
+			return false;
+
+		value |= (uint32)(b & 0x7F) << shift;
+		if (!(b & 0x80))
+			return true;
+	}
+
+	return false;
+}
+
+static uint32 matchLength(const byte *base, uint32 baseSize, const byte *data, uint32 size, uint32 pos) {
+	const uint32 end = MIN(baseSize, size);
+	uint32 len = 0;
+	while (pos + len < end && base[pos + len] == data[pos + len])
+		len++;
+	return len;
+}
+
+uint32 createDelta(const byte *base, uint32 baseSize, const byte *data, uint32 size, WriteStream &out) {
+	const int64 start = out.pos();
+	uint32 pos = 0;
+
+	while (pos < size) {
+		const uint32 copyLen = matchLength(base, baseSize, data, size, pos);
+		pos += copyLen;
+
+		// Extend the literals until a run worth copying starts
+		uint32 literalEnd = pos;
+		while (literalEnd < size) {
+			if (literalEnd < baseSize && base[literalEnd] == data[literalEnd] &&
+					matchLength(base, baseSize, data, size, literalEnd) >= MIN(kMinCopyLength, size - literalEnd))
+				break;
+			literalEnd++;
+		}
+
+		writeVarint(out, copyLen);
+		writeVarint(out, literalEnd - pos);
+		out.write(data + pos, literalEnd - pos);
+		pos = literalEnd;
+	}
+
+	return out.pos() - start;
+}
+
+bool applyDelta(const byte *base, uint32 baseSize, ReadStream &delta, byte *out, uint32 size) {
+	uint32 pos = 0;
+
+	while (pos < size) {
+		uint32 copyLen, literalLen;
+		if (!readVarint(delta, copyLen) || !readVarint(delta, literalLen))
+			return false;
+
+		if (copyLen > size - pos || pos + copyLen > baseSize)
+			return false;
+		memcpy(out + pos, base + pos, copyLen);
+		pos += copyLen;
+
+		if (literalLen > size - pos)
+			return false;
+		if (delta.read(out + pos, literalLen) != literalLen)
+			return false;
+		pos += literalLen;
+	}
+
+	// The whole delta must have been used
+	delta.readByte();
+	return delta.eos();
+}
+
+} // End of namespace Common
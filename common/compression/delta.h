@@ -0,0 +1,73 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_DELTA_H
+#define COMMON_DELTA_H
+
+#include "common/scummsys.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_delta Binary deltas
+ * @ingroup common
+ *
+ * @brief  Compact binary deltas between two versions of some data.
+ *
+ * @details The delta is a sequence of records, each made of the number of
+ *          bytes to copy from the same position in the base data, followed
+ *          by a number of literal bytes and those bytes. Both numbers are
+ *          stored as little endian base 128 varints.
+ *
+ *          This only captures in-place modifications well, which is what
+ *          successive serializations of a game state mostly consist of.
+ *          Insertions make the rest of the data literal.
+ * @{
+ */
+
+class ReadStream;
+class WriteStream;
+
+/**
+ * Encode @p data as a delta against @p base.
+ *
+ * @return The number of bytes written to @p out.
+ */
+uint32 createDelta(const byte *base, uint32 baseSize, const byte *data, uint32 size, WriteStream &out);
+
+/**
+ * Rebuild the data encoded by createDelta().
+ *
+ * @param base      The data the delta was created against.
+ * @param baseSize  Size of the base data.
+ * @param delta     Stream holding the delta, read up to its end.
+ * @param out       Buffer receiving the rebuilt data.
+ * @param size      Size of the rebuilt data.
+ *
+ * @return true if the delta was consistent with the sizes.
+ */
+bool applyDelta(const byte *base, uint32 baseSize, ReadStream &delta, byte *out, uint32 size);
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -83,6 +83,210 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
 	return true;
 }
 
+/**
+ * Stream reading a file split across several volumes in place.
+ */
+class SplitFileReadStream : public SeekableReadStream {
+public:
+	SplitFileReadStream() : _size(0), _pos(0), _eos(false), _err(false) {}
+
+	void addPart(SeekableReadStream *part) {
+		_parts.push_back(SharedPtr<SeekableReadStream>(part));
+		_partStarts.push_back(_size);
+		_size += part->size();
+	}
+
+	bool err() const override { return _err; }
+	void clearErr() override { _err = false; _eos = false; }
+	bool eos() const override { return _eos; }
+
+	int64 pos() const override { return _pos; }
+	int64 size() const override { return _size; }
+
+	bool seek(int64 offset, int whence = SEEK_SET) override {
+		switch (whence) {
+		case SEEK_END:
+			offset += _size;
+			break;
+		case SEEK_CUR:
+			offset += _pos;
+			break;
+		default:
+			break;
+		}
+
+		if (offset < 0 || offset > _size)
+			return false;
+
+		_pos = offset;
+		_eos = false;
+		return true;
+	}
+
+	uint32 read(void *dataPtr, uint32 dataSize) override {
+		byte *dst = (byte *)dataPtr;
+		uint32 total = 0;
+
+		for (uint part = 0; part < _parts.size() && total < dataSize; part++) {
+			uint32 partEnd = _partStarts[part] + _parts[part]->size();
+			if (_pos >= partEnd)
+				continue;
+
+			_parts[part]->seek(_pos - _partStarts[part]);
+			uint32 count = _parts[part]->read(dst + total, MIN<uint32>(dataSize - total, partEnd - _pos));
+			total += count;
+			_pos += count;
+			if (_parts[part]->err() || _pos < partEnd) {
+				_err = _parts[part]->err();
+				break;
+			}
+		}
+
+		if (total < dataSize)
+			_eos = true;
+		return total;
+	}
+
+private:
+	Array<SharedPtr<SeekableReadStream> > _parts;
+	Array<uint32> _partStarts;
+	uint32 _size, _pos;
+	bool _eos, _err;
+};
+
+/**
+ * Stream decompressing the chunked deflate format used by some cabinets
+ * on demand. Each chunk is an independent deflate stream, so seeking only
+ * needs to decompress the chunk containing the new position. The chunk
+ * start offsets are recorded while decompressing.
+ */
+class InstallShieldChunkedReadStream : public SeekableReadStream {
+public:
+	InstallShieldChunkedReadStream(SeekableReadStream *compressed, uint32 size)
+		: _compressed(compressed, DisposeAfterUse::YES), _size(size), _pos(0), _chunk(-1), _eos(false), _err(false) {
+		Chunk first = { 0, 0 };
+		_chunks.push_back(first);
+	}
+
+	bool err() const override { return _err; }
+	void clearErr() override { _err = false; _eos = false; }
+	bool eos() const override { return _eos; }
+
+	int64 pos() const override { return _pos; }
+	int64 size() const override { return _size; }
+
+	bool seek(int64 offset, int whence = SEEK_SET) override {
+		switch (whence) {
+		case SEEK_END:
+			offset += _size;
+			break;
+		case SEEK_CUR:
+			offset += _pos;
+			break;
+		default:
+			break;
+		}
+
+		if (offset < 0 || offset > _size)
+			return false;
+
+		_pos = offset;
+		_eos = false;
+		return true;
+	}
+
+	uint32 read(void *dataPtr, uint32 dataSize) override {
+		byte *dst = (byte *)dataPtr;
+		uint32 total = 0;
+
+		while (total < dataSize && _pos < _size) {
+			if (!loadChunkAt(_pos)) {
+				_err = true;
+				break;
+			}
+
+			uint32 offset = _pos - _chunks[_chunk].uncompressedOffset;
+			uint32 count = MIN<uint32>(dataSize - total, _chunkData.size() - offset);
+			memcpy(dst + total, _chunkData.data() + offset, count);
+			total += count;
+			_pos += count;
+		}
+
+		if (total < dataSize)
+			_eos = true;
+		return total;
+	}
+
+private:
+	struct Chunk {
+		uint32 compressedOffset;
+		uint32 uncompressedOffset;
+	};
+
+	bool isInChunk(uint32 pos) const {
+		return _chunk >= 0 && pos >= _chunks[_chunk].uncompressedOffset &&
+			pos < _chunks[_chunk].uncompressedOffset + _chunkData.size();
+	}
+
+	bool loadChunkAt(uint32 pos) {
+		if (isInChunk(pos))
+			return true;
+
+		// Start from the last known chunk before the position
+		int chunk = _chunks.size() - 1;
+		while (_chunks[chunk].uncompressedOffset > pos)
+			chunk--;
+
+		for (;;) {
+			if (!loadChunk(chunk))
+				return false;
+			if (isInChunk(pos))
+				return true;
+			chunk++;
+		}
+	}
+
+	bool loadChunk(int chunk) {
+		const Chunk &info = _chunks[chunk];
+		_chunk = -1;
+		_chunkData.clear();
+
+		if (!_compressed->seek(info.compressedOffset))
+			return false;
+		uint16 chunkSize = _compressed->readUint16LE();
+		if (_compressed->eos() || chunkSize == 0)
+			return false;
+
+		uint32 start = info.compressedOffset + 2;
+		ScopedPtr<SeekableReadStream> inflated(wrapDeflateReadStream(new SeekableSubReadStream(_compressed.get(), start, start + chunkSize)));
+		if (!inflated)
+			return false;
+
+		byte buf[4096];
+		uint32 count;
+		while ((count = inflated->read(buf, sizeof(buf))) > 0) {
+			_chunkData.resize(_chunkData.size() + count);
+			memcpy(_chunkData.data() + _chunkData.size() - count, buf, count);
+		}
+		if (inflated->err() || _chunkData.empty())
+			return false;
+
+		_chunk = chunk;
+		if (chunk + 1 == (int)_chunks.size()) {
+			Chunk next = { start + chunkSize, info.uncompressedOffset + _chunkData.size() };
+			_chunks.push_back(next);
+		}
+		return true;
+	}
+
+	DisposablePtr<SeekableReadStream> _compressed;
+	uint32 _size, _pos;
+	Array<Chunk> _chunks;
+	Array<byte> _chunkData;
+	int _chunk;
+	bool _eos, _err;
+};
+
 class SeekableDeobfuscationReadStream : public SeekableReadStream {
 protected:
 	DisposablePtr<SeekableReadStream> _parentStream;
@@ -134,6 +338,9 @@ public:
 private:
 	enum Flags { kSplit = 1, kObfuscated = 2, kCompressed = 4, kInvalid = 8 };
 
+	// Compressed files larger than this are not decompressed into memory as a whole
+	static const uint32 kMaxBufferedSize = 1024 * 1024;
+
 	struct FileEntry {
 		uint32 uncompressedSize;
 		uint32 compressedSize;
@@ -168,6 +375,7 @@ private:
 
 	Path getHeaderName() const;
 	Path getVolumeName(uint volume) const;
+	SeekableReadStream *openVolume(uint volume) const;
 	SeekableReadStream *createReadStreamForMemberHelper(const Path &path) const;
 };
 
@@ -396,87 +604,87 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 	return stream;
 }
 
-SeekableReadStream *InstallShieldCabinet::createReadStreamForMemberHelper(const Path &path) const {
-	const FileEntry &entry = _map[path];
+SeekableReadStream *InstallShieldCabinet::openVolume(uint volume) const {
+	if (_archive)
+		return _archive->createReadStreamForMember(getVolumeName(volume));
 
-	ScopedPtr<SeekableReadStream> stream;
-	if (_archive) {
-		stream.reset(_archive->createReadStreamForMember(getVolumeName((entry.volume))));
-	} else {
-		stream.reset(new Common::File());
-		if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((entry.volume))))) {
-			stream.reset(nullptr);
-		}
+	Common::File *file = new Common::File();
+	if (!file->open(Common::FSNode(getVolumeName(volume)))) {
+		delete file;
+		return nullptr;
 	}
+	return file;
+}
+
+SeekableReadStream *InstallShieldCabinet::createReadStreamForMemberHelper(const Path &path) const {
+	const FileEntry &entry = _map[path];
 
+	SeekableReadStream *stream = openVolume(entry.volume);
 	if (!stream) {
 		warning("Failed to open volume for file '%s'", path.toString().c_str());
 		return nullptr;
 	}
 
-	byte *src = nullptr;
+	uint32 dataSize = (entry.flags & kCompressed) ? entry.compressedSize : entry.uncompressedSize;
+	ScopedPtr<SeekableReadStream> src;
+
 	if (entry.flags & kSplit) {
-		// File is split across volumes
-		src = (byte *)malloc(entry.compressedSize);
-		uint bytesRead = 0;
-		uint volume = entry.volume;
+		// File is split across volumes, read the parts in place
+		SplitFileReadStream *parts = new SplitFileReadStream();
+		src.reset(parts);
 
-		// Read the first part of the split file
-		stream->seek(entry.offset);
-		stream->read(src, _volumeHeaders[volume - 1].lastFileSizeCompressed);
-		bytesRead += _volumeHeaders[volume - 1].lastFileSizeCompressed;
+		uint volume = entry.volume;
+		uint32 partSize = _volumeHeaders[volume - 1].lastFileSizeCompressed;
+		parts->addPart(new SeekableSubReadStream(stream, entry.offset, entry.offset + partSize, DisposeAfterUse::YES));
+		uint32 bytesRead = partSize;
 
-		// Then, iterate through the next volumes until we've read all the data for the file
+		// Then, iterate through the next volumes until we've found all the data for the file
 		while (bytesRead < entry.compressedSize) {
-			if (_archive) {
-				stream.reset(_archive->createReadStreamForMember(getVolumeName((++volume))));
-			} else {
-				if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((++volume))))) {
-					stream.reset(nullptr);
-				}
-			}
-
-			if (!stream.get()) {
+			stream = (++volume <= _volumeHeaders.size()) ? openVolume(volume) : nullptr;
+			if (!stream) {
 				warning("Failed to read split file %s", path.toString().c_str());
-				free(src);
 				return nullptr;
 			}
-			stream->seek(_volumeHeaders[volume - 1].firstFileOffset);
-			stream->read(src + bytesRead, _volumeHeaders[volume - 1].firstFileSizeCompressed);
-			bytesRead += _volumeHeaders[volume - 1].firstFileSizeCompressed;
+
+			const VolumeHeader &header = _volumeHeaders[volume - 1];
+			parts->addPart(new SeekableSubReadStream(stream, header.firstFileOffset, header.firstFileOffset + header.firstFileSizeCompressed, DisposeAfterUse::YES));
+			bytesRead += header.firstFileSizeCompressed;
 		}
+	} else {
+		src.reset(new SeekableSubReadStream(stream, entry.offset, entry.offset + dataSize, DisposeAfterUse::YES));
 	}
 
 	// Uncompressed file
-	if (!(entry.flags & kCompressed)) {
-		if (src == nullptr) {
-			// File not split, return a substream
-			return new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + entry.uncompressedSize, DisposeAfterUse::YES);
-		} else {
-			// File split, return the assembled data
-			return new MemoryReadStream(src, entry.uncompressedSize, DisposeAfterUse::YES);
-		}
+	if (!(entry.flags & kCompressed))
+		return src.release();
+
+	// Large files are decompressed on demand
+	if (entry.uncompressedSize > kMaxBufferedSize && entry.compressedSize >= 4) {
+		src->seek(entry.compressedSize - 4);
+		bool hasSyncBytes = (src->readUint32BE() == 0xFFFF);
+		src->seek(0);
+
+		if (hasSyncBytes)
+			return wrapDeflateReadStream(src.release(), DisposeAfterUse::YES, entry.uncompressedSize);
+		return new InstallShieldChunkedReadStream(src.release(), entry.uncompressedSize);
 	}
 
 	byte *dst = (byte *)malloc(entry.uncompressedSize);
 
-	if (!src) {
-		src = (byte *)malloc(entry.compressedSize);
-		stream->seek(entry.offset);
-		stream->read(src, entry.compressedSize);
-	}
-
 	// Entries with size 0 are valid, and do not need to be inflated
 	if (entry.compressedSize != 0) {
-		if (!inflateZlibInstallShield(dst, entry.uncompressedSize, src, entry.compressedSize)) {
+		byte *compressed = (byte *)malloc(entry.compressedSize);
+		src->read(compressed, entry.compressedSize);
+
+		if (!inflateZlibInstallShield(dst, entry.uncompressedSize, compressed, entry.compressedSize)) {
 			warning("failed to inflate CAB file '%s'", path.toString().c_str());
 			free(dst);
-			free(src);
+			free(compressed);
 			return nullptr;
 		}
-	}
 
-	free(src);
+		free(compressed);
+	}
 
 	return new MemoryReadStream(dst, entry.uncompressedSize, DisposeAfterUse::YES);
 }
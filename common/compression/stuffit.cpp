@@ -80,7 +80,7 @@ private:
 		bool isInMacArchive() const override;
 	};
 
-	Common::SeekableReadStream *_stream;
+	Common::SharedPtr<Common::SeekableReadStream> _stream;
 
 	typedef Common::HashMap<Common::Path, FileEntry, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> FileMap;
 	FileMap _map;
@@ -90,6 +90,9 @@ private:
 
 	bool _flattenTree;
 
+	// Uncompressed forks larger than this are not copied into memory
+	static const uint32 kMaxBufferedSize = 64 * 1024;
+
 	// Decompression Functions
 	bool decompress13(Common::SeekableReadStream *src, byte *dst, uint32 uncompressedSize) const;
 	void decompress14(Common::SeekableReadStream *src, byte *dst, uint32 uncompressedSize) const;
@@ -102,7 +105,6 @@ private:
 };
 
 StuffItArchive::StuffItArchive() : Common::MemcachingCaseInsensitiveArchive(), _flattenTree(false) {
-	_stream = nullptr;
 }
 
 StuffItArchive::~StuffItArchive() {
@@ -125,7 +127,7 @@ bool StuffItArchive::open(const Common::Path &filename, bool flattenTree) {
 bool StuffItArchive::open(Common::SeekableReadStream *stream, bool flattenTree) {
 	close();
 
-	_stream = stream;
+	_stream.reset(stream);
 	_flattenTree = flattenTree;
 
 	if (!_stream)
@@ -275,8 +277,7 @@ bool StuffItArchive::open(Common::SeekableReadStream *stream, bool flattenTree)
 }
 
 void StuffItArchive::close() {
-	delete _stream;
-	_stream = nullptr;
+	_stream.reset();
 	_map.clear();
 }
 
@@ -335,7 +336,12 @@ Common::SharedArchiveContents StuffItArchive::readContentsForPathFork(const Comm
 	if (entryFork.compression & 0xF0)
 		error("Unhandled StuffIt encryption");
 
-	Common::SeekableSubReadStream subStream(_stream, entryFork.offset, entryFork.offset + entryFork.compressedSize);
+	// Large uncompressed forks are read in place. The stream keeps the
+	// archive stream alive, but its CRC is not checked.
+	if (entryFork.compression == 0 && entryFork.uncompressedSize > kMaxBufferedSize)
+		return Common::SharedArchiveContents::bypass(new Common::SafeSeekableSubReadStream(_stream, entryFork.offset, entryFork.offset + entryFork.uncompressedSize));
+
+	Common::SeekableSubReadStream subStream(_stream.get(), entryFork.offset, entryFork.offset + entryFork.compressedSize);
 
 	byte *uncompressedBlock = new byte[entryFork.uncompressedSize];
 
@@ -95,6 +95,8 @@ typedef Byte Bytef;
 #include "common/compression/deflate.h"
 #include "common/compression/unzip.h"
 #include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/substream.h"
 
 #include "common/hashmap.h"
 #include "common/hash-str.h"
@@ -325,6 +327,7 @@ typedef Common::HashMap<Common::Path, cached_file_in_zip, Common::Path::IgnoreCa
 */
 typedef struct {
 	Common::SeekableReadStream *_stream;				/* io structore of the zipfile */
+	Common::SharedPtr<Common::SeekableReadStream> _streamRef; /* owner of _stream, shared with streamed members */
 	unz_global_info gi;				/* public global information */
 	uLong byte_before_the_zipfile;	/* byte before the zipfile, (>0 for sfx)*/
 	uLong num_file;					/* number of the current file in the zipfile*/
@@ -591,6 +594,8 @@ unzFile unzOpen(Common::SeekableReadStream *stream, bool flattenTree) {
 		// Move to the next file
 		err = unzGoToNextFile((unzFile)us);
 	}
+
+	us->_streamRef = Common::SharedPtr<Common::SeekableReadStream>(stream);
 	return (unzFile)us;
 }
 
@@ -606,7 +611,7 @@ int unzClose(unzFile file) {
 		return UNZ_PARAMERROR;
 	s = (unz_s *)file;
 
-	delete s->_stream;
+	// The stream itself is freed once no streamed member uses it anymore
 	delete s;
 	return UNZ_OK;
 }
@@ -958,6 +963,13 @@ static int unzlocal_CheckCurrentFileCoherencyHeader(unz_s *s, uInt *piSizeVar,
 	return err;
 }
 
+/*
+  Members above these sizes are not loaded into memory as a whole but read
+  from the zipfile on demand. The CRC of such members is not checked.
+*/
+#define UNZ_STREAM_STORED_SIZE   (64 * 1024)
+#define UNZ_STREAM_DEFLATED_SIZE (1024 * 1024)
+
 /*
   Open for reading data the current file in the zipfile.
   If there is no error and the file is opened, the return value is UNZ_OK.
@@ -987,10 +999,26 @@ Common::SharedArchiveContents unzOpenCurrentFile (unzFile file
 		return Common::SharedArchiveContents();
 	}
 
+	uint32 dataOffset = s->cur_file_info_internal.offset_curfile + SIZEZIPLOCALHEADER + iSizeVar;
+
+	if (s->cur_file_info.compression_method == 0 && s->cur_file_info.uncompressed_size > UNZ_STREAM_STORED_SIZE) {
+		return Common::SharedArchiveContents::bypass(new Common::SafeSeekableSubReadStream(s->_streamRef,
+			dataOffset, dataOffset + s->cur_file_info.compressed_size));
+	}
+
+	if (s->cur_file_info.compression_method == Z_DEFLATED && s->cur_file_info.uncompressed_size > UNZ_STREAM_DEFLATED_SIZE) {
+		Common::SeekableReadStream *member = new Common::SafeSeekableSubReadStream(s->_streamRef,
+			dataOffset, dataOffset + s->cur_file_info.compressed_size);
+		Common::SeekableReadStream *stream = Common::wrapDeflateReadStream(member, DisposeAfterUse::YES, s->cur_file_info.uncompressed_size);
+		if (!stream)
+			return Common::SharedArchiveContents();
+		return Common::SharedArchiveContents::bypass(stream);
+	}
+
 	uint32 crc32_wait = s->cur_file_info.crc;
 
 	byte *compressedBuffer = new byte[s->cur_file_info.compressed_size];
-	s->_stream->seek(s->cur_file_info_internal.offset_curfile + SIZEZIPLOCALHEADER + iSizeVar);
+	s->_stream->seek(dataOffset);
 	s->_stream->read(compressedBuffer, s->cur_file_info.compressed_size);
 	byte *uncompressedBuffer = nullptr;
 
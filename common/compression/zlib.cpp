@@ -33,6 +33,7 @@
 
 #include "common/compression/deflate.h"
 
+#include "common/array.h"
 #include "common/ptr.h"
 #include "common/util.h"
 #include "common/stream.h"
@@ -89,6 +90,12 @@ bool inflateZlibHeaderless(byte *dst, uint *dstLen, const byte *src, uint srcLen
 static bool _shownBackwardSeekingWarning = false;
 #endif
 
+// inflateReset2() and inflatePrime(), needed to resume decompression at
+// a checkpoint, were added in zlib 1.2.3.4
+#if ZLIB_VERNUM >= 0x1234
+#define GZIP_CHECKPOINTS
+#endif
+
 /**
  * A simple wrapper class which can be used to wrap around an arbitrary
  * other SeekableReadStream and will then provide on-the-fly decompression support.
@@ -97,7 +104,20 @@ static bool _shownBackwardSeekingWarning = false;
 class GZipReadStream : public SeekableReadStream {
 protected:
 	enum {
-		BUFSIZE = 16384		// 1 << MAX_WBITS
+		BUFSIZE = 16384,		// 1 << MAX_WBITS
+		WINDOWSIZE = 32768,		// Maximum distance of a deflate back reference
+		CHECKPOINT_INTERVAL = 256 * 1024
+	};
+
+	/**
+	 * Decompressor state at a deflate block boundary, from which
+	 * decompression can resume without inflating the preceding data.
+	 */
+	struct Checkpoint {
+		uint32 out;				///< Uncompressed offset
+		int64 in;				///< Offset of the next compressed byte in the wrapped stream
+		int bits;				///< Number of unused bits in the byte before in
+		Array<byte> window;		///< Uncompressed data preceding out
 	};
 
 	byte	_buf[BUFSIZE];
@@ -105,14 +125,97 @@ protected:
 	DisposablePtr<SeekableReadStream> _wrapped;
 	z_stream _stream;
 	int _zlibErr;
+	int _windowBits;
 	uint64 _parentPos;
 	uint32 _pos;
 	uint32 _origSize;
 	bool _eos;
 
+	// The checkpoints are only recorded once the stream has been seeked
+	// backwards, streams which are read sequentially don't pay for them.
+	bool _indexing;
+	Array<Checkpoint> _checkpoints;
+	ScopedPtr<byte, ArrayDeleter<byte> > _window;	///< Ring buffer holding the last WINDOWSIZE bytes of output
+
+	void addToWindow(const byte *data, uint32 len, uint32 endPos) {
+		if (len > WINDOWSIZE) {
+			data += len - WINDOWSIZE;
+			len = WINDOWSIZE;
+		}
+
+		uint32 start = (endPos - len) % WINDOWSIZE;
+		uint32 first = MIN<uint32>(len, WINDOWSIZE - start);
+		memcpy(_window.get() + start, data, first);
+		memcpy(_window.get(), data + first, len - first);
+	}
+
+	void addCheckpoint(uint32 out) {
+		uint32 last = _checkpoints.empty() ? 0 : _checkpoints.back().out;
+		if (out < last + CHECKPOINT_INTERVAL)
+			return;
+
+		Checkpoint checkpoint;
+		checkpoint.out = out;
+		checkpoint.in = _wrapped->pos() - _stream.avail_in;
+		checkpoint.bits = _stream.data_type & 7;
+
+		uint32 len = MIN<uint32>(out, WINDOWSIZE);
+		uint32 start = (out - len) % WINDOWSIZE;
+		uint32 first = MIN<uint32>(len, WINDOWSIZE - start);
+		checkpoint.window.resize(len);
+		memcpy(checkpoint.window.data(), _window.get() + start, first);
+		memcpy(checkpoint.window.data() + first, _window.get(), len - first);
+
+		_checkpoints.push_back(checkpoint);
+	}
+
+	/** Return the last checkpoint at or before the given offset, if any. */
+	const Checkpoint *findCheckpoint(uint32 pos) const {
+		uint lo = 0, hi = _checkpoints.size();
+		while (lo < hi) {
+			uint mid = (lo + hi) / 2;
+			if (_checkpoints[mid].out <= pos)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo ? &_checkpoints[lo - 1] : nullptr;
+	}
+
+	bool restoreCheckpoint(const Checkpoint &checkpoint) {
+#ifdef GZIP_CHECKPOINTS
+		// The checkpoint is in the middle of the deflate data, past any header
+		_zlibErr = inflateReset2(&_stream, -MAX_WBITS);
+		if (_zlibErr != Z_OK)
+			return false;
+
+		_wrapped->seek(checkpoint.in - (checkpoint.bits ? 1 : 0), SEEK_SET);
+		if (checkpoint.bits) {
+			byte partial = _wrapped->readByte();
+			_zlibErr = inflatePrime(&_stream, checkpoint.bits, partial >> (8 - checkpoint.bits));
+			if (_zlibErr != Z_OK)
+				return false;
+		}
+
+		if (!checkpoint.window.empty()) {
+			_zlibErr = inflateSetDictionary(&_stream, const_cast<byte *>(checkpoint.window.data()), checkpoint.window.size());
+			if (_zlibErr != Z_OK)
+				return false;
+		}
+
+		_stream.next_in = _buf;
+		_stream.avail_in = 0;
+		_pos = checkpoint.out;
+		addToWindow(checkpoint.window.data(), checkpoint.window.size(), checkpoint.out);
+		return true;
+#else
+		return false;
+#endif
+	}
+
 public:
 
-	GZipReadStream(SeekableReadStream *w, DisposeAfterUse::Flag disposeParent, uint32 knownSize) : _wrapped(w, disposeParent), _stream() {
+	GZipReadStream(SeekableReadStream *w, DisposeAfterUse::Flag disposeParent, uint32 knownSize) : _wrapped(w, disposeParent), _stream(), _indexing(false) {
 		assert(w != nullptr);
 
 		_parentPos = w->pos();
@@ -139,7 +242,8 @@ public:
 		// the compressed file. This feature was added in zlib 1.2.0.4,
 		// released 10 August 2003.
 		// Note: This is *crucial* for savegame compatibility, do *not* remove!
-		_zlibErr = inflateInit2(&_stream, MAX_WBITS + 32);
+		_windowBits = MAX_WBITS + 32;
+		_zlibErr = inflateInit2(&_stream, _windowBits);
 		if (_zlibErr != Z_OK)
 			return;
 
@@ -148,7 +252,7 @@ public:
 		_stream.avail_in = 0;
 	}
 
-	GZipReadStream(SeekableReadStream *w, DisposeAfterUse::Flag disposeParent, uint32 knownSize, const byte *dict, uint dictLen) : _wrapped(w, disposeParent), _stream() {
+	GZipReadStream(SeekableReadStream *w, DisposeAfterUse::Flag disposeParent, uint32 knownSize, const byte *dict, uint dictLen) : _wrapped(w, disposeParent), _stream(), _indexing(false) {
 		assert(w != nullptr);
 
 		_parentPos = w->pos();
@@ -159,7 +263,8 @@ public:
 		_pos = 0;
 		_eos = false;
 
-		_zlibErr = inflateInit2(&_stream, -MAX_WBITS);
+		_windowBits = -MAX_WBITS;
+		_zlibErr = inflateInit2(&_stream, _windowBits);
 		if (_zlibErr != Z_OK)
 			return;
 
@@ -196,7 +301,22 @@ public:
 				_stream.next_in = _buf;
 				_stream.avail_in = _wrapped->read(_buf, BUFSIZE);
 			}
-			_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+
+			if (!_indexing) {
+				_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+				continue;
+			}
+
+			// Stop at every block boundary to see if a checkpoint is due
+			byte *start = _stream.next_out;
+			_zlibErr = inflate(&_stream, Z_BLOCK);
+
+			uint32 out = _pos + (_stream.next_out - (byte *)dataPtr);
+			addToWindow(start, _stream.next_out - start, out);
+
+			// Bit 7 is set at the end of a block, bit 6 after the last one
+			if (_zlibErr == Z_OK && (_stream.data_type & 128) && !(_stream.data_type & 64))
+				addCheckpoint(out);
 		}
 
 		// Update the position counter
@@ -236,7 +356,13 @@ public:
 
 		assert(newPos >= 0);
 
-		if ((uint32)newPos < _pos) {
+		// Resume from the closest checkpoint when seeking backwards, or
+		// when it saves inflating data when seeking forwards
+		const Checkpoint *checkpoint = findCheckpoint(newPos);
+		if (checkpoint && (checkpoint->out > _pos || (uint32)newPos < _pos)) {
+			if (!restoreCheckpoint(*checkpoint))
+				return false;
+		} else if ((uint32)newPos < _pos) {
 			// To search backward, we have to restart the whole decompression
 			// from the start of the file. A rather wasteful operation, best
 			// to avoid it. :/
@@ -253,11 +379,26 @@ public:
 
 			_pos = 0;
 			_wrapped->seek(_parentPos, SEEK_SET);
+#ifdef GZIP_CHECKPOINTS
+			// Restore the original header handling, in case a checkpoint
+			// switched the stream to raw deflate
+			_zlibErr = inflateReset2(&_stream, _windowBits);
+#else
 			_zlibErr = inflateReset(&_stream);
+#endif
 			if (_zlibErr != Z_OK)
 				return false; // FIXME: STREAM REWRITE
 			_stream.next_in = _buf;
 			_stream.avail_in = 0;
+
+#ifdef GZIP_CHECKPOINTS
+			// Record checkpoints from now on, so that the next backward
+			// seeks don't need to go through all the data again
+			if (!_indexing) {
+				_indexing = true;
+				_window.reset(new byte[WINDOWSIZE]);
+			}
+#endif
 		}
 
 		offset = newPos - _pos;
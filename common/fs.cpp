@@ -155,6 +155,7 @@ bool FSNode::getChildren(FSList &fslist, ListMode mode, bool hidden) const {
 		return false;
 
 	fslist.clear();
+	fslist.reserve(nodeList.size());
 	for (auto &node : nodeList) {
 		fslist.push_back(FSNode(node));
 	}
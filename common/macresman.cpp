@@ -38,6 +38,8 @@
 
 namespace Common {
 
+DECLARE_SINGLETON(MacResMapCache);
+
 MacFinderInfo::MacFinderInfo() : type(0), creator(0), flags(0), position(0, 0), windowID(0) {
 }
 
@@ -122,18 +124,15 @@ void MacResManager::close() {
 	_resForkOffset = -1;
 	_mode = kResForkNone;
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		for (int j = 0; j < _resTypes[i].items; j++)
-			if (_resLists[i][j].nameOffset != -1)
-				delete[] _resLists[i][j].name;
-
-		delete[] _resLists[i];
-	}
-
-	delete[] _resLists; _resLists = nullptr;
-	delete[] _resTypes; _resTypes = nullptr;
+	// Cached maps are only referenced with the cache locked
+	if (_map && MacResMapCache::hasInstance())
+		MacResMapCache::instance().release(_map);
+	_map.reset();
+	_archiveIdentity.clear();
+	_resLists = nullptr;
+	_resTypes = nullptr;
 	delete _stream; _stream = nullptr;
-	_resMap.numTypes = 0;
+	_resMap.reset();
 	_originalFileName.clear();
 }
 
@@ -243,6 +242,11 @@ bool MacResManager::open(const Path &fileName, Archive &archive) {
 
 	Common::ArchiveMemberPtr archiveMember = archive.getMember(fileName);
 
+	// Streams carry no file identity, so parsed maps are shared by archive
+	// and path. Neither archives nor streams expose modification times,
+	// the fork layout compared by readMap() stands in for them.
+	_archiveIdentity = String::format("%p:%s", (const void *)&archive, fileName.toString().c_str());
+
 	// If this is in a Mac archive, then the resource fork will always be in the alt stream
 	if (archiveMember && archiveMember->isInMacArchive()) {
 		_baseFileName = fileName;
@@ -915,18 +919,16 @@ bool MacResManager::load(SeekableReadStream *stream) {
 }
 
 MacResIDArray MacResManager::getResIDArray(uint32 typeID) {
-	int typeNum = -1;
 	MacResIDArray res;
 
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	if (!_map)
+		return res;
 
-	if (typeNum == -1)
+	HashMap<uint32, uint16>::const_iterator type = _map->typeIndex.find(typeID);
+	if (type == _map->typeIndex.end())
 		return res;
 
+	int typeNum = type->_value;
 	res.resize(_resTypes[typeNum].items);
 
 	for (int i = 0; i < _resTypes[typeNum].items; i++)
@@ -949,48 +951,51 @@ MacResTagArray MacResManager::getResTagArray() {
 	return tagArray;
 }
 
-String MacResManager::getResName(uint32 typeID, uint16 resID) const {
-	int typeNum = -1;
-
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+const MacResManager::Resource *MacResManager::findResource(uint32 typeID, uint16 resID) const {
+	if (!_map)
+		return nullptr;
 
-	if (typeNum == -1)
-		return "";
+	HashMap<uint32, uint16>::const_iterator type = _map->typeIndex.find(typeID);
+	if (type == _map->typeIndex.end())
+		return nullptr;
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID)
-			return _resLists[typeNum][i].name;
+	const HashMap<uint16, uint16> &ids = _map->idIndex[type->_value];
+	HashMap<uint16, uint16>::const_iterator res = ids.find(resID);
+	if (res == ids.end())
+		return nullptr;
 
-	return "";
+	return &_resLists[type->_value][res->_value];
 }
 
-SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
-	int typeNum = -1;
-	int resNum = -1;
+const MacResManager::Resource *MacResManager::findResource(uint32 typeID, const String &name) const {
+	if (!_map)
+		return nullptr;
 
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	HashMap<uint32, uint16>::const_iterator type = _map->typeIndex.find(typeID);
+	if (type == _map->typeIndex.end())
+		return nullptr;
 
-	if (typeNum == -1)
+	const ResourceMap::NameIndex &names = _map->nameIndex[type->_value];
+	ResourceMap::NameIndex::const_iterator res = names.find(name);
+	if (res == names.end())
 		return nullptr;
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID) {
-			resNum = i;
-			break;
-		}
+	return &_resLists[type->_value][res->_value];
+}
+
+const MacResManager::Resource *MacResManager::findResource(const String &name) const {
+	if (!_map)
+		return nullptr;
 
-	if (resNum == -1)
+	ResourceMap::NameIndex::const_iterator res = _map->allNameIndex.find(name);
+	if (res == _map->allNameIndex.end())
 		return nullptr;
 
-	_stream->seek(_dataOffset + _resLists[typeNum][resNum].dataOffset);
+	return &_resLists[res->_value >> 16][res->_value & 0xFFFF];
+}
+
+SeekableReadStream *MacResManager::readResource(const Resource &res) {
+	_stream->seek(_dataOffset + res.dataOffset);
 	uint32 len = _stream->readUint32BE();
 
 	// Ignore resources with 0 length
@@ -1000,153 +1005,273 @@ SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
 	return _stream->readStream(len);
 }
 
-SeekableReadStream *MacResManager::getResource(const String &fileName) {
-	for (uint32 i = 0; i < _resMap.numTypes; i++) {
-		for (uint32 j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1 && fileName.equalsIgnoreCase(_resLists[i][j].name)) {
-				_stream->seek(_dataOffset + _resLists[i][j].dataOffset);
-				uint32 len = _stream->readUint32BE();
+String MacResManager::getResName(uint32 typeID, uint16 resID) const {
+	const Resource *res = findResource(typeID, resID);
+	if (!res || !res->name)
+		return "";
 
-				// Ignore resources with 0 length
-				if (!len)
-					return nullptr;
+	return res->name;
+}
 
-				return _stream->readStream(len);
-			}
-		}
-	}
+SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
+	const Resource *res = findResource(typeID, resID);
+	if (!res)
+		return nullptr;
 
-	return nullptr;
+	return readResource(*res);
 }
 
-SeekableReadStream *MacResManager::getResource(uint32 typeID, const String &fileName) {
-	for (uint32 i = 0; i < _resMap.numTypes; i++) {
-		if (_resTypes[i].id != typeID)
-			continue;
-
-		for (uint32 j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1 && fileName.equalsIgnoreCase(_resLists[i][j].name)) {
-				_stream->seek(_dataOffset + _resLists[i][j].dataOffset);
-				uint32 len = _stream->readUint32BE();
+SeekableReadStream *MacResManager::getResource(const String &fileName) {
+	const Resource *res = findResource(fileName);
+	if (!res)
+		return nullptr;
 
-				// Ignore resources with 0 length
-				if (!len)
-					return nullptr;
+	return readResource(*res);
+}
 
-				return _stream->readStream(len);
-			}
-		}
-	}
+SeekableReadStream *MacResManager::getResource(uint32 typeID, const String &fileName) {
+	const Resource *res = findResource(typeID, fileName);
+	if (!res)
+		return nullptr;
 
-	return nullptr;
+	return readResource(*res);
 }
 
 uint32 MacResManager::getResLength(uint32 typeID, uint16 resID) {
-	int typeNum = -1;
-	int resNum = -1;
-
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
-
-	if (typeNum == -1)
+	const Resource *res = findResource(typeID, resID);
+	if (!res)
 		return 0;
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID) {
-			resNum = i;
-			break;
-		}
-
-	if (resNum == -1)
-		return 0;
-
-	_stream->seek(_dataOffset + _resLists[typeNum][resNum].dataOffset);
+	_stream->seek(_dataOffset + res->dataOffset);
 	uint32 len = _stream->readUint32BE();
 
 	return len;
 }
 
 uint16 MacResManager::getResID(uint32 typeID, const Common::String &fileName) {
-	for (uint32 i = 0; i < _resMap.numTypes; i++) {
-		if (_resTypes[i].id != typeID)
-			continue;
+	const Resource *res = findResource(typeID, fileName);
+	if (!res)
+		return 0;
 
-		for (uint32 j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1 && fileName.equalsIgnoreCase(_resLists[i][j].name)) {
-				return _resLists[i][j].id;
-			}
-		}
+	return res->id;
+}
+
+MacResManager::ResourceMap::~ResourceMap() {
+	if (!lists)
+		return;
+
+	for (int i = 0; i < header.numTypes; i++) {
+		for (int j = 0; j < types[i].items; j++)
+			delete[] lists[i][j].name;
+
+		delete[] lists[i];
 	}
 
-	return 0;
+	delete[] lists;
+	delete[] types;
 }
 
-void MacResManager::readMap() {
-	_stream->seek(_mapOffset + 22);
+void MacResManager::ResourceMap::parse(SeekableReadStream &stream, uint32 streamSize) {
+	stream.seek(22);
 
-	_resMap.resAttr = _stream->readUint16BE();
-	_resMap.typeOffset = _stream->readUint16BE();
-	_resMap.nameOffset = _stream->readUint16BE();
-	_resMap.numTypes = _stream->readUint16BE();
-	_resMap.numTypes++;
+	header.resAttr = stream.readUint16BE();
+	header.typeOffset = stream.readUint16BE();
+	header.nameOffset = stream.readUint16BE();
+	header.numTypes = stream.readUint16BE();
+	header.numTypes++;
 
-	_stream->seek(_mapOffset + _resMap.typeOffset + 2);
-	_resTypes = new ResType[_resMap.numTypes];
+	stream.seek(header.typeOffset + 2);
+	types = new ResType[header.numTypes];
 
-	debug(8, "numResTypes: %d total size: %u", _resMap.numTypes, unsigned(_stream->size()));
+	debug(8, "numResTypes: %d total size: %u", header.numTypes, streamSize);
 
-	if (_stream->pos() + _resMap.numTypes * 8 > _stream->size())
-		error("MacResManager::readMap(): incorrect resource map, too big, %d types", _resMap.numTypes);
+	if (stream.pos() + header.numTypes * 8 > stream.size())
+		error("MacResManager::readMap(): incorrect resource map, too big, %d types", header.numTypes);
 
 	int totalItems = 0;
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		_resTypes[i].id = _stream->readUint32BE();
-		_resTypes[i].items = _stream->readUint16BE();
-		_resTypes[i].offset = _stream->readUint16BE();
-		_resTypes[i].items++;
+	for (int i = 0; i < header.numTypes; i++) {
+		types[i].id = stream.readUint32BE();
+		types[i].items = stream.readUint16BE();
+		types[i].offset = stream.readUint16BE();
+		types[i].items++;
 
-		totalItems += _resTypes[i].items;
+		totalItems += types[i].items;
 
-		debug(8, "resType: <%s> items: %d offset: %d (0x%x)", tag2str(_resTypes[i].id), _resTypes[i].items,  _resTypes[i].offset, _resTypes[i].offset);
+		debug(8, "resType: <%s> items: %d offset: %d (0x%x)", tag2str(types[i].id), types[i].items, types[i].offset, types[i].offset);
 	}
 
-	if (totalItems * 4 > _stream->size())
+	if (totalItems * 4 > (int)streamSize)
 		error("MacResManager::readMap(): incorrect resource map, too big, %d total items", totalItems);
 
-	_resLists = new ResPtr[_resMap.numTypes];
+	lists = new ResPtr[header.numTypes];
+	idIndex.resize(header.numTypes);
+	nameIndex.resize(header.numTypes);
 
-	for (int i = 0; i < _resMap.numTypes; i++) {
-		_resLists[i] = new Resource[_resTypes[i].items];
-		_stream->seek(_resTypes[i].offset + _mapOffset + _resMap.typeOffset);
+	for (int i = 0; i < header.numTypes; i++) {
+		lists[i] = new Resource[types[i].items];
+		stream.seek(types[i].offset + header.typeOffset);
 
-		for (int j = 0; j < _resTypes[i].items; j++) {
-			ResPtr resPtr = _resLists[i] + j;
+		for (int j = 0; j < types[i].items; j++) {
+			ResPtr resPtr = lists[i] + j;
 
-			resPtr->id = _stream->readUint16BE();
-			resPtr->nameOffset = _stream->readUint16BE();
-			resPtr->dataOffset = _stream->readUint32BE();
-			_stream->readUint32BE();
+			resPtr->id = stream.readUint16BE();
+			resPtr->nameOffset = stream.readUint16BE();
+			resPtr->dataOffset = stream.readUint32BE();
+			stream.readUint32BE();
 			resPtr->name = nullptr;
 
 			resPtr->attr = resPtr->dataOffset >> 24;
 			resPtr->dataOffset &= 0xFFFFFF;
 		}
 
-		for (int j = 0; j < _resTypes[i].items; j++) {
-			if (_resLists[i][j].nameOffset != -1) {
-				_stream->seek(_resLists[i][j].nameOffset + _mapOffset + _resMap.nameOffset);
+		for (int j = 0; j < types[i].items; j++) {
+			if (lists[i][j].nameOffset != -1) {
+				stream.seek(lists[i][j].nameOffset + header.nameOffset);
 
-				byte len = _stream->readByte();
-				_resLists[i][j].name = new char[len + 1];
-				_resLists[i][j].name[len] = 0;
-				_stream->read(_resLists[i][j].name, len);
+				byte len = stream.readByte();
+				lists[i][j].name = new char[len + 1];
+				lists[i][j].name[len] = 0;
+				stream.read(lists[i][j].name, len);
 			}
 		}
+
+		// Duplicate types, ids and names are resolved to the first
+		// occurrence, as the lookups always did
+		if (!typeIndex.contains(types[i].id))
+			typeIndex[types[i].id] = i;
+
+		for (int j = 0; j < types[i].items; j++) {
+			if (!idIndex[i].contains(lists[i][j].id))
+				idIndex[i][lists[i][j].id] = j;
+
+			if (lists[i][j].nameOffset == -1)
+				continue;
+
+			String name(lists[i][j].name);
+			if (!nameIndex[i].contains(name))
+				nameIndex[i][name] = j;
+			if (!allNameIndex.contains(name))
+				allNameIndex[name] = (i << 16) | j;
+		}
+	}
+}
+
+String MacResManager::getMapKey() const {
+	if (_archiveIdentity.empty())
+		return String();
+
+	// The fork layout tells apart the companion files a fork may come from,
+	// and changes along with the file in nearly all cases
+	return String::format("%s:%d:%d:%u:%u:%u:%u:%u", _archiveIdentity.c_str(), (int)_mode,
+		_resForkOffset, _resForkSize, _dataOffset, _dataLength, _mapOffset, _mapLength);
+}
+
+bool MacResManager::isCachedMapValid(const ResourceMap &map, const Array<byte> &data) const {
+	// The key holds the archive address, which may be reused by a new archive
+	// after the old one was deleted. Comparing the map bytes tells them apart.
+	return map.dataLength == _dataLength && map.mapLength == _mapLength &&
+		map.checksum == CRC32().crcFast(data.data(), data.size());
+}
+
+void MacResManager::readMap() {
+	// The map usually sits at the end of the fork, read it in one go. Reading
+	// is cheap compared to parsing, so it is also done for cached maps.
+	uint32 mapEnd = _stream->size();
+	if (_resForkSize && _resForkOffset + _resForkSize < mapEnd)
+		mapEnd = _resForkOffset + _resForkSize;
+
+	Array<byte> data;
+	if (mapEnd > _mapOffset) {
+		data.resize(mapEnd - _mapOffset);
+		_stream->seek(_mapOffset);
+		data.resize(_stream->read(data.data(), data.size()));
 	}
+
+	String key = getMapKey();
+
+	if (!key.empty() && MacResMapCache::instance().find(key, _map)) {
+		if (isCachedMapValid(*_map, data)) {
+			debug(8, "MacResManager::readMap(): reusing parsed map");
+			_resMap = _map->header;
+			_resTypes = _map->types;
+			_resLists = _map->lists;
+			return;
+		}
+
+		MacResMapCache::instance().release(_map);
+		MacResMapCache::instance().remove(key);
+	}
+
+	_map.reset(new ResourceMap());
+	_map->dataLength = _dataLength;
+	_map->mapLength = _mapLength;
+	_map->checksum = CRC32().crcFast(data.data(), data.size());
+	MemoryReadStream stream(data.data(), data.size());
+	_map->parse(stream, data.size());
+
+	if (!key.empty())
+		MacResMapCache::instance().insert(key, _map);
+
+	_resMap = _map->header;
+	_resTypes = _map->types;
+	_resLists = _map->lists;
+}
+
+bool MacResMapCache::find(const String &key, SharedPtr<MacResManager::ResourceMap> &map) {
+	StackLock lock(_mutex);
+
+	MapCache::iterator it = _maps.find(key);
+	if (it == _maps.end())
+		return false;
+
+	_lru.remove(key);
+	_lru.push_front(key);
+	map = it->_value;
+	return true;
+}
+
+void MacResMapCache::insert(const String &key, const SharedPtr<MacResManager::ResourceMap> &map) {
+	StackLock lock(_mutex);
+
+	if (!_maps.contains(key) && _maps.size() >= kMaxMaps) {
+		// Prefer dropping the least recently used map which is not in use anymore
+		List<String>::iterator victim = _lru.reverse_begin();
+		for (List<String>::iterator it = _lru.reverse_begin(); it != _lru.end(); --it) {
+			if (_maps[*it].unique()) {
+				victim = it;
+				break;
+			}
+		}
+		_maps.erase(*victim);
+		_lru.erase(victim);
+	}
+
+	_lru.remove(key);
+	_lru.push_front(key);
+	_maps[key] = map;
+}
+
+void MacResMapCache::release(SharedPtr<MacResManager::ResourceMap> &map) {
+	StackLock lock(_mutex);
+	map.reset();
+}
+
+void MacResMapCache::remove(const String &key) {
+	StackLock lock(_mutex);
+	_maps.erase(key);
+	_lru.remove(key);
+}
+
+void MacResMapCache::clear() {
+	StackLock lock(_mutex);
+	_maps.clear();
+	_lru.clear();
+}
+
+uint MacResMapCache::size() {
+	StackLock lock(_mutex);
+	return _maps.size();
 }
 
 Path MacResManager::constructAppleDoubleName(const Path &name) {
@@ -26,7 +26,13 @@
 
 #include "common/array.h"
 #include "common/fs.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
 #include "common/rect.h"
+#include "common/singleton.h"
 #include "common/str.h"
 #include "common/str-array.h"
 
@@ -124,6 +130,7 @@ struct MacFinderExtendedInfo {
  * It can read from raw, MacBinary, and AppleDouble formats.
  */
 class MacResManager {
+	friend class MacResMapCache;
 
 #define MBI_INFOHDR 128
 
@@ -432,6 +439,45 @@ private:
 
 	typedef Resource *ResPtr;
 
+	/**
+	 * A parsed resource map along with indexes for fast lookups.
+	 *
+	 * Maps of forks opened through open() are shared with MacResMapCache,
+	 * so reopening a file neither reads nor parses its map again.
+	 */
+	struct ResourceMap {
+		typedef HashMap<String, uint32, IgnoreCase_Hash, IgnoreCase_EqualTo> NameIndex;
+
+		ResourceMap() : types(nullptr), lists(nullptr), dataLength(0), mapLength(0), checksum(0) {}
+		~ResourceMap();
+
+		ResMap header;
+		ResType *types;
+		ResPtr *lists;
+
+		HashMap<uint32, uint16> typeIndex;   //!< Type id to type number
+		Array<HashMap<uint16, uint16> > idIndex; //!< For each type, resource id to resource number
+		Array<NameIndex> nameIndex;          //!< For each type, resource name to resource number
+		NameIndex allNameIndex;              //!< Resource name to (type number << 16 | resource number)
+
+		uint32 dataLength; //!< Size of the resource data the map was read with
+		uint32 mapLength;  //!< Size of the map it was read from
+		uint32 checksum;   //!< CRC32 of the map bytes
+
+		void parse(SeekableReadStream &stream, uint32 streamSize);
+	};
+
+	String getMapKey() const;
+	bool isCachedMapValid(const ResourceMap &map, const Array<byte> &data) const;
+
+	const Resource *findResource(uint32 typeID, uint16 resID) const;
+	const Resource *findResource(uint32 typeID, const String &name) const;
+	const Resource *findResource(const String &name) const;
+	SeekableReadStream *readResource(const Resource &res);
+
+	SharedPtr<ResourceMap> _map;
+	String _archiveIdentity; //!< Archive and path the fork was opened from, empty if unknown
+
 	int32 _resForkOffset;
 	uint32 _resForkSize;
 
@@ -444,6 +490,39 @@ private:
 	ResPtr  *_resLists;
 };
 
+/**
+ * Parsed resource maps shared by all MacResManager instances.
+ *
+ * Games commonly open the same file many times, e.g. the executable whenever
+ * a resource is needed. Maps are keyed by the archive and path the fork was
+ * opened from along with the fork layout, so reopening a file skips reading
+ * and parsing its map. The cache is dropped when a game ends, as archives
+ * and their contents change between games.
+ */
+class MacResMapCache : public Singleton<MacResMapCache> {
+public:
+	/** Set @p map to the map cached under @p key, return false if there is none. */
+	bool find(const String &key, SharedPtr<MacResManager::ResourceMap> &map);
+	void insert(const String &key, const SharedPtr<MacResManager::ResourceMap> &map);
+	/** Drop a reference to a map, which may be shared with the cache. */
+	void release(SharedPtr<MacResManager::ResourceMap> &map);
+	void remove(const String &key);
+	void clear();
+
+	uint size();
+
+	static const uint kMaxMaps = 32;
+
+private:
+	friend class Singleton<SingletonBaseType>;
+	MacResMapCache() {}
+
+	typedef HashMap<String, SharedPtr<MacResManager::ResourceMap> > MapCache;
+	MapCache _maps;
+	List<String> _lru;  //!< Most recently used key first
+	Mutex _mutex;
+};
+
 /** @} */
 
 } // End of namespace Common
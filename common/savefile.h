@@ -22,6 +22,7 @@
 #ifndef COMMON_SAVEFILE_H
 #define COMMON_SAVEFILE_H
 
+#include "common/callback.h"
 #include "common/noncopyable.h"
 #include "common/scummsys.h"
 #include "common/stream.h"
@@ -120,6 +121,20 @@ public:
 	int64 size() const override;
 };
 
+/**
+ * Outcome of a save file written in the background.
+ *
+ * @see SaveFileManager::setAsyncSaving
+ */
+struct AsyncSaveResult {
+	String name;      /*!< Name of the save file. */
+	bool success;     /*!< Whether the file was completely written. */
+	uint32 size;      /*!< Size of the data written by the engine, before compression. */
+	uint32 writeTime; /*!< Time spent compressing and writing the data, in milliseconds. */
+};
+
+typedef BaseCallback<const AsyncSaveResult &> AsyncSaveCallback;
+
 /**
  * The SaveFileManager serves as a factory for InSaveFile
  * and OutSaveFile objects.
@@ -276,6 +291,75 @@ public:
 	 * @return true if the file exists. false otherwise.
 	 */
 	virtual bool exists(const String &name) = 0;
+
+	/**
+	 * Return a number which changes whenever save files are written, removed
+	 * or renamed through this manager, so that information read from them
+	 * can be cached.
+	 *
+	 * @return The current revision, or 0 if changes are not tracked.
+	 */
+	virtual uint32 getSavefilesRevision() { return 0; }
+
+	/**
+	 * Return a number which changes whenever the given save file is written
+	 * or removed through this manager, or whenever the save files may have
+	 * changed by other means, so that information read from it can be cached.
+	 *
+	 * @param name Name of the save file.
+	 *
+	 * @return The current revision of the file, or 0 if changes are not tracked.
+	 */
+	virtual uint32 getSavefileRevision(const String &name) { return 0; }
+
+	/**
+	 * Enable or disable writing save files in the background.
+	 *
+	 * While enabled, the OutSaveFile objects returned by openForSaving() only
+	 * collect the data in memory. Once they are finalized or deleted, the
+	 * compression and the actual writing are spread over the following calls
+	 * to pollAsyncSaves(), so the caller is not held up by them. Errors are
+	 * then only reported through the callback, and no longer by
+	 * OutSaveFile::err(). Writing to the file after finalizing it fails.
+	 *
+	 * Opening a save file which is still being written waits for it to be
+	 * complete, so callers do not need to care about pending saves.
+	 *
+	 * @param enable    Whether save files should be written in the background.
+	 * @param callback  Invoked once each file is written, from pollAsyncSaves()
+	 *                  or whatever waits for the file. The SaveFileManager
+	 *                  takes ownership of it.
+	 *
+	 * @return true if background saving is supported, false if save files
+	 *         are still written synchronously.
+	 */
+	virtual bool setAsyncSaving(bool enable, AsyncSaveCallback *callback = nullptr) { delete callback; return false; }
+
+	/**
+	 * Enable or disable storing the save files written in the background as deltas.
+	 *
+	 * This is meant for save files which are rewritten frequently with
+	 * mostly the same contents, such as autosaves. Instead of compressing
+	 * the whole file every time, a previous version is stored as it was
+	 * compressed, followed by the differences with it. Each file stays
+	 * self-contained, and loading it transparently returns its latest
+	 * contents. Uncompressed save files are always written as is.
+	 *
+	 * @return true if delta saving is supported.
+	 */
+	virtual bool setDeltaSaving(bool enable) { return false; }
+
+	/**
+	 * Compress and write the next part of the save files pending in the background.
+	 *
+	 * This is called regularly from the main thread while an engine polls events.
+	 */
+	virtual void pollAsyncSaves() {}
+
+	/**
+	 * Wait until all the save files being written in the background are complete.
+	 */
+	virtual void waitForAsyncSaves() {}
 };
 
 /** @} */
@@ -60,6 +60,13 @@ public:
 		  _eos(false) {
 		assert(parentStream);
 	}
+	SubReadStream(const SharedPtr<ReadStream> &parentStream, uint32 end)
+		: _parentStream(parentStream),
+		  _pos(0),
+		  _end(end),
+		  _eos(false) {
+		assert(parentStream);
+	}
 
 	bool eos() const override { return _eos || _parentStream->eos(); }
 	bool err() const override { return _parentStream->err(); }
@@ -81,6 +88,8 @@ protected:
 	uint32 _begin;
 public:
 	SeekableSubReadStream(SeekableReadStream *parentStream, uint32 begin, uint32 end, DisposeAfterUse::Flag disposeParentStream = DisposeAfterUse::NO);
+	/** Create a substream which keeps a shared parent stream alive. */
+	SeekableSubReadStream(const SharedPtr<SeekableReadStream> &parentStream, uint32 begin, uint32 end);
 
 	int64 pos() const override { return _pos - _begin; }
 	int64 size() const override { return _end - _begin; }
@@ -106,6 +115,9 @@ public:
 	SafeSeekableSubReadStream(SeekableReadStream *parentStream, uint32 begin, uint32 end, DisposeAfterUse::Flag disposeParentStream = DisposeAfterUse::NO)
 		: SeekableSubReadStream(parentStream, begin, end, disposeParentStream) {
 	}
+	SafeSeekableSubReadStream(const SharedPtr<SeekableReadStream> &parentStream, uint32 begin, uint32 end)
+		: SeekableSubReadStream(parentStream, begin, end) {
+	}
 
 	uint32 read(void *dataPtr, uint32 dataSize) override;
 };
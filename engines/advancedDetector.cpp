@@ -464,7 +464,7 @@ void AdvancedMetaEngineDetectionBase::composeFileHashMap(FileMap &allFiles, cons
 				continue;
 
 			Common::FSList files;
-			if (!file.getChildren(files, Common::FSNode::kListAll))
+			if (!ADCacheMan.getChildren(file, files))
 				continue;
 
 			composeFileHashMap(allFiles, files, depth - 1, tstr);
@@ -477,7 +477,9 @@ void AdvancedMetaEngineDetectionBase::composeFileHashMap(FileMap &allFiles, cons
 			tstr = (_flags & kADFlagMatchFullPaths) ? parentName.appendComponent(efname) : Common::Path(efname, Common::Path::kNoSeparator);
 		}
 
-		debugC(9, kDebugGlobalDetection, "$$ ['%s'] ['%s'] in '%s", tstr.toString().c_str(), efname.c_str(), firstPathComponents(fslist.front().getPath().toString(), '/').c_str());
+		// The arguments are costly to build and this runs for every file and every engine
+		if (debugChannelSet(9, kDebugGlobalDetection))
+			debugC(9, kDebugGlobalDetection, "$$ ['%s'] ['%s'] in '%s", tstr.toString().c_str(), efname.c_str(), firstPathComponents(fslist.front().getPath().toString(), '/').c_str());
 
 		allFiles[tstr] = file;		// Record the presence of this file
 		allFiles[Common::Path(efname, Common::Path::kNoSeparator)] = file;	// ...and its file name
@@ -720,6 +722,48 @@ void AdvancedMetaEngineDetectionBase::dumpDetectionEntries() const {
 	}
 }
 
+void AdvancedMetaEngineDetectionBase::checkDetectionEntries(const Common::FSNode &node, Common::StringArray &matches, Common::StringArray &mismatches) const {
+	const Common::String name = node.getName();
+	Common::HashMap<uint, FileProperties> filesProps;
+
+	for (const byte *descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
+		const ADGameDescription *g = (const ADGameDescription *)descPtr;
+
+		for (const ADGameFileDescription *fileDesc = g->filesDescriptions; fileDesc->fileName; fileDesc++) {
+			const Common::Path fname(fileDesc->fileName);
+			MD5Properties md5prop = gameFileToMD5Props(fileDesc, g->flags);
+			if (!fname.baseName().equalsIgnoreCase(name) || (md5prop & kMD5Archive))
+				continue;
+
+			if (!filesProps.contains(md5prop)) {
+				FileMap allFiles;
+				allFiles[fname] = node;
+
+				FileProperties tmp;
+				getFilePropertiesIntern(_md5Bytes, allFiles, md5prop, fname, tmp);
+				filesProps[md5prop] = tmp;
+			}
+
+			const FileProperties &props = filesProps[md5prop];
+			const char *md5_wo_prefix = fileDesc->md5;
+			if (md5_wo_prefix && strchr(md5_wo_prefix, ':'))
+				md5_wo_prefix = strchr(md5_wo_prefix, ':') + 1;
+
+			Common::String entry = Common::String::format("%s:%s (", getName(), g->gameId);
+			if (g->extra && *g->extra)
+				entry += Common::String(g->extra) + " ";
+			entry += Common::String::format("%s/%s)", getPlatformCode(g->platform), getLanguageCode(g->language));
+
+			Common::StringArray &results = (props.size != -1 && (md5_wo_prefix == nullptr || md5_wo_prefix == props.md5) &&
+				(fileDesc->fileSize == AD_NO_SIZE || fileDesc->fileSize == props.size)) ? matches : mismatches;
+
+			// Variants often only differ by other files
+			if (results.empty() || results.back() != entry)
+				results.push_back(entry);
+		}
+	}
+}
+
 ADDetectedGames AdvancedMetaEngineDetectionBase::detectGame(const Common::FSNode &parent, const FileMap &allFiles, Common::Language language, Common::Platform platform, const Common::String &extra, uint32 skipADFlags, bool skipIncomplete) {
 	CachedPropertiesMap filesProps;
 	ADDetectedGames matched;
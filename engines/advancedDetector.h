@@ -526,6 +526,8 @@ public:
 
 	void dumpDetectionEntries() const override;
 
+	void checkDetectionEntries(const Common::FSNode &node, Common::StringArray &matches, Common::StringArray &mismatches) const override;
+
 	/**
 	 * Sanitizes a string to be usable by gameId
 	 */
@@ -785,10 +787,58 @@ public:
 		return archiveHashMap.getValOrDefault(node.getPath(), nullptr);
 	}
 
-	AdvancedDetectorCacheManager() {
+	/**
+	 * List all the children of a directory, reusing the listing of
+	 * a previous call for the same directory.
+	 *
+	 * Every engine scans the same directories during a detection
+	 * pass, so this avoids reading them from disk once per engine.
+	 */
+	bool getChildren(const Common::FSNode &node, Common::FSList &list) {
+		Common::Path dirname = node.getPath();
+
+		DirectoryHashMap::const_iterator it = directoryHashMap.find(dirname);
+		if (it != directoryHashMap.end()) {
+			list = it->_value;
+			return true;
+		}
+
+		if (!node.getChildren(list, Common::FSNode::kListAll))
+			return false;
+
+		directoryHashMap.setVal(dirname, list);
+		return true;
+	}
+
+	/**
+	 * Remove the listing of a directory from the cache.
+	 */
+	void forgetDirectory(const Common::FSNode &node) {
+		directoryHashMap.erase(node.getPath());
+	}
+
+	/**
+	 * Keep the directory listings from one detection pass to the next.
+	 *
+	 * This is used when scanning a directory tree, where the listing of
+	 * each directory is first read by the engines detecting its parent.
+	 * The caller is responsible for forgetting the listings it has used.
+	 */
+	void keepDirectories(bool keep) {
+		_keepDirectories = keep;
+		if (!keep)
+			directoryHashMap.clear(true);
+	}
+
+	AdvancedDetectorCacheManager() : _keepDirectories(false) {
 		clear();
 	}
 
+	void clearDirectories() {
+		if (!_keepDirectories)
+			directoryHashMap.clear(true);
+	}
+
 	void clearArchives() {
 		for (auto &entry : archiveHashMap) {
 			delete entry._value;
@@ -800,6 +850,7 @@ public:
 		md5HashMap.clear(true);
 		sizeHashMap.clear(true);
 		clearArchives();
+		clearDirectories();
 	}
 
 private:
@@ -810,7 +861,10 @@ private:
 	typedef Common::HashMap<Common::Path, Common::Archive *, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> ArchiveHashMap;
 	FileHashMap md5HashMap;
 	SizeHashMap sizeHashMap;
+	typedef Common::HashMap<Common::Path, Common::FSList, Common::Path::Hash, Common::Path::EqualTo> DirectoryHashMap;
 	ArchiveHashMap archiveHashMap;
+	DirectoryHashMap directoryHashMap;
+	bool _keepDirectories;
 };
 
 /** Convenience shortcut for accessing the MD5CacheManager. */
@@ -218,6 +218,9 @@ Engine::Engine(OSystem *syst)
 Engine::~Engine() {
 	_mixer->stopAll();
 
+	// Autosaves being written may still report back to us
+	_saveFileMan->waitForAsyncSaves();
+
 	// Flush any pending remaining events
 	Common::Event evt;
 	while (g_system->getEventManager()->pollEvent(evt)) {}
@@ -625,6 +628,9 @@ void Engine::warnMissingExtractedCDAudio() {
 }
 
 void Engine::handleAutoSave() {
+	// Write the previous autosave while the game is idle
+	_saveFileMan->pollAsyncSaves();
+
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processAutosave())
 		return;
@@ -689,10 +695,23 @@ void Engine::saveAutosaveIfEnabled() {
 	if (saveFlag)
 		saveFlag = warnBeforeOverwritingAutosave();
 
-	if (saveFlag && saveGameState(autoSaveSlot, autoSaveName, true).getCode() != Common::kNoError) {
-		// Couldn't autosave at the designated time
-		g_system->displayMessageOnOSD(_("Error occurred making autosave"));
-		saveFlag = false;
+	if (saveFlag) {
+		// Only serialize the state here, the save files are compressed
+		// and written in the background to avoid stalling the game.
+		// Optionally, only the changes of frequent autosaves are compressed.
+		const uint32 start = _system->getMillis();
+		_saveFileMan->setAsyncSaving(true, new Common::Callback<Engine, const Common::AsyncSaveResult &>(this, &Engine::autosaveWritten));
+		_saveFileMan->setDeltaSaving(ConfMan.getBool("autosave_deltas"));
+		const Common::ErrorCode result = saveGameState(autoSaveSlot, autoSaveName, true).getCode();
+		_saveFileMan->setDeltaSaving(false);
+		_saveFileMan->setAsyncSaving(false);
+		debug(1, "Engine::saveAutosaveIfEnabled(): Serialized autosave in %u ms", _system->getMillis() - start);
+
+		if (result != Common::kNoError) {
+			// Couldn't autosave at the designated time
+			g_system->displayMessageOnOSD(_("Error occurred making autosave"));
+			saveFlag = false;
+		}
 	}
 
 	_lastAutosaveTime = _system->getMillis();
@@ -705,6 +724,13 @@ void Engine::saveAutosaveIfEnabled() {
 	_autoSaving = false;
 }
 
+void Engine::autosaveWritten(const Common::AsyncSaveResult &result) {
+	debug(1, "Engine::autosaveWritten(): Wrote '%s' (%u bytes) in %u ms%s", result.name.c_str(), result.size, result.writeTime, result.success ? "" : ", failed");
+
+	if (!result.success)
+		g_system->displayMessageOnOSD(_("Error occurred making autosave"));
+}
+
 void Engine::errorString(const char *buf1, char *buf2, int size) {
 	Common::strlcpy(buf2, buf1, size);
 }
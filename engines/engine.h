@@ -41,6 +41,7 @@ namespace Audio {
 class Mixer;
 }
 namespace Common {
+struct AsyncSaveResult;
 class Error;
 class FSDirectory;
 class EventManager;
@@ -630,6 +631,11 @@ private:
 	 */
 	bool warnBeforeOverwritingAutosave();
 
+	/**
+	 * Report an autosave once it has been written in the background.
+	 */
+	void autosaveWritten(const Common::AsyncSaveResult &result);
+
 public:
 
 	/**
@@ -26,6 +26,7 @@
 #include "backends/keymapper/keymap.h"
 #include "backends/keymapper/standard-actions.h"
 
+#include "common/list.h"
 #include "common/savefile.h"
 #include "common/system.h"
 #include "common/translation.h"
@@ -382,6 +383,165 @@ int MetaEngine::findEmptySaveSlot(const char *target) {
 	return -1;
 }
 
+namespace {
+
+/**
+ * Save states information read by the save/load dialogs. Reading it means
+ * opening and parsing every save file, which is slow for targets with many
+ * saves.
+ *
+ * The save lists are indexed by target, and dropped as soon as the save
+ * file manager reports any change. The descriptors are indexed by target
+ * and slot, along with their thumbnail scaled for the GUI, and each of them
+ * is dropped when its own save file changes.
+ *
+ * Everything is dropped when another engine uses the cache, or when a game ends.
+ */
+struct SaveMetaInfosCache {
+	struct Entry {
+		SaveStateDescriptor desc;
+		uint32 fileRevision;
+		float thumbnailScale;
+		Common::SharedPtr<Graphics::ManagedSurface> scaledThumbnail;
+	};
+
+	typedef Common::HashMap<Common::String, SaveStateList> ListMap;
+	typedef Common::HashMap<Common::String, Entry> EntryMap;
+
+	/** Limit the memory used by the cached thumbnails */
+	static const uint kMaxEntries = 512;
+
+	Common::String engineId; ///< Not the address, as plugins may be reloaded elsewhere
+	uint32 revision;
+	ListMap lists;
+	EntryMap entries;
+	/** Keys of the entries, most recently used first */
+	Common::List<Common::String> lru;
+
+	SaveMetaInfosCache() : revision(0) {}
+
+	void clear() {
+		lists.clear(true);
+		entries.clear(true);
+		lru.clear();
+	}
+
+	/**
+	 * Make sure the cache is valid for the given MetaEngine.
+	 *
+	 * @return false if nothing can be cached.
+	 */
+	bool validate(const MetaEngine *metaEngine) {
+		const uint32 currentRevision = g_system->getSavefileManager()->getSavefilesRevision();
+		if (engineId != metaEngine->getName()) {
+			clear();
+			engineId = metaEngine->getName();
+		}
+		if (revision != currentRevision) {
+			lists.clear(true);
+			revision = currentRevision;
+		}
+		return revision != 0;
+	}
+
+	/**
+	 * Look up the entry of a save file, and mark it as the most recently used.
+	 *
+	 * @return The entry, or nullptr if there is none for this revision of the file.
+	 */
+	Entry *find(const Common::String &key, uint32 fileRevision) {
+		EntryMap::iterator i = entries.find(key);
+		if (i == entries.end())
+			return nullptr;
+
+		lru.remove(key);
+		if (i->_value.fileRevision != fileRevision) {
+			entries.erase(i);
+			return nullptr;
+		}
+
+		lru.push_front(key);
+		return &i->_value;
+	}
+
+	Entry &insert(const Common::String &key, const SaveStateDescriptor &desc, uint32 fileRevision) {
+		while (entries.size() >= kMaxEntries && !lru.empty()) {
+			entries.erase(lru.back());
+			lru.pop_back();
+		}
+
+		Entry &entry = entries[key];
+		entry.desc = desc;
+		entry.fileRevision = fileRevision;
+		entry.thumbnailScale = 0.0f;
+		entry.scaledThumbnail.reset();
+		lru.push_front(key);
+		return entry;
+	}
+};
+
+SaveMetaInfosCache saveMetaInfosCache;
+
+Common::SharedPtr<Graphics::ManagedSurface> scaleThumbnail(const Graphics::Surface *thumbnail, float scaleFactor) {
+	Common::SharedPtr<Graphics::ManagedSurface> result(new Graphics::ManagedSurface());
+
+	if (scaleFactor != 1.0) {
+		Graphics::Surface *scaled = thumbnail->scale(thumbnail->w * scaleFactor, thumbnail->h * scaleFactor, false);
+		result->copyFrom(*scaled);
+		scaled->free();
+		delete scaled;
+	} else {
+		result->copyFrom(*thumbnail);
+	}
+
+	return result;
+}
+
+} // End of anonymous namespace
+
+void MetaEngine::clearSaveMetaInfosCache() {
+	saveMetaInfosCache.clear();
+	saveMetaInfosCache.engineId.clear();
+}
+
+SaveStateDescriptor MetaEngine::getCachedSaveMetaInfos(const char *target, int slot) const {
+	if (!saveMetaInfosCache.validate(this))
+		return querySaveMetaInfos(target, slot);
+
+	const uint32 fileRevision = g_system->getSavefileManager()->getSavefileRevision(getSavegameFile(slot, target));
+	if (!fileRevision)
+		return querySaveMetaInfos(target, slot);
+
+	const Common::String key = Common::String::format("%s:%d", target, slot);
+	SaveMetaInfosCache::Entry *entry = saveMetaInfosCache.find(key, fileRevision);
+	if (entry)
+		return entry->desc;
+
+	SaveStateDescriptor desc = querySaveMetaInfos(target, slot);
+	saveMetaInfosCache.insert(key, desc, fileRevision);
+	return desc;
+}
+
+Common::SharedPtr<Graphics::ManagedSurface> MetaEngine::getCachedSaveThumbnail(const char *target, int slot, float scaleFactor) const {
+	const SaveStateDescriptor desc = getCachedSaveMetaInfos(target, slot);
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (!thumbnail || thumbnail->format.isCLUT8())
+		return Common::SharedPtr<Graphics::ManagedSurface>();
+
+	// The entry was just looked up or inserted, unless the file cannot be cached
+	const Common::String key = Common::String::format("%s:%d", target, slot);
+	SaveMetaInfosCache::EntryMap::iterator i = saveMetaInfosCache.entries.find(key);
+	if (i == saveMetaInfosCache.entries.end() || i->_value.desc.getThumbnail() != thumbnail)
+		return scaleThumbnail(thumbnail, scaleFactor);
+
+	SaveMetaInfosCache::Entry &entry = i->_value;
+	if (!entry.scaledThumbnail || entry.thumbnailScale != scaleFactor) {
+		entry.scaledThumbnail = scaleThumbnail(thumbnail, scaleFactor);
+		entry.thumbnailScale = scaleFactor;
+	}
+	return entry.scaledThumbnail;
+}
+
 SaveStateList MetaEngine::listSaves(const char *target) const {
 	if (!hasFeature(kSavesUseExtendedFormat))
 		return SaveStateList();
@@ -402,7 +562,7 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 		int slotNum = atoi(slotStr);
 
 		if (slotNum >= 0 && slotNum <= getMaximumSaveSlot()) {
-			SaveStateDescriptor desc = querySaveMetaInfos(target, slotNum);
+			SaveStateDescriptor desc = getCachedSaveMetaInfos(target, slotNum);
 			if (desc.getSaveSlot() != -1) {
 				saveList.push_back(desc);
 			}
@@ -415,7 +575,19 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 }
 
 SaveStateList MetaEngine::listSaves(const char *target, bool saveMode) const {
-	SaveStateList saveList = listSaves(target);
+	SaveStateList saveList;
+	if (saveMetaInfosCache.validate(this)) {
+		SaveMetaInfosCache::ListMap::const_iterator i = saveMetaInfosCache.lists.find(target);
+		if (i != saveMetaInfosCache.lists.end()) {
+			saveList = i->_value;
+		} else {
+			saveList = listSaves(target);
+			saveMetaInfosCache.lists[target] = saveList;
+		}
+	} else {
+		saveList = listSaves(target);
+	}
+
 	int autosaveSlot = getAutosaveSlot();
 	if (!saveMode || autosaveSlot == -1)
 		return saveList;
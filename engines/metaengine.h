@@ -26,6 +26,7 @@
 #include "common/error.h"
 #include "common/array.h"
 #include "common/debug-channels.h"
+#include "common/ptr.h"
 
 #include "engines/achievements.h"
 #include "engines/game.h"
@@ -46,6 +47,7 @@ typedef SeekableReadStream InSaveFile;
 }
 
 namespace Graphics {
+class ManagedSurface;
 struct Surface;
 }
 
@@ -175,6 +177,15 @@ public:
 	/** Returns formatted data from game descriptor for dumping into a file */
 	virtual void dumpDetectionEntries() const = 0;
 
+	/**
+	 * Check a file against the detection entries describing a file with the same name.
+	 *
+	 * Each entry is described as "engine:gameid (extra platform/language)",
+	 * and added to @p matches if the MD5 and the size of the file match it,
+	 * or to @p mismatches otherwise.
+	 */
+	virtual void checkDetectionEntries(const Common::FSNode &node, Common::StringArray &matches, Common::StringArray &mismatches) const {}
+
 	/**
 	 * Return a list of engine specified debug channels
 	 *
@@ -306,7 +317,8 @@ public:
 	 * Return a list of all save states associated with the given target.
 	 *
 	 * This is a wrapper around the basic listSaves virtual method, but it has
-	 * some extra logic for autosave handling.
+	 * some extra logic for autosave handling. The list is cached as long as the
+	 * save files did not change.
 	 *
 	 * @param target    Name of a config manager target.
 	 * @param saveMode  If true, get the list for a save dialog.
@@ -364,6 +376,38 @@ public:
 	 */
 	virtual SaveStateDescriptor querySaveMetaInfos(const char *target, int slot) const;
 
+	/**
+	 * Return meta information from the specified save state.
+	 *
+	 * This is a wrapper around querySaveMetaInfos, which reuses the result
+	 * of previous queries as long as the save files did not change.
+	 *
+	 * @param target  Name of a config manager target.
+	 * @param slot    Slot number of the save state.
+	 */
+	SaveStateDescriptor getCachedSaveMetaInfos(const char *target, int slot) const;
+
+	/**
+	 * Return the thumbnail of the specified save state, scaled for the GUI.
+	 *
+	 * The scaled thumbnail is cached along the meta information returned
+	 * by getCachedSaveMetaInfos().
+	 *
+	 * @param target       Name of a config manager target.
+	 * @param slot         Slot number of the save state.
+	 * @param scaleFactor  Scale factor of the GUI.
+	 *
+	 * @return The scaled thumbnail, or a null pointer if there is none.
+	 */
+	Common::SharedPtr<Graphics::ManagedSurface> getCachedSaveThumbnail(const char *target, int slot, float scaleFactor) const;
+
+	/**
+	 * Drop the save states information cached by listSaves() and
+	 * getCachedSaveMetaInfos(), e.g. once a game ends or if the save files
+	 * were modified by other means than the save file manager.
+	 */
+	static void clearSaveMetaInfosCache();
+
 	/**
 	 * Return the name of the save file for the given slot and optional target,
 	 * or a pattern for matching filenames against.
@@ -117,6 +117,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("resource_types",		WRAP_METHOD(Console, cmdResourceTypes));
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("alloc_list",				WRAP_METHOD(Console, cmdAllocList));
+	registerCmd("resource_stats",		WRAP_METHOD(Console, cmdResourceStats));
+	registerCmd("resource_benchmark",	WRAP_METHOD(Console, cmdResourceBenchmark));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
 	registerCmd("integrity_dump",	WRAP_METHOD(Console, cmdResourceIntegrityDump));
@@ -150,6 +152,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
+	registerCmd("frameout_benchmark", WRAP_METHOD(Console, cmdFrameOutBenchmark));
+	registerCmd("cel_cache",          WRAP_METHOD(Console, cmdCelCache));
 	// Segments
 	registerCmd("segment_table",		WRAP_METHOD(Console, cmdPrintSegmentTable));
 	registerCmd("segtable",			WRAP_METHOD(Console, cmdPrintSegmentTable));	// alias
@@ -163,6 +167,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -238,6 +243,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
 	registerCmd("scrs",             WRAP_METHOD(Console, cmdScriptStrings));
 	registerCmd("script_said",      WRAP_METHOD(Console, cmdScriptSaid));
+	registerCmd("selector_cache",   WRAP_METHOD(Console, cmdSelectorCache));
 	registerCmd("vm_varlist",			WRAP_METHOD(Console, cmdVMVarlist));
 	registerCmd("vmvarlist",			WRAP_METHOD(Console, cmdVMVarlist));				// alias
 	registerCmd("vl",					WRAP_METHOD(Console, cmdVMVarlist));				// alias
@@ -357,6 +363,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" resource_types - Shows the valid resource types\n");
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" alloc_list - Lists all allocated resources\n");
+	debugPrintf(" resource_stats - Shows cache hits, misses and load times per resource type\n");
+	debugPrintf(" resource_benchmark - Loads and decompresses all resources, and shows the speed per resource type\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
 	debugPrintf(" integrity_dump - Dumps integrity data about resources in the current game to disk\n");
@@ -386,6 +394,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
+	debugPrintf(" frameout_benchmark - Redraws the screen items of the current frame, and shows the time per frame (SCI2+)\n");
+	debugPrintf(" cel_cache - Shows the hit rate of the cel cache (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Segments:\n");
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
@@ -398,6 +408,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows collection counts and pause times of the garbage collector\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -446,10 +457,11 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" bp_function / bpe - Sets a breakpoint on the execution of the specified exported function\n");
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
-	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" script_steps - Shows the number of executed SCI operations and decoded instructions\n");
 	debugPrintf(" script_objects / scro - Shows all objects inside a specified script\n");
 	debugPrintf(" script_strings / scrs - Shows all strings inside a specified script\n");
 	debugPrintf(" script_said - Shows all said - strings inside a specified script\n");
+	debugPrintf(" selector_cache - Shows the hit rate of the selector lookup cache\n");
 	debugPrintf(" vm_varlist / vmvarlist / vl - Shows the addresses of variables in the VM\n");
 	debugPrintf(" vm_vars / vmvars / vv - Displays or changes variables in the VM\n");
 	debugPrintf(" locals / l - Displays or changes local variables in the VM\n");
@@ -1134,6 +1146,64 @@ bool Console::cmdAllocList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows statistics of the resource cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		debugPrintf("Use 'reset' to reset the statistics\n");
+		return true;
+	}
+
+	ResourceManager *resMan = _engine->getResMan();
+	if (argc == 2) {
+		resMan->resetTypeStats();
+		return true;
+	}
+
+	debugPrintf("Cache: %d of %d KiB used, %d KiB locked\n",
+				resMan->getMemoryLRU() / 1024, resMan->getMaxMemoryLRU() / 1024, resMan->getMemoryLocked() / 1024);
+	for (int i = 0; i < kResourceTypeInvalid; ++i) {
+		const ResourceTypeStats &stats = resMan->getTypeStats((ResourceType)i);
+		if (stats.hits || stats.misses || stats.prefetches) {
+			debugPrintf("%s: %u hits, %u misses, %u prefetched, %u ms loading\n",
+						getResourceTypeName((ResourceType)i), stats.hits, stats.misses, stats.prefetches, stats.loadTime);
+		}
+	}
+
+	return true;
+}
+
+bool Console::cmdResourceBenchmark(int argc, const char **argv) {
+	if (argc != 1) {
+		debugPrintf("Loads and decompresses all resources which are not in memory,\n");
+		debugPrintf("and shows how long it took per resource type.\n");
+		debugPrintf("Usage: %s\n", argv[0]);
+		return true;
+	}
+
+	ResourceManager *resMan = _engine->getResMan();
+	uint32 totalCount = 0, totalSize = 0, totalTime = 0;
+
+	for (int i = 0; i < kResourceTypeInvalid; ++i) {
+		uint32 count, size;
+		uint32 time = resMan->benchmarkLoading((ResourceType)i, count, size);
+		if (!count)
+			continue;
+
+		debugPrintf("%s: %u resources, %u KiB in %u ms (%.1f MB/s)\n",
+					getResourceTypeName((ResourceType)i), count, size / 1024, time,
+					size / 1048576.0 * 1000.0 / MAX<uint32>(time, 1));
+		totalCount += count;
+		totalSize += size;
+		totalTime += time;
+	}
+
+	debugPrintf("Total: %u resources, %u KiB in %u ms (%.1f MB/s)\n",
+				totalCount, totalSize / 1024, totalTime,
+				totalSize / 1048576.0 * 1000.0 / MAX<uint32>(totalTime, 1));
+	return true;
+}
+
 bool Console::cmdDissectScript(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Examines a script\n");
@@ -2407,6 +2477,66 @@ bool Console::cmdShowSavedBits(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameOutBenchmark(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Redraws the whole screen, then draws its screen items again the given\n");
+		debugPrintf("number of times (default 100), and shows the time per frame.\n");
+		debugPrintf("Usage: %s [<frames>]\n", argv[0]);
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		const int frames = argc == 2 ? atoi(argv[1]) : 100;
+		if (frames <= 0) {
+			debugPrintf("Invalid number of frames\n");
+			return true;
+		}
+
+		_engine->_gfxFrameout->benchmarkDraw(this, frames);
+	} else {
+		debugPrintf("This SCI version does not have a list of planes\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
+bool Console::cmdCelCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows statistics of the cel cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		debugPrintf("Use 'reset' to reset the hit and miss counters\n");
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	CelCache *cache = CelObj::_cache;
+	if (!_engine->_gfxFrameout || !cache) {
+		debugPrintf("This SCI version does not have a cel cache\n");
+		return true;
+	}
+
+	if (argc == 2) {
+		cache->resetStats();
+		return true;
+	}
+
+	const uint32 hits = cache->getHits();
+	const uint32 lookups = hits + cache->getMisses();
+	const uint32 pixelHits = cache->getPixelHits();
+	const uint32 pixelLookups = pixelHits + cache->getPixelMisses();
+	debugPrintf("Cached cels: %u of %u\n", cache->size(), cache->getMaxSize());
+	debugPrintf("Decompressed pixels: %u of %u KiB\n", cache->getPixelSize() / 1024, cache->getMaxPixelSize() / 1024);
+	debugPrintf("Cel hits: %u of %u lookups (%u%%)\n", hits, lookups, lookups ? (uint32)((uint64)hits * 100 / lookups) : 0);
+	debugPrintf("Pixel hits: %u of %u draws (%u%%)\n", pixelHits, pixelLookups, pixelLookups ? (uint32)((uint64)pixelHits * 100 / pixelLookups) : 0);
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 
 bool Console::cmdParseGrammar(int argc, const char **argv) {
 	debugPrintf("Parse grammar, in strict GNF:\n");
@@ -2934,6 +3064,28 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows statistics of the garbage collector.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		debugPrintf("Use 'reset' to reset the statistics\n");
+		return true;
+	}
+
+	GCStatistics &stats = _engine->_gamestate->gcStats;
+	if (argc == 2) {
+		stats.reset();
+		return true;
+	}
+
+	debugPrintf("Collections: %u, skipped: %u\n", stats.collections, stats.skippedCollections);
+	debugPrintf("Freed entries: %u\n", stats.freedEntries);
+	debugPrintf("Pause time: total %u ms, average %u ms, max %u ms, last %u ms\n",
+				stats.totalPauseTime, stats.collections ? stats.totalPauseTime / stats.collections : 0,
+				stats.maxPauseTime, stats.lastPauseTime);
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
@@ -3432,7 +3584,26 @@ bool Console::cmdViewAccumulatorObject(int argc, const char **argv) {
 }
 
 bool Console::cmdScriptSteps(int argc, const char **argv) {
-	debugPrintf("Number of executed SCI operations: %d\n", _engine->_gamestate->scriptStepCounter);
+	EngineState *s = _engine->_gamestate;
+	debugPrintf("Number of executed SCI operations: %d\n", s->scriptStepCounter);
+
+	const uint32 playTime = _engine->getTotalPlayTime();
+	if (playTime)
+		debugPrintf("Operations per second of play time: %u\n", (uint32)((uint64)s->scriptStepCounter * 1000 / playTime));
+
+	uint32 instructions = 0, memory = 0, scripts = 0;
+	for (uint i = 0; i < s->_segMan->_heap.size(); i++) {
+		SegmentObj *obj = s->_segMan->_heap[i];
+		if (obj && obj->getType() == SEG_TYPE_SCRIPT) {
+			Script *scr = (Script *)obj;
+			if (scr->getDecodedInstructionCount()) {
+				instructions += scr->getDecodedInstructionCount();
+				memory += scr->getDecodedInstructionsMemory();
+				scripts++;
+			}
+		}
+	}
+	debugPrintf("Decoded instructions: %u in %u scripts, using %u KB\n", instructions, scripts, memory / 1024);
 	return true;
 }
 
@@ -3478,6 +3649,27 @@ bool Console::cmdScriptStrings(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdSelectorCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows statistics of the selector lookup cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		debugPrintf("Use 'reset' to reset the hit and miss counters\n");
+		return true;
+	}
+
+	SegManager *segMan = _engine->_gamestate->_segMan;
+	if (argc == 2) {
+		segMan->resetSelectorCacheStats();
+		return true;
+	}
+
+	const uint32 hits = segMan->getSelectorCacheHits();
+	const uint32 lookups = hits + segMan->getSelectorCacheMisses();
+	debugPrintf("Cached selector lookups: %u\n", segMan->getSelectorCacheSize());
+	debugPrintf("Hits: %u of %u lookups (%u%%)\n", hits, lookups, lookups ? (uint32)((uint64)hits * 100 / lookups) : 0);
+	return true;
+}
+
 bool Console::cmdScriptSaid(int argc, const char **argv) {
 	if (argc < 2) {
 		debugPrintf("Shows all said-strings inside a specified script.\n");
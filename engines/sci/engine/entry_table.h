@@ -0,0 +1,106 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCI_ENGINE_ENTRY_TABLE_H
+#define SCI_ENGINE_ENTRY_TABLE_H
+
+#include "common/array.h"
+#include "common/textconsole.h"
+
+namespace Sci {
+
+/**
+ * Table of heap allocated entries, which reuses the slots of freed entries.
+ * This is the storage of the clone, list, node, hunk, array and bitmap
+ * segments, see SegmentObjTable.
+ */
+template<typename T>
+struct EntryTable {
+	typedef T value_type;
+	struct Entry {
+		T *data;
+		int next_free; /* Only used for free entries */
+	};
+	enum { HEAPENTRY_INVALID = -1 };
+
+	int first_free = HEAPENTRY_INVALID; /**< Beginning of a singly linked list for entries */
+	int entries_used = 0; /**< Statistical information */
+	bool allocated_since_gc = false; /**< Whether an entry was allocated since the last garbage collection */
+
+	typedef Common::Array<Entry> ArrayType;
+	ArrayType _table;
+
+public:
+	virtual ~EntryTable() {
+		for (uint i = 0; i < _table.size(); i++) {
+			if (isValidEntry(i)) {
+				freeEntry(i);
+			}
+		}
+	}
+
+	int allocEntry() {
+		entries_used++;
+		allocated_since_gc = true;
+		if (first_free != HEAPENTRY_INVALID) {
+			int oldff = first_free;
+			first_free = _table[oldff].next_free;
+
+			_table[oldff].next_free = oldff;
+			assert(_table[oldff].data == nullptr);
+			_table[oldff].data = new T;
+			return oldff;
+		} else {
+			uint newIdx = _table.size();
+			_table.push_back(Entry());
+			_table.back().data = new T;
+			_table[newIdx].next_free = newIdx;	// Tag as 'valid'
+			return newIdx;
+		}
+	}
+
+	bool isValidEntry(int idx) const {
+		return idx >= 0 && (uint)idx < _table.size() && _table[idx].next_free == idx;
+	}
+
+	virtual void freeEntry(int idx) {
+		if (idx < 0 || (uint)idx >= _table.size())
+			::error("Table::freeEntry: Attempt to release invalid table index %d", idx);
+
+		_table[idx].next_free = first_free;
+		delete _table[idx].data;
+		_table[idx].data = nullptr;
+		first_free = idx;
+		entries_used--;
+	}
+
+	uint size() const { return _table.size(); }
+
+	T &at(uint index) { return *_table[index].data; }
+	const T &at(uint index) const { return *_table[index].data; }
+
+	T &operator[](uint index) { return at(index); }
+	const T &operator[](uint index) const { return at(index); }
+};
+
+} // End of namespace Sci
+
+#endif // SCI_ENGINE_ENTRY_TABLE_H
@@ -178,8 +178,28 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
-void run_gc(EngineState *s) {
+void run_gc(EngineState *s, bool skipIfIdle) {
 	SegManager *segMan = s->_segMan;
+	GCStatistics &stats = s->gcStats;
+	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
+
+	if (skipIfIdle && stats.skippedInRow < kGCMaxSkippedCollections) {
+		// Entries can only become garbage when a reference to them is
+		// dropped, which doesn't use up any memory. Without anything newly
+		// allocated, there's no need to collect yet. Scripts which are marked
+		// as deleted are still freed after a few skipped collections.
+		bool allocated = false;
+		for (uint seg = 1; seg < heap.size() && !allocated; seg++)
+			allocated = heap[seg] && heap[seg]->hasAllocatedSinceGC();
+
+		if (!allocated) {
+			stats.skippedCollections++;
+			stats.skippedInRow++;
+			return;
+		}
+	}
+
+	const uint32 startTime = g_system->getMillis();
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -190,12 +210,11 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
-	// Compute the set of all segments references currently in use.
+	// Compute the set of all segments references currently in use
 	AddrSet *activeRefs = findAllActiveReferences(s);
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
-	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
 	for (uint seg = 1; seg < heap.size(); seg++) {
 		SegmentObj *mobj = heap[seg];
 
@@ -208,11 +227,13 @@ void run_gc(EngineState *s) {
 			// Get a list of all deallocatable objects in this segment,
 			// then free any which are not referenced from somewhere.
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
+			mobj->clearAllocatedSinceGC();
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					stats.freedEntries++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -225,6 +246,12 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	stats.collections++;
+	stats.skippedInRow = 0;
+	stats.lastPauseTime = g_system->getMillis() - startTime;
+	stats.totalPauseTime += stats.lastPauseTime;
+	stats.maxPauseTime = MAX(stats.maxPauseTime, stats.lastPauseTime);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -49,10 +49,20 @@ typedef Common::HashMap<reg_t, bool, reg_t_Hash> AddrSet;
 AddrSet *findAllActiveReferences(EngineState *s);
 
 /**
- * Runs garbage collection on the current system state
- * @param s The state in which we should gc
+ * Runs garbage collection on the current system state.
+ *
+ * When skipIfIdle is set, the collection is skipped if no clone, list, node,
+ * hunk, array or bitmap was allocated since the previous one. Every
+ * kGCMaxSkippedCollections skipped collections in a row, it's done anyway.
+ *
+ * @param s          The state in which we should gc
+ * @param skipIfIdle Whether to skip the collection if nothing was allocated
  */
-void run_gc(EngineState *s);
+void run_gc(EngineState *s, bool skipIfIdle = false);
+
+enum {
+	kGCMaxSkippedCollections = 8
+};
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
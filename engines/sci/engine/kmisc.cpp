@@ -279,6 +279,8 @@ reg_t kMemorySegment(EngineState *s, int argc, reg_t *argv) {
 reg_t kFlushResources(EngineState *s, int argc, reg_t *argv) {
 	run_gc(s);
 	debugC(kDebugLevelRoom, "Entering room number %d", argv[0].toUint16());
+	// SCI32 passes an amount of memory instead of the room number
+	g_sci->getResMan()->prefetchRoom(s->currentRoomNumber());
 	return s->r_acc;
 }
 
@@ -0,0 +1,335 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCI_ENGINE_KPATHING_H
+#define SCI_ENGINE_KPATHING_H
+
+#include "common/array.h"
+#include "common/list.h"
+#include "common/rect.h"
+#include "common/util.h"
+
+namespace Sci {
+
+// SCI-defined polygon types
+enum {
+	POLY_TOTAL_ACCESS = 0,
+	POLY_NEAREST_ACCESS = 1,
+	POLY_BARRED_ACCESS = 2,
+	POLY_CONTAINED_ACCESS = 3
+};
+
+// Polygon containment types
+enum {
+	CONT_OUTSIDE = 0,
+	CONT_ON_EDGE = 1,
+	CONT_INSIDE = 2
+};
+
+#define HUGE_DISTANCE 0xFFFFFFFF
+
+// Entry of a visibility graph for a pair of vertices which wasn't checked yet
+#define VISIBILITY_UNKNOWN 2
+
+// Entry of PathfindingState::visibility for a pair of vertices which is also
+// unknown in the cached visibility graph, where the result is stored as well
+#define VISIBILITY_UNKNOWN_CACHED 3
+
+#define VERTEX_HAS_EDGES(V) ((V) != CLIST_NEXT(V))
+
+// Error codes
+enum {
+	PF_OK = 0,
+	PF_ERROR = -1,
+	PF_FATAL = -2
+};
+
+// Floating point struct
+struct FloatPoint {
+	FloatPoint() : x(0), y(0) {}
+	FloatPoint(float x_, float y_) : x(x_), y(y_) {}
+	FloatPoint(Common::Point p) : x(p.x), y(p.y) {}
+
+	Common::Point toPoint() {
+		return Common::Point((int16)(x + 0.5), (int16)(y + 0.5));
+	}
+
+	float operator*(const FloatPoint &p) const {
+		return x*p.x + y*p.y;
+	}
+	FloatPoint operator*(float l) const {
+		return FloatPoint(l*x, l*y);
+	}
+	FloatPoint operator-(const FloatPoint &p) const {
+		return FloatPoint(x-p.x, y-p.y);
+	}
+	float norm() const {
+		return x*x+y*y;
+	}
+
+	float x, y;
+};
+
+struct Vertex {
+	// Location
+	Common::Point v;
+
+	// Vertex circular list entry
+	Vertex *_next;	// next element
+	Vertex *_prev;	// previous element
+
+	// A* cost variables
+	uint32 costF;
+	uint32 costG;
+
+	// Previous vertex in shortest path
+	Vertex *path_prev;
+
+	// Order in which the vertex was added to the A* open set, 0 if it wasn't
+	uint32 openOrder;
+	bool closed;
+
+	// Position in the vertex index, and in the cached visibility graph of
+	// the polygon set (-1 for the merged start and end points)
+	int index;
+	int baseIndex;
+
+public:
+	Vertex(const Common::Point &p) : v(p) {
+		costG = HUGE_DISTANCE;
+		path_prev = nullptr;
+		openOrder = 0;
+		closed = false;
+		index = -1;
+		baseIndex = -1;
+	}
+};
+
+class VertexList: public Common::List<Vertex *> {
+public:
+	bool contains(Vertex *v) {
+		for (iterator it = begin(); it != end(); ++it) {
+			if (v == *it)
+				return true;
+		}
+		return false;
+	}
+};
+
+/* Circular list definitions. */
+
+#define CLIST_FOREACH(var, head)					\
+	for ((var) = (head)->first();					\
+		(var);							\
+		(var) = ((var)->_next == (head)->first() ?	\
+		    NULL : (var)->_next))
+
+/* Circular list access methods. */
+#define CLIST_NEXT(elm)		((elm)->_next)
+#define CLIST_PREV(elm)		((elm)->_prev)
+
+class CircularVertexList {
+public:
+	Vertex *_head;
+
+public:
+	CircularVertexList() : _head(nullptr) {}
+
+	Vertex *first() const {
+		return _head;
+	}
+
+	void insertAtEnd(Vertex *elm) {
+		if (_head == nullptr) {
+			elm->_next = elm->_prev = elm;
+			_head = elm;
+		} else {
+			elm->_next = _head;
+			elm->_prev = _head->_prev;
+			_head->_prev = elm;
+			elm->_prev->_next = elm;
+		}
+	}
+
+	void insertHead(Vertex *elm) {
+		insertAtEnd(elm);
+		_head = elm;
+	}
+
+	static void insertAfter(Vertex *listelm, Vertex *elm) {
+		elm->_prev = listelm;
+		elm->_next = listelm->_next;
+		listelm->_next->_prev = elm;
+		listelm->_next = elm;
+	}
+
+	void remove(Vertex *elm) {
+		if (elm->_next == elm) {
+			_head = nullptr;
+		} else {
+			if (_head == elm)
+				_head = elm->_next;
+			elm->_prev->_next = elm->_next;
+			elm->_next->_prev = elm->_prev;
+		}
+	}
+
+	bool empty() const {
+		return _head == nullptr;
+	}
+
+	uint size() const {
+		int n = 0;
+		Vertex *v;
+		CLIST_FOREACH(v, this)
+			++n;
+		return n;
+	}
+
+	/**
+	 * Reverse the order of the elements in this circular list.
+	 */
+	void reverse() {
+		if (!_head)
+			return;
+
+		Vertex *elm = _head;
+		do {
+			SWAP(elm->_prev, elm->_next);
+			elm = elm->_next;
+		} while (elm != _head);
+	}
+};
+
+struct Polygon {
+	// SCI polygon type
+	int type;
+
+	// Circular list of vertices
+	CircularVertexList vertices;
+
+public:
+	Polygon(int t) : type(t) {
+	}
+
+	~Polygon() {
+		while (!vertices.empty()) {
+			Vertex *vertex = vertices.first();
+			vertices.remove(vertex);
+			delete vertex;
+		}
+	}
+};
+
+typedef Common::List<Polygon *> PolygonList;
+
+// Pathfinding state
+struct PathfindingState {
+	// List of all polygons
+	PolygonList polygons;
+
+	// Start and end points for pathfinding
+	Vertex *vertex_start, *vertex_end;
+
+	// Array of all vertices, used for sorting
+	Vertex **vertex_index;
+
+	// Total number of vertices
+	int vertices;
+
+	// Cached visibility graph of the polygon set before the start and end
+	// points were merged, indexed by Vertex::baseIndex
+	byte *baseVisibility;
+	int baseVertices;
+
+	// Visibility graph of all vertices, indexed by Vertex::index. Pairs
+	// missing from the cached graph are only checked when needed.
+	Common::Array<byte> visibility;
+
+	// Point to prepend and append to final path
+	Common::Point *_prependPoint;
+	Common::Point *_appendPoint;
+
+	// Screen size
+	int _width, _height;
+
+	PathfindingState(int width, int height) : _width(width), _height(height) {
+		vertex_start = nullptr;
+		vertex_end = nullptr;
+		vertex_index = nullptr;
+		_prependPoint = nullptr;
+		_appendPoint = nullptr;
+		vertices = 0;
+		baseVisibility = nullptr;
+		baseVertices = 0;
+	}
+
+	~PathfindingState() {
+		free(vertex_index);
+
+		delete _prependPoint;
+		delete _appendPoint;
+
+		for (PolygonList::iterator it = polygons.begin(); it != polygons.end(); ++it) {
+			delete *it;
+		}
+	}
+
+	bool pointOnScreenBorder(const Common::Point &p);
+	bool edgeOnScreenBorder(const Common::Point &p, const Common::Point &q);
+	int findNearPoint(const Common::Point &p, Polygon *polygon, Common::Point *ret);
+};
+
+/**
+ * Visibility graph of a polygon set, see kAvoidPath().
+ */
+struct PathfindingCacheEntry {
+	Common::Array<int16> polygons;  //< Vertex count and vertex coordinates of each polygon
+	uint32 hash;                    //< Hash of the polygons
+	uint32 lastUse;                 //< Value of PathfindingCache::queries when last used
+	Common::Array<byte> visibility; //< For each pair of vertices, whether they can see each other, or VISIBILITY_UNKNOWN
+};
+
+/**
+ * Visibility graphs of the polygon sets last used for pathfinding. The graphs
+ * only depend on the polygon coordinates, so they stay valid when the game is
+ * restarted or restored.
+ */
+struct PathfindingCache {
+	Common::Array<PathfindingCacheEntry> entries;
+	uint32 queries; //< Number of lookups
+	uint32 hits;    //< Number of lookups which found the polygon set
+
+	PathfindingCache() : queries(0), hits(0) {}
+};
+
+// Implemented in kpathing_search.cpp, see there for their description
+bool collinear(const Common::Point &a, const Common::Point &b, const Common::Point &c);
+int contained(const Common::Point &p, Polygon *polygon);
+void fix_vertex_order(Polygon *polygon);
+int intersection(const Common::Point &a, const Common::Point &b, const Vertex *vertex, FloatPoint *ret);
+VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur);
+PathfindingState *prepare_polygon_set(PathfindingCache &cache, PathfindingState *pf_s, int count, Common::Point start, Common::Point end, int opt, bool lsl5Room660, bool lb2Room530);
+void AStar(PathfindingState *s, bool borderPenalty);
+
+} // End of namespace Sci
+
+#endif // SCI_ENGINE_KPATHING_H
@@ -0,0 +1,1082 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "sci/sci.h"
+#include "sci/engine/kpathing.h"
+
+#include "common/debug.h"
+#include "common/textconsole.h"
+
+namespace Sci {
+
+// Number of polygon sets with a cached visibility graph
+#define PATHFINDING_CACHE_SIZE 8
+
+/**
+ * Computes the area of a triangle
+ * Parameters: (const Common::Point &) a, b, c: The points of the triangle
+ * Returns   : (int) The area multiplied by two
+ */
+static int area(const Common::Point &a, const Common::Point &b, const Common::Point &c) {
+	return (b.x - a.x) * (a.y - c.y) - (c.x - a.x) * (a.y - b.y);
+}
+
+/**
+ * Determines whether or not a point is to the left of a directed line
+ * Parameters: (const Common::Point &) a, b: The directed line (a, b)
+ *             (const Common::Point &) c: The query point
+ * Returns   : (int) true if c is to the left of (a, b), false otherwise
+ */
+static bool left(const Common::Point &a, const Common::Point &b, const Common::Point &c) {
+	return area(a, b, c) > 0;
+}
+
+/**
+ * Determines whether or not three points are collinear
+ * Parameters: (const Common::Point &) a, b, c: The three points
+ * Returns   : (int) true if a, b, and c are collinear, false otherwise
+ */
+bool collinear(const Common::Point &a, const Common::Point &b, const Common::Point &c) {
+	return area(a, b, c) == 0;
+}
+
+/**
+ * Determines whether or not a point lies on a line segment
+ * Parameters: (const Common::Point &) a, b: The line segment (a, b)
+ *             (const Common::Point &) c: The query point
+ * Returns   : (int) true if c lies on (a, b), false otherwise
+ */
+static bool between(const Common::Point &a, const Common::Point &b, const Common::Point &c) {
+	if (!collinear(a, b, c))
+		return false;
+
+	// Assumes a != b.
+	if (a.x != b.x)
+		return ((a.x <= c.x) && (c.x <= b.x)) || ((a.x >= c.x) && (c.x >= b.x));
+	else
+		return ((a.y <= c.y) && (c.y <= b.y)) || ((a.y >= c.y) && (c.y >= b.y));
+}
+
+/**
+ * Determines whether or not two line segments properly intersect
+ * Parameters: (const Common::Point &) a, b: The line segment (a, b)
+ *             (const Common::Point &) c, d: The line segment (c, d)
+ * Returns   : (int) true if (a, b) properly intersects (c, d), false otherwise
+ */
+static bool intersect_proper(const Common::Point &a, const Common::Point &b, const Common::Point &c, const Common::Point &d) {
+	int ab = (left(a, b, c) && left(b, a, d)) || (left(a, b, d) && left(b, a, c));
+	int cd = (left(c, d, a) && left(d, c, b)) || (left(c, d, b) && left(d, c, a));
+
+	return ab && cd;
+}
+
+/**
+ * Polygon containment test
+ * Parameters: (const Common::Point &) p: The point
+ *             (Polygon *) polygon: The polygon
+ * Returns   : (int) CONT_INSIDE if p is strictly contained in polygon,
+ *                   CONT_ON_EDGE if p lies on an edge of polygon,
+ *                   CONT_OUTSIDE otherwise
+ * Number of ray crossing left and right
+ */
+int contained(const Common::Point &p, Polygon *polygon) {
+	int lcross = 0, rcross = 0;
+	Vertex *vertex;
+
+	// Iterate over edges
+	CLIST_FOREACH(vertex, &polygon->vertices) {
+		const Common::Point &v1 = vertex->v;
+		const Common::Point &v2 = CLIST_NEXT(vertex)->v;
+
+		// Flags for ray straddling left and right
+		int rstrad, lstrad;
+
+		// Check if p is a vertex
+		if (p == v1)
+			return CONT_ON_EDGE;
+
+		// Check if edge straddles the ray
+		rstrad = (v1.y < p.y) != (v2.y < p.y);
+		lstrad = (v1.y > p.y) != (v2.y > p.y);
+
+		if (lstrad || rstrad) {
+			// Compute intersection point x / xq
+			int x = v2.x * v1.y - v1.x * v2.y + (v1.x - v2.x) * p.y;
+			int xq = v1.y - v2.y;
+
+			// Multiply by -1 if xq is negative (for comparison that follows)
+			if (xq < 0) {
+				x = -x;
+				xq = -xq;
+			}
+
+			// Avoid floats by multiplying instead of dividing
+			if (rstrad && (x > xq * p.x))
+				rcross++;
+			else if (lstrad && (x < xq * p.x))
+				lcross++;
+		}
+	}
+
+	// If we counted an odd number of total crossings the point is on an edge
+	if ((lcross + rcross) % 2 == 1)
+		return CONT_ON_EDGE;
+
+	// If there are an odd number of crossings to one side the point is contained in the polygon
+	if (rcross % 2 == 1) {
+		// Invert result for contained access polygons.
+		if (polygon->type == POLY_CONTAINED_ACCESS)
+			return CONT_OUTSIDE;
+		return CONT_INSIDE;
+	}
+
+	// Point is outside polygon. Invert result for contained access polygons
+	if (polygon->type == POLY_CONTAINED_ACCESS)
+		return CONT_INSIDE;
+
+	return CONT_OUTSIDE;
+}
+
+/**
+ * Computes polygon area
+ * Parameters: (Polygon *) polygon: The polygon
+ * Returns   : (int) The area multiplied by two
+ */
+static int polygon_area(Polygon *polygon) {
+	Vertex *first = polygon->vertices.first();
+	Vertex *v;
+	int size = 0;
+
+	v = CLIST_NEXT(first);
+
+	while (CLIST_NEXT(v) != first) {
+		size += area(first->v, v->v, CLIST_NEXT(v)->v);
+		v = CLIST_NEXT(v);
+	}
+
+	return size;
+}
+
+/**
+ * Fixes the vertex order of a polygon if incorrect. Contained access
+ * polygons should have their vertices ordered clockwise, all other types
+ * anti-clockwise
+ * Parameters: (Polygon *) polygon: The polygon
+ */
+void fix_vertex_order(Polygon *polygon) {
+	int area = polygon_area(polygon);
+
+	// When the polygon area is positive the vertices are ordered
+	// anti-clockwise. When the area is negative the vertices are ordered
+	// clockwise
+	if (((area > 0) && (polygon->type == POLY_CONTAINED_ACCESS))
+	        || ((area < 0) && (polygon->type != POLY_CONTAINED_ACCESS))) {
+
+		polygon->vertices.reverse();
+	}
+}
+
+/**
+ * Determines whether or not a line from a point to a vertex intersects the
+ * interior of the polygon, locally at that vertex
+ * Parameters: (Common::Point) p: The point
+ *             (Vertex *) vertex: The vertex
+ * Returns   : (int) 1 if the line (p, vertex->v) intersects the interior of
+ *                   the polygon, locally at the vertex. 0 otherwise
+ */
+static int inside(const Common::Point &p, Vertex *vertex) {
+	// Check that it's not a single-vertex polygon
+	if (VERTEX_HAS_EDGES(vertex)) {
+		const Common::Point &prev = CLIST_PREV(vertex)->v;
+		const Common::Point &next = CLIST_NEXT(vertex)->v;
+		const Common::Point &cur = vertex->v;
+
+		if (left(prev, cur, next)) {
+			// Convex vertex, line (p, cur) intersects the inside
+			// if p is located left of both edges
+			if (left(cur, next, p) && left(prev, cur, p))
+				return 1;
+		} else {
+			// Non-convex vertex, line (p, cur) intersects the
+			// inside if p is located left of either edge
+			if (left(cur, next, p) || left(prev, cur, p))
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Determines whether two vertices can see each other, i.e. whether the line
+ * between them doesn't intersect any polygon. This is symmetric.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the first vertex
+ * @param vertex		the second vertex
+ * @return true if vertex is visible from vertex_cur, false otherwise
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Returns a list of all vertices that are visible from a particular vertex.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex
+ * @return list of vertices that are visible from vert
+ */
+VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
+	VertexList *visVerts = new VertexList();
+
+	for (int i = 0; i < s->vertices; i++) {
+		Vertex *vertex = s->vertex_index[i];
+
+		if (is_visible(s, vertex_cur, vertex))
+			visVerts->push_front(vertex);
+	}
+
+	return visVerts;
+}
+
+/**
+ * Determines if a point lies on the screen border
+ * Parameters: (const Common::Point &) p: The point
+ * Returns   : (int) true if p lies on the screen border, false otherwise
+ */
+bool PathfindingState::pointOnScreenBorder(const Common::Point &p) {
+	return (p.x == 0) || (p.x == _width - 1) || (p.y == 0) || (p.y == _height - 1);
+}
+
+/**
+ * Determines if an edge lies on the screen border
+ * Parameters: (const Common::Point &) p, q: The edge (p, q)
+ * Returns   : (int) true if (p, q) lies on the screen border, false otherwise
+ */
+bool PathfindingState::edgeOnScreenBorder(const Common::Point &p, const Common::Point &q) {
+	return ((p.x == 0 && q.x == 0) || (p.y == 0 && q.y == 0)
+			|| ((p.x == _width - 1) && (q.x == _width - 1))
+			|| ((p.y == _height - 1) && (q.y == _height - 1)));
+}
+
+/**
+ * Searches for a nearby point that is not contained in a polygon
+ * Parameters: (FloatPoint) f: The pointf to search nearby
+ *             (Polygon *) polygon: The polygon
+ * Returns   : (int) PF_OK on success, PF_FATAL otherwise
+ *             (Common::Point) *ret: The non-contained point on success
+ */
+static int find_free_point(FloatPoint f, Polygon *polygon, Common::Point *ret) {
+	Common::Point p;
+
+	// Try nearest point first
+	p = Common::Point((int)floor(f.x + 0.5), (int)floor(f.y + 0.5));
+
+	if (contained(p, polygon) != CONT_INSIDE) {
+		*ret = p;
+		return PF_OK;
+	}
+
+	p = Common::Point((int)floor(f.x), (int)floor(f.y));
+
+	// Try (x, y), (x + 1, y), (x , y + 1) and (x + 1, y + 1)
+	if (contained(p, polygon) == CONT_INSIDE) {
+		p.x++;
+		if (contained(p, polygon) == CONT_INSIDE) {
+			p.y++;
+			if (contained(p, polygon) == CONT_INSIDE) {
+				p.x--;
+				if (contained(p, polygon) == CONT_INSIDE)
+					return PF_FATAL;
+			}
+		}
+	}
+
+	*ret = p;
+	return PF_OK;
+}
+
+/**
+ * Computes the near point of a point contained in a polygon
+ * Parameters: (const Common::Point &) p: The point
+ *             (Polygon *) polygon: The polygon
+ * Returns   : (int) PF_OK on success, PF_FATAL otherwise
+ *             (Common::Point) *ret: The near point of p in polygon on success
+ */
+int PathfindingState::findNearPoint(const Common::Point &p, Polygon *polygon, Common::Point *ret) {
+	Vertex *vertex;
+	FloatPoint near_p;
+	uint32 dist = HUGE_DISTANCE;
+
+	CLIST_FOREACH(vertex, &polygon->vertices) {
+		const Common::Point &p1 = vertex->v;
+		const Common::Point &p2 = CLIST_NEXT(vertex)->v;
+		float u;
+		FloatPoint new_point;
+		uint32 new_dist;
+
+		// Ignore edges on the screen border, except for contained access polygons
+		if ((polygon->type != POLY_CONTAINED_ACCESS) && (edgeOnScreenBorder(p1, p2)))
+			continue;
+
+		// Compute near point
+		u = ((p.x - p1.x) * (p2.x - p1.x) + (p.y - p1.y) * (p2.y - p1.y)) / (float)p1.sqrDist(p2);
+
+		// Clip to edge
+		if (u < 0.0F)
+			u = 0.0F;
+		if (u > 1.0F)
+			u = 1.0F;
+
+		new_point.x = p1.x + u * (p2.x - p1.x);
+		new_point.y = p1.y + u * (p2.y - p1.y);
+
+		new_dist = p.sqrDist(new_point.toPoint());
+
+		if (new_dist < dist) {
+			near_p = new_point;
+			dist = new_dist;
+		}
+	}
+
+	// Find point not contained in polygon
+	return find_free_point(near_p, polygon, ret);
+}
+
+/**
+ * Computes the intersection point of a line segment and an edge (not
+ * including the vertices themselves)
+ * Parameters: (const Common::Point &) a, b: The line segment (a, b)
+ *             (Vertex *) vertex: The first vertex of the edge
+ * Returns   : (int) PF_OK on success, PF_ERROR otherwise
+ *             (FloatPoint) *ret: The intersection point
+ */
+int intersection(const Common::Point &a, const Common::Point &b, const Vertex *vertex, FloatPoint *ret) {
+	// Parameters of parametric equations
+	float s, t;
+	// Numerator and denominator of equations
+	float num, denom;
+	const Common::Point &c = vertex->v;
+	const Common::Point &d = CLIST_NEXT(vertex)->v;
+
+	denom = a.x * (float)(d.y - c.y) + b.x * (float)(c.y - d.y) +
+	        d.x * (float)(b.y - a.y) + c.x * (float)(a.y - b.y);
+
+	if (denom == 0.0)
+		// Segments are parallel, no intersection
+		return PF_ERROR;
+
+	num = a.x * (float)(d.y - c.y) + c.x * (float)(a.y - d.y) + d.x * (float)(c.y - a.y);
+
+	s = num / denom;
+
+	num = -(a.x * (float)(c.y - b.y) + b.x * (float)(a.y - c.y) + c.x * (float)(b.y - a.y));
+
+	t = num / denom;
+
+	if ((0.0 <= s) && (s <= 1.0) && (0.0 < t) && (t < 1.0)) {
+		// Intersection found
+		ret->x = a.x + s * (b.x - a.x);
+		ret->y = a.y + s * (b.y - a.y);
+		return PF_OK;
+	}
+
+	return PF_ERROR;
+}
+
+/**
+ * Computes the nearest intersection point of a line segment and the polygon
+ * set. Intersection points that are reached from the inside of a polygon
+ * are ignored as are improper intersections which do not obstruct
+ * visibility
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ *             (const Common::Point &) p, q: The line segment (p, q)
+ * Returns   : (int) PF_OK on success, PF_ERROR when no intersections were
+ *                   found, PF_FATAL otherwise
+ *             (Common::Point) *ret: On success, the closest intersection point
+ */
+static int nearest_intersection(PathfindingState *s, const Common::Point &p, const Common::Point &q, Common::Point *ret) {
+	Polygon *polygon = nullptr;
+	FloatPoint isec;
+	Polygon *ipolygon = nullptr;
+	uint32 dist = HUGE_DISTANCE;
+
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		polygon = *it;
+		Vertex *vertex;
+
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			uint32 new_dist;
+			FloatPoint new_isec;
+
+			// Check for intersection with vertex
+			if (between(p, q, vertex->v)) {
+				// Skip this vertex if we hit it from the
+				// inside of the polygon
+				if (inside(q, vertex)) {
+					new_isec.x = vertex->v.x;
+					new_isec.y = vertex->v.y;
+				} else
+					continue;
+			} else {
+				// Check for intersection with edges
+
+				// Skip this edge if we hit it from the
+				// inside of the polygon
+				if (!left(vertex->v, CLIST_NEXT(vertex)->v, q))
+					continue;
+
+				if (intersection(p, q, vertex, &new_isec) != PF_OK)
+					continue;
+			}
+
+			new_dist = p.sqrDist(new_isec.toPoint());
+			if (new_dist < dist) {
+				ipolygon = polygon;
+				isec = new_isec;
+				dist = new_dist;
+			}
+		}
+	}
+
+	if (dist == HUGE_DISTANCE)
+		return PF_ERROR;
+
+	// Find point not contained in polygon
+	return find_free_point(isec, ipolygon, ret);
+}
+
+/**
+ * Checks whether a point is nearby a contained-access polygon (distance 1 pixel)
+ * @param point			the point
+ * @param polygon		the contained-access polygon
+ * @return true when point is nearby polygon, false otherwise
+ */
+static bool nearbyPolygon(const Common::Point &point, Polygon *polygon) {
+	assert(polygon->type == POLY_CONTAINED_ACCESS);
+
+	return ((contained(Common::Point(point.x, point.y + 1), polygon) != CONT_INSIDE)
+			|| (contained(Common::Point(point.x, point.y - 1), polygon) != CONT_INSIDE)
+			|| (contained(Common::Point(point.x + 1, point.y), polygon) != CONT_INSIDE)
+			|| (contained(Common::Point(point.x - 1, point.y), polygon) != CONT_INSIDE));
+}
+
+/**
+ * Checks that the start point is in a valid position, and takes appropriate action if it's not.
+ * @param s				the pathfinding state
+ * @param start			the start point
+ * @param lb2Room530	whether to apply the LB2 room 530 workaround
+ * @return a valid start point on success, NULL otherwise
+ */
+static Common::Point *fixup_start_point(PathfindingState *s, const Common::Point &start, bool lb2Room530) {
+	PolygonList::iterator it = s->polygons.begin();
+	Common::Point *new_start = new Common::Point(start);
+
+	while (it != s->polygons.end()) {
+		int cont = contained(start, *it);
+		int type = (*it)->type;
+
+		switch (type) {
+		case POLY_TOTAL_ACCESS:
+			// Remove totally accessible polygons that contain the start point
+			if (cont != CONT_OUTSIDE) {
+				delete *it;
+				it = s->polygons.erase(it);
+				continue;
+			}
+			break;
+		case POLY_CONTAINED_ACCESS:
+			// Remove contained access polygons that do not contain
+			// the start point (containment test is inverted here).
+			// SSCI appears to be using a small margin of error here,
+			// so we do the same.
+			if ((cont == CONT_INSIDE) && !nearbyPolygon(start, *it)) {
+				delete *it;
+				it = s->polygons.erase(it);
+				continue;
+			}
+			// Fall through
+		case POLY_BARRED_ACCESS:
+		case POLY_NEAREST_ACCESS:
+			if (cont != CONT_OUTSIDE) {
+				if (s->_prependPoint != nullptr) {
+					// We shouldn't get here twice.
+					// We need to break in this case, otherwise we'll end in an infinite
+					// loop.
+					warning("AvoidPath: start point is contained in multiple polygons");
+
+					// WORKAROUND: LB2 room 530 has two barred access polygons obstacles with
+					// the second completely contained in the first. To walk down the stairs,
+					// the script places ego within the inner polygon to walk along a path
+					// that's also contained by both polygons. Our algorithm fixes up the
+					// start point against the first polygon that contains it, and so the
+					// staircase polygon is ignored. Instead ego's start position is set just
+					// outside the first (outer) polygon. The destination is then unreachable
+					// and so the script proceeds without ego ever walking down the stairs.
+					// The workaround is to ignore the fixup against the first polygon.
+					bool ignoreEarlierPolygon = lb2Room530 && (*it)->vertices.size() == 14;
+					if (ignoreEarlierPolygon) {
+						delete s->_prependPoint;
+						s->_prependPoint = nullptr;
+					} else {
+						break;
+					}
+				}
+
+				if (s->findNearPoint(start, (*it), new_start) != PF_OK) {
+					delete new_start;
+					return nullptr;
+				}
+
+				if ((type == POLY_BARRED_ACCESS) || (type == POLY_CONTAINED_ACCESS))
+					debugC(kDebugLevelAvoidPath, "AvoidPath: start position at unreachable location");
+
+				// The original start position is in an invalid location, so we
+				// use the moved point and add the original one to the final path
+				// later on.
+				if (start != *new_start)
+					s->_prependPoint = new Common::Point(start);
+			}
+			break;
+		default:
+			break;
+		}
+
+		++it;
+	}
+
+	return new_start;
+}
+
+/**
+ * Checks that the end point is in a valid position, and takes appropriate action if it's not.
+ * @param s				the pathfinding state
+ * @param end			the end point
+ * @return a valid end point on success, NULL otherwise
+ */
+static Common::Point *fixup_end_point(PathfindingState *s, const Common::Point &end) {
+	PolygonList::iterator it = s->polygons.begin();
+	Common::Point *new_end = new Common::Point(end);
+
+	while (it != s->polygons.end()) {
+		int cont = contained(end, *it);
+		int type = (*it)->type;
+
+		switch (type) {
+		case POLY_TOTAL_ACCESS:
+			// Remove totally accessible polygons that contain the end point
+			if (cont != CONT_OUTSIDE) {
+				delete *it;
+				it = s->polygons.erase(it);
+				continue;
+			}
+			break;
+		case POLY_CONTAINED_ACCESS:
+		case POLY_BARRED_ACCESS:
+		case POLY_NEAREST_ACCESS:
+			if (cont != CONT_OUTSIDE) {
+				if (s->_appendPoint != nullptr) {
+					// We shouldn't get here twice.
+					// Happens in LB2CD, inside the speakeasy when walking from the
+					// speakeasy (room 310) into the bathroom (room 320), after having
+					// consulted the notebook (bug #5029).
+					// We need to break in this case, otherwise we'll end in an infinite
+					// loop.
+					warning("AvoidPath: end point is contained in multiple polygons");
+					break;
+				}
+
+				// The original end position is in an invalid location, so we move the point
+				if (s->findNearPoint(end, (*it), new_end) != PF_OK) {
+					delete new_end;
+					return nullptr;
+				}
+
+				// For near-point access polygons we need to add the original end point
+				// to the path after pathfinding.
+				if ((type == POLY_NEAREST_ACCESS) && (end != *new_end))
+					s->_appendPoint = new Common::Point(end);
+			}
+			break;
+		default:
+			break;
+		}
+
+		++it;
+	}
+
+	return new_end;
+}
+
+/**
+ * Merges a point into the polygon set. A new vertex is allocated for this
+ * point, unless a matching vertex already exists. If the point is on an
+ * already existing edge that edge is split up into two edges connected by
+ * the new vertex
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ *             (const Common::Point &) v: The point to merge
+ * Returns   : (Vertex *) The vertex corresponding to v
+ */
+static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
+	Vertex *vertex;
+	Vertex *v_new;
+	Polygon *polygon;
+
+	// Check for already existing vertex
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		polygon = *it;
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			if (vertex->v == v)
+				return vertex;
+		}
+	}
+
+	v_new = new Vertex(v);
+
+	// Check for point being on an edge
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		polygon = *it;
+		// Skip single-vertex polygons
+		if (VERTEX_HAS_EDGES(polygon->vertices.first())) {
+			CLIST_FOREACH(vertex, &polygon->vertices) {
+				Vertex *next = CLIST_NEXT(vertex);
+
+				if (between(vertex->v, next->v, v)) {
+					// Split edge by adding vertex
+					polygon->vertices.insertAfter(vertex, v_new);
+					return v_new;
+				}
+			}
+		}
+	}
+
+	// Add point as single-vertex polygon
+	polygon = new Polygon(POLY_BARRED_ACCESS);
+	polygon->vertices.insertHead(v_new);
+	s->polygons.push_front(polygon);
+
+	return v_new;
+}
+
+/**
+ * Changes the polygon list for optimization level 0 (used for keyboard
+ * support). Totally accessible polygons are removed and near-point
+ * accessible polygons are changed into totally accessible polygons.
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ */
+static void change_polygons_opt_0(PathfindingState *s) {
+
+	PolygonList::iterator it = s->polygons.begin();
+	while (it != s->polygons.end()) {
+		Polygon *polygon = *it;
+		assert(polygon);
+
+		if (polygon->type == POLY_TOTAL_ACCESS) {
+			delete polygon;
+			it = s->polygons.erase(it);
+		} else {
+			if (polygon->type == POLY_NEAREST_ACCESS)
+				polygon->type = POLY_TOTAL_ACCESS;
+			++it;
+		}
+	}
+}
+
+/**
+ * Fills the vertex index with the vertices of all polygons
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ */
+static void build_vertex_index(PathfindingState *s) {
+	s->vertices = 0;
+
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->index = s->vertices;
+			s->vertex_index[s->vertices++] = vertex;
+		}
+	}
+}
+
+/**
+ * Looks up the visibility graph of the polygon set in the cache, and adds an
+ * empty one if it isn't there. Pairs of vertices are only checked when AStar()
+ * gets to them, and the result is stored in the cached graph. Must be called
+ * before the start and end points are merged into the polygon set.
+ * Parameters: (PathfindingCache &) cache: The cached visibility graphs
+ *             (PathfindingState *) p: The pathfinding state
+ * Returns   : (byte *) The visibility graph, valid until the next lookup
+ */
+static byte *lookup_visibility(PathfindingCache &cache, PathfindingState *p) {
+	Common::Array<int16> polygons;
+
+	for (PolygonList::iterator it = p->polygons.begin(); it != p->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		polygons.push_back(polygon->vertices.size());
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			polygons.push_back(vertex->v.x);
+			polygons.push_back(vertex->v.y);
+		}
+	}
+
+	uint32 hash = 0;
+	for (uint i = 0; i < polygons.size(); i++)
+		hash = hash * 31 + (uint16)polygons[i];
+
+	const int n = p->vertices;
+	for (int i = 0; i < n; i++)
+		p->vertex_index[i]->baseIndex = i;
+
+	cache.queries++;
+
+	uint lru = 0;
+	for (uint i = 0; i < cache.entries.size(); i++) {
+		PathfindingCacheEntry &entry = cache.entries[i];
+
+		if (entry.hash == hash && entry.polygons == polygons) {
+			debugC(kDebugLevelAvoidPath, "[avoidpath] Using cached visibility graph of %d vertices", n);
+			cache.hits++;
+			entry.lastUse = cache.queries;
+			return entry.visibility.data();
+		}
+
+		if (entry.lastUse < cache.entries[lru].lastUse)
+			lru = i;
+	}
+
+	if (cache.entries.size() < PATHFINDING_CACHE_SIZE) {
+		lru = cache.entries.size();
+		cache.entries.resize(lru + 1);
+	}
+
+	PathfindingCacheEntry &entry = cache.entries[lru];
+	entry.polygons = polygons;
+	entry.hash = hash;
+	entry.lastUse = cache.queries;
+	entry.visibility.clear();
+	entry.visibility.resize(n * n, VISIBILITY_UNKNOWN);
+
+	return entry.visibility.data();
+}
+
+/**
+ * Computes the visibility graph of all vertices from the cached one. Merging
+ * the start and end points only affects the visibility of the pairs of
+ * vertices whose connecting line goes through a point that split an edge,
+ * and of the merged points themselves. These pairs, and those which are not
+ * in the cached graph yet, are only checked when AStar() gets to them.
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ */
+static void build_visibility(PathfindingState *s) {
+	const int n = s->vertices;
+	VertexList splits;
+
+	for (int i = 0; i < n; i++) {
+		Vertex *vertex = s->vertex_index[i];
+		if (vertex->baseIndex < 0 && VERTEX_HAS_EDGES(vertex))
+			splits.push_back(vertex);
+	}
+
+	s->visibility.clear();
+	s->visibility.resize(n * n);
+
+	for (int i = 0; i < n; i++) {
+		Vertex *vertex_cur = s->vertex_index[i];
+
+		for (int j = i + 1; j < n; j++) {
+			Vertex *vertex = s->vertex_index[j];
+			bool cached = vertex_cur->baseIndex >= 0 && vertex->baseIndex >= 0;
+
+			for (VertexList::iterator it = splits.begin(); cached && it != splits.end(); ++it) {
+				if (between(vertex_cur->v, vertex->v, (*it)->v))
+					cached = false;
+			}
+
+			byte visible = VISIBILITY_UNKNOWN;
+			if (cached) {
+				visible = s->baseVisibility[vertex_cur->baseIndex * s->baseVertices + vertex->baseIndex];
+				if (visible == VISIBILITY_UNKNOWN)
+					visible = VISIBILITY_UNKNOWN_CACHED;
+			}
+
+			s->visibility[i * n + j] = s->visibility[j * n + i] = visible;
+		}
+	}
+}
+
+/**
+ * Fixes up the start and end points, and merges them into the polygon set
+ * Parameters: (PathfindingCache &) cache: The cached visibility graphs
+ *             (PathfindingState *) pf_s: The pathfinding state with the polygons
+ *             (int) count: The number of vertices of the polygons
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ *             (bool) lsl5Room660: Whether to apply the LSL5 room 660 workaround
+ *             (bool) lb2Room530: Whether to apply the LB2 room 530 workaround
+ * Returns   : (PathfindingState *) pf_s on success, NULL otherwise, in which
+ *                            case pf_s is deleted
+ */
+PathfindingState *prepare_polygon_set(PathfindingCache &cache, PathfindingState *pf_s, int count, Common::Point start, Common::Point end, int opt, bool lsl5Room660, bool lb2Room530) {
+	if (opt == 0)
+		change_polygons_opt_0(pf_s);
+
+	Common::Point *new_start = fixup_start_point(pf_s, start, lb2Room530);
+
+	if (!new_start) {
+		warning("AvoidPath: Couldn't fixup start position for pathfinding");
+		delete pf_s;
+		return nullptr;
+	}
+
+	Common::Point *new_end = fixup_end_point(pf_s, end);
+
+	if (!new_end) {
+		warning("AvoidPath: Couldn't fixup end position for pathfinding");
+		delete new_start;
+		delete pf_s;
+		return nullptr;
+	}
+
+	if (opt == 0) {
+		// Keyboard support. Only the first edge of the path we compute
+		// here matches the path returned by SSCI. This is assumed to be
+		// sufficient as all known use cases only use the first two
+		// vertices of the returned path.
+		// Pharkas uses this mode for a secondary polygon set containing
+		// rectangular polygons used to block an actor's path.
+
+		// If we have a prepended point, we do nothing here as the
+		// actor is in barred territory and should be moved outside of
+		// it ASAP. This matches the behavior of SSCI.
+		if (!pf_s->_prependPoint) {
+			// Actor position is OK, find nearest obstacle.
+			int err = nearest_intersection(pf_s, start, *new_end, new_start);
+
+			if (err == PF_FATAL) {
+				warning("AvoidPath: error finding nearest intersection");
+				delete new_start;
+				delete new_end;
+				delete pf_s;
+				return nullptr;
+			}
+
+			if (err == PF_OK)
+				pf_s->_prependPoint = new Common::Point(start);
+		}
+	} else {
+		// WORKAROUND LSL5 room 660. Priority glitch due to us choosing a different path
+		// than SSCI. Happens when Patti walks to the control room.
+		if (lsl5Room660 && (Common::Point(67, 131) == *new_start) && (Common::Point(229, 101) == *new_end)) {
+			debug(1, "[avoidpath] Applying fix for priority problem in LSL5, room 660");
+			pf_s->_prependPoint = new_start;
+			new_start = new Common::Point(77, 107);
+		}
+	}
+
+	// Allocate vertex index
+	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * (count + 2));
+
+	// Get the visibility graph of the polygons themselves
+	build_vertex_index(pf_s);
+	pf_s->baseVertices = pf_s->vertices;
+	pf_s->baseVisibility = lookup_visibility(cache, pf_s);
+
+	// Merge start and end points into polygon set
+	pf_s->vertex_start = merge_point(pf_s, *new_start);
+	pf_s->vertex_end = merge_point(pf_s, *new_end);
+
+	delete new_start;
+	delete new_end;
+
+	build_vertex_index(pf_s);
+	build_visibility(pf_s);
+
+	return pf_s;
+}
+
+// Entry of the A* open set. Entries are not removed when the cost of their
+// vertex changes, so they are only valid as long as costF matches the
+// vertex.
+struct OpenSetEntry {
+	uint32 costF;
+	uint32 order;
+	Vertex *vertex;
+
+	OpenSetEntry(Vertex *v) : costF(v->costF), order(v->openOrder), vertex(v) {}
+
+	// Vertices with the lowest F cost come first. On a tie, the vertex that
+	// was added to the open set last comes first, like in SSCI's list.
+	bool operator<(const OpenSetEntry &entry) const {
+		if (costF != entry.costF)
+			return costF < entry.costF;
+		return order > entry.order;
+	}
+};
+
+// Binary heap of open set entries
+class OpenSet {
+public:
+	bool empty() const {
+		return _heap.empty();
+	}
+
+	void push(Vertex *vertex) {
+		uint pos = _heap.size();
+		_heap.push_back(OpenSetEntry(vertex));
+
+		while (pos > 0 && _heap[pos] < _heap[(pos - 1) / 2]) {
+			SWAP(_heap[pos], _heap[(pos - 1) / 2]);
+			pos = (pos - 1) / 2;
+		}
+	}
+
+	OpenSetEntry pop() {
+		OpenSetEntry top = _heap[0];
+		_heap[0] = _heap.back();
+		_heap.pop_back();
+
+		uint pos = 0;
+		for (;;) {
+			uint child = pos * 2 + 1;
+			if (child >= _heap.size())
+				break;
+			if (child + 1 < _heap.size() && _heap[child + 1] < _heap[child])
+				child++;
+			if (!(_heap[child] < _heap[pos]))
+				break;
+			SWAP(_heap[pos], _heap[child]);
+			pos = child;
+		}
+
+		return top;
+	}
+
+private:
+	Common::Array<OpenSetEntry> _heap;
+};
+
+/**
+ * Computes a shortest path from vertex_start to vertex_end. The caller can
+ * construct the resulting path by following the path_prev links from
+ * vertex_end back to vertex_start. If no path exists vertex_end->path_prev
+ * will be NULL
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ *             (bool) borderPenalty: Whether screen_border_penalty() applies
+ */
+void AStar(PathfindingState *s, bool borderPenalty) {
+	const int n = s->vertices;
+	uint32 order = 0;
+	OpenSet openSet;
+
+	s->vertex_start->openOrder = ++order;
+	s->vertex_start->costG = 0;
+	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	openSet.push(s->vertex_start);
+
+	while (!openSet.empty()) {
+		// Find vertex in open set with lowest F cost
+		OpenSetEntry entry = openSet.pop();
+		Vertex *vertex_min = entry.vertex;
+
+		if (vertex_min->closed || entry.costF != vertex_min->costF)
+			continue;
+
+		// Check if we are done
+		if (vertex_min == s->vertex_end)
+			return;
+
+		// Move vertex from set open to set closed
+		vertex_min->closed = true;
+
+		// Visit the visible vertices in the order in which visible_vertices()
+		// returns them, for the same result on a tie
+		byte *visible = &s->visibility[vertex_min->index * n];
+
+		for (int i = n - 1; i >= 0; i--) {
+			Vertex *vertex = s->vertex_index[i];
+
+			if (vertex->closed)
+				continue;
+
+			if (visible[i] >= VISIBILITY_UNKNOWN) {
+				const byte result = is_visible(s, vertex_min, vertex);
+
+				// Pairs of the polygon set keep their visibility once the
+				// start and end points are merged, so it can be reused
+				if (visible[i] == VISIBILITY_UNKNOWN_CACHED) {
+					const int m = s->baseVertices;
+					s->baseVisibility[vertex_min->baseIndex * m + vertex->baseIndex] = result;
+					s->baseVisibility[vertex->baseIndex * m + vertex_min->baseIndex] = result;
+				}
+
+				visible[i] = s->visibility[i * n + vertex_min->index] = result;
+			}
+
+			if (!visible[i])
+				continue;
+
+			if (!vertex->openOrder)
+				vertex->openOrder = ++order;
+
+			uint32 new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
+
+			if (borderPenalty && s->pointOnScreenBorder(vertex->v))
+				new_dist += 10000;
+
+			if (new_dist < vertex->costG) {
+				vertex->costG = new_dist;
+				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
+				vertex->path_prev = vertex_min;
+				openSet.push(vertex);
+			}
+		}
+	}
+
+	debugC(kDebugLevelAvoidPath, "AvoidPath: End point (%i, %i) is unreachable", s->vertex_end->v.x, s->vertex_end->v.y);
+}
+
+} // End of namespace Sci
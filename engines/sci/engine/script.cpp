@@ -74,6 +74,44 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	_instructions.clear();
+	_instructionIndex.clear();
+}
+
+const DecodedInstruction &Script::decodeInstruction(uint32 offset) {
+	if (_instructionIndex.empty())
+		_instructionIndex.resize(_buf->size());
+
+	DecodedInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+
+	// Relative operands are relative to the next instruction
+	const uint32 nextOffset = offset + instruction.size;
+	switch (instruction.extOpcode >> 1) {
+	case op_bt:
+	case op_bnt:
+	case op_jmp:
+	case op_call:
+		instruction.target = nextOffset + instruction.opparams[0];
+		break;
+	case op_lofsa:
+	case op_lofss:
+		instruction.target = findOffset(instruction.opparams[0], this, nextOffset);
+		break;
+	default:
+		instruction.target = 0;
+		break;
+	}
+
+	if (_instructions.size() >= 0xFFFF) {
+		_uncachedInstruction = instruction;
+		return _uncachedInstruction;
+	}
+
+	_instructions.push_back(instruction);
+	_instructionIndex[offset] = _instructions.size();
+	return _instructions.back();
 }
 
 enum {
@@ -68,6 +68,21 @@ struct offsetLookupArrayEntry {
 
 typedef Common::Array<offsetLookupArrayEntry> offsetLookupArrayType;
 
+/**
+ * A PMachine instruction as decoded by readPMachineInstruction.
+ */
+struct DecodedInstruction {
+	int16 opparams[4]; /**< Operands of the instruction */
+	byte extOpcode;    /**< Opcode, including the low bit selecting the operand size */
+	uint32 size;       /**< Size of the instruction in the script buffer */
+	/**
+	 * Offset in the script buffer targeted by a branch, a jump, a local call
+	 * or a lofs instruction, resolved from its relative operand. 0 for other
+	 * instructions.
+	 */
+	uint32 target;
+};
+
 class Script : public SegmentObj {
 private:
 	int _nr; /**< Script number */
@@ -101,6 +116,19 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	/**
+	 * Instructions decoded so far, and for every offset of the script buffer
+	 * the index + 1 of the instruction starting there (0 if not decoded yet).
+	 * The index is 16-bit to keep it at two bytes per script byte; once it
+	 * is full, further instructions are decoded into _uncachedInstruction
+	 * on every call. Both are dropped when the script is (re)loaded.
+	 */
+	Common::Array<DecodedInstruction> _instructions;
+	Common::Array<uint16> _instructionIndex;
+	DecodedInstruction _uncachedInstruction;
+
+	const DecodedInstruction &decodeInstruction(uint32 offset);
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -119,6 +147,26 @@ public:
 	const byte *getBuf(uint offset = 0) const { return _buf->getUnsafeDataAt(offset); }
 	SciSpan<const byte> getSpan(uint offset) const { return _buf->subspan(offset); }
 
+	/**
+	 * Returns the instruction at the given offset of the script buffer.
+	 * Instructions are decoded the first time they are executed, so that the
+	 * VM doesn't have to parse the operands of hot code again and again.
+	 * The returned reference is only valid until the next call.
+	 */
+	inline const DecodedInstruction &getInstruction(uint32 offset) {
+		if (offset < _instructionIndex.size()) {
+			const uint16 index = _instructionIndex[offset];
+			if (index)
+				return _instructions[index - 1];
+		}
+		return decodeInstruction(offset);
+	}
+
+	uint32 getDecodedInstructionCount() const { return _instructions.size(); }
+	uint32 getDecodedInstructionsMemory() const {
+		return _instructions.size() * sizeof(DecodedInstruction) + _instructionIndex.size() * sizeof(uint16);
+	}
+
 	int getScriptNumber() const { return _nr; }
 	SegmentId getLocalsSegment() const { return _localsSegment; }
 	reg_t *getLocalsBegin() { return _localsBlock ? _localsBlock->_locals.begin() : NULL; }
@@ -47,6 +47,9 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_bitmapSegId = 0;
 #endif
 
+	_selectorCacheHits = 0;
+	_selectorCacheMisses = 0;
+
 	createClassTable();
 }
 
@@ -79,6 +82,8 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	invalidateSelectorCache();
 }
 
 void SegManager::initSysStrings() {
@@ -165,6 +170,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		invalidateSelectorCache();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -1085,6 +1091,15 @@ reg_t SegManager::getClassAddress(int classnr, ScriptLoadType lock, uint16 calle
 	}
 }
 
+void SegManager::cacheSelector(const Object *obj, Selector selector, const SelectorLookupEntry &entry) {
+	// Scripts only ever send a limited set of selectors to a limited set of
+	// objects, so this is merely a safety net
+	if (_selectorCache.size() >= 16384)
+		invalidateSelectorCache();
+
+	_selectorCache.setVal(makeSelectorLookupKey(obj, selector), entry);
+}
+
 int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	SegmentId segmentId = getScriptSegment(scriptNum);
 	Script *scr = getScriptIfLoaded(segmentId);
@@ -1099,6 +1114,7 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 		scr = allocateScript(scriptNum, segmentId);
 	}
 
+	invalidateSelectorCache();
 	scr->load(scriptNum, _resMan, _scriptPatcher, applyScriptPatches);
 	scr->initializeLocals(this);
 	scr->initializeObjects(this, segmentId, applyScriptPatches);
@@ -1124,6 +1140,8 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (scr->getLockers() > 0)
 		return;
 
+	invalidateSelectorCache();
+
 	// Free all classtable references to this script
 	for (uint i = 0; i < classTableSize(); i++)
 		if (getClass(i).reg.getSegment() == segmentId)
@@ -45,6 +45,32 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * A cached result of lookupSelector().
+ */
+struct SelectorLookupEntry {
+	SelectorType type; ///< Type of the selector
+	int varIndex;      ///< Index of the variable, for kSelectorVariable
+	reg_t funcp;       ///< Address of the method, for kSelectorMethod
+};
+
+struct SelectorLookupKey {
+	reg_t obj;
+	Selector selector;
+
+	bool operator==(const SelectorLookupKey &other) const {
+		return obj == other.obj && selector == other.selector;
+	}
+};
+
+struct SelectorLookupKey_Hash {
+	uint operator()(const SelectorLookupKey &x) const {
+		return (x.obj.getSegment() << 3) ^ x.obj.getOffset() ^ (x.obj.getOffset() << 16) ^ (x.selector * 0x9E3779B1);
+	}
+};
+
+typedef Common::HashMap<SelectorLookupKey, SelectorLookupEntry, SelectorLookupKey_Hash> SelectorLookupCache;
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -432,6 +458,35 @@ public:
 	 */
 	Common::Array<reg_t> findObjectsBySuperClass(const Common::String &superClassName);
 
+	/**
+	 * Looks up a cached result of lookupSelector() for the given object and
+	 * selector. Objects are identified by their position in their script,
+	 * which clones share with the object they were cloned from.
+	 * @return The cached entry, or NULL if there is none
+	 */
+	const SelectorLookupEntry *getCachedSelector(const Object *obj, Selector selector) {
+		SelectorLookupCache::const_iterator it = _selectorCache.find(makeSelectorLookupKey(obj, selector));
+		if (it == _selectorCache.end()) {
+			_selectorCacheMisses++;
+			return nullptr;
+		}
+		_selectorCacheHits++;
+		return &it->_value;
+	}
+
+	void cacheSelector(const Object *obj, Selector selector, const SelectorLookupEntry &entry);
+
+	/**
+	 * Drops all cached selector lookups. This needs to be called whenever
+	 * scripts are loaded or unloaded, as objects and classes may move.
+	 */
+	void invalidateSelectorCache() { _selectorCache.clear(); }
+
+	uint32 getSelectorCacheSize() const { return _selectorCache.size(); }
+	uint32 getSelectorCacheHits() const { return _selectorCacheHits; }
+	uint32 getSelectorCacheMisses() const { return _selectorCacheMisses; }
+	void resetSelectorCacheStats() { _selectorCacheHits = _selectorCacheMisses = 0; }
+
 	uint32 classTableSize() const { return _classTable.size(); }
 	Class getClass(int index) const { return _classTable[index]; }
 	void setClassOffset(int index, reg_t offset) { _classTable[index].reg = offset;	}
@@ -466,6 +521,10 @@ private:
 	/** Map script ids to segment ids. */
 	Common::HashMap<int, SegmentId> _scriptSegMap;
 
+	SelectorLookupCache _selectorCache;
+	uint32 _selectorCacheHits;
+	uint32 _selectorCacheMisses;
+
 	ResourceManager *_resMan;
 	ScriptPatcher *_scriptPatcher;
 
@@ -490,6 +549,13 @@ private:
 	void deallocate(SegmentId seg);
 	void createClassTable();
 
+	SelectorLookupKey makeSelectorLookupKey(const Object *obj, Selector selector) const {
+		SelectorLookupKey key;
+		key.obj = obj->getPos();
+		key.selector = selector;
+		return key;
+	}
+
 	SegmentId findFreeSegment() const;
 
 	/**
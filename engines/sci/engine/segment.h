@@ -24,6 +24,7 @@
 
 #include "common/serializer.h"
 #include "common/str.h"
+#include "sci/engine/entry_table.h"
 #include "sci/engine/object.h"
 #include "sci/engine/vm.h"
 #include "sci/engine/vm_types.h"	// for reg_t
@@ -131,6 +132,18 @@ public:
 		return Common::Array<reg_t>();
 	}
 
+	/**
+	 * Returns whether anything was allocated in the segment since the last
+	 * call to clearAllocatedSinceGC().
+	 * Used by the garbage collector to skip collections with nothing new.
+	 */
+	virtual bool hasAllocatedSinceGC() const { return false; }
+
+	/**
+	 * Resets the state reported by hasAllocatedSinceGC().
+	 */
+	virtual void clearAllocatedSinceGC() {}
+
 	/**
 	 * Iterates over all references reachable from the specified object.
 	 * Used by the garbage collector.
@@ -231,85 +244,25 @@ struct Hunk {
 };
 
 template<typename T>
-struct SegmentObjTable : public SegmentObj {
-	typedef T value_type;
-	struct Entry {
-		T *data;
-		int next_free; /* Only used for free entries */
-	};
-	enum { HEAPENTRY_INVALID = -1 };
-
-	int first_free = HEAPENTRY_INVALID; /**< Beginning of a singly linked list for entries */
-	int entries_used = 0; /**< Statistical information */
-
-	typedef Common::Array<Entry> ArrayType;
-	ArrayType _table;
-
+struct SegmentObjTable : public SegmentObj, public EntryTable<T> {
 public:
 	SegmentObjTable(SegmentType type) : SegmentObj(type) {
 	}
 
-	~SegmentObjTable() override {
-		for (uint i = 0; i < _table.size(); i++) {
-			if (isValidEntry(i)) {
-				freeEntry(i);
-			}
-		}
-	}
-
-	int allocEntry() {
-		entries_used++;
-		if (first_free != HEAPENTRY_INVALID) {
-			int oldff = first_free;
-			first_free = _table[oldff].next_free;
-
-			_table[oldff].next_free = oldff;
-			assert(_table[oldff].data == nullptr);
-			_table[oldff].data = new T;
-			return oldff;
-		} else {
-			uint newIdx = _table.size();
-			_table.push_back(Entry());
-			_table.back().data = new T;
-			_table[newIdx].next_free = newIdx;	// Tag as 'valid'
-			return newIdx;
-		}
-	}
-
 	bool isValidOffset(uint32 offset) const override {
-		return isValidEntry(offset);
-	}
-
-	bool isValidEntry(int idx) const {
-		return idx >= 0 && (uint)idx < _table.size() && _table[idx].next_free == idx;
-	}
-
-	virtual void freeEntry(int idx) {
-		if (idx < 0 || (uint)idx >= _table.size())
-			::error("Table::freeEntry: Attempt to release invalid table index %d", idx);
-
-		_table[idx].next_free = first_free;
-		delete _table[idx].data;
-		_table[idx].data = nullptr;
-		first_free = idx;
-		entries_used--;
+		return this->isValidEntry(offset);
 	}
 
 	Common::Array<reg_t> listAllDeallocatable(SegmentId segId) const override {
 		Common::Array<reg_t> tmp;
-		for (uint i = 0; i < _table.size(); i++)
-			if (isValidEntry(i))
+		for (uint i = 0; i < this->_table.size(); i++)
+			if (this->isValidEntry(i))
 				tmp.push_back(make_reg(segId, i));
 		return tmp;
 	}
 
-	uint size() const { return _table.size(); }
-
-	T &at(uint index) { return *_table[index].data; }
-	const T &at(uint index) const { return *_table[index].data; }
-
-	T &operator[](uint index) { return at(index); }
-	const T &operator[](uint index) const { return at(index); }
+	bool hasAllocatedSinceGC() const override { return this->allocated_since_gc; }
+	void clearAllocatedSinceGC() override { this->allocated_since_gc = false; }
 };
 
 
@@ -104,6 +104,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	gcStats.reset();
 
 	_eventCounter = 0;
 	_paletteSetIntensityCounter = 0;
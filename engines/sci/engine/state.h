@@ -34,6 +34,7 @@ class WriteStream;
 
 #include "sci/sci.h"
 #include "sci/engine/file.h"
+#include "sci/engine/kpathing.h"
 #include "sci/engine/seg_manager.h"
 
 #include "sci/parser/vocabulary.h"
@@ -97,6 +98,25 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Statistics of the garbage collector, see run_gc().
+ */
+struct GCStatistics {
+	uint32 collections;        //< Number of collections done
+	uint32 skippedCollections; //< Number of collections skipped, as nothing was allocated
+	uint32 skippedInRow;       //< Collections skipped since the last one done
+	uint32 freedEntries;       //< Number of entries freed
+	uint32 totalPauseTime;     //< Time spent in collections, in milliseconds
+	uint32 maxPauseTime;       //< Longest collection, in milliseconds
+	uint32 lastPauseTime;      //< Duration of the last collection, in milliseconds
+
+	GCStatistics() { reset(); }
+	void reset() {
+		collections = skippedCollections = skippedInRow = freedEntries = 0;
+		totalPauseTime = maxPauseTime = lastPauseTime = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 	EngineState(SegManager *segMan);
 	~EngineState() override;
@@ -188,6 +208,9 @@ struct EngineState : public Common::Serializable {
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics gcStats; /**< Statistics of the garbage collector */
+
+	PathfindingCache pathfindingCache; /**< Visibility graphs of recent kAvoidPath polygon sets */
 
 	MessageState *_msgState;
 	void initMessageState();
@@ -625,8 +625,11 @@ void run_vm(EngineState *s) {
 			s->xs->addr.pc.getOffset(), scr->getBufSize());
 
 		// Get opcode
-		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		const DecodedInstruction &instruction = scr->getInstruction(s->xs->addr.pc.getOffset());
+		const byte extOpcode = instruction.extOpcode;
+		memcpy(opparams, instruction.opparams, sizeof(instruction.opparams));
+		const uint32 target = instruction.target;
+		s->xs->addr.pc.incOffset(instruction.size);
 		const byte opcode = extOpcode >> 1;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
@@ -762,7 +765,7 @@ void run_vm(EngineState *s) {
 		case op_bt: // 0x17 (23)
 			// Branch relative if true
 			if (s->r_acc.getOffset() || s->r_acc.getSegment())
-				s->xs->addr.pc.incOffset(opparams[0]);
+				s->xs->addr.pc.setOffset(target);
 
 			if (s->xs->addr.pc.getOffset() >= local_script->getScriptSize())
 				error("[VM] op_bt: request to jump past the end of script %d (offset %d, script is %d bytes)",
@@ -772,7 +775,7 @@ void run_vm(EngineState *s) {
 		case op_bnt: // 0x18 (24)
 			// Branch relative if not true
 			if (!(s->r_acc.getOffset() || s->r_acc.getSegment()))
-				s->xs->addr.pc.incOffset(opparams[0]);
+				s->xs->addr.pc.setOffset(target);
 
 			if (s->xs->addr.pc.getOffset() >= local_script->getScriptSize())
 				error("[VM] op_bnt: request to jump past the end of script %d (offset %d, script is %d bytes)",
@@ -780,7 +783,7 @@ void run_vm(EngineState *s) {
 			break;
 
 		case op_jmp: // 0x19 (25)
-			s->xs->addr.pc.incOffset(opparams[0]);
+			s->xs->addr.pc.setOffset(target);
 
 			if (s->xs->addr.pc.getOffset() >= local_script->getScriptSize())
 				error("[VM] op_jmp: request to jump past the end of script %d (offset %d, script is %d bytes)",
@@ -830,7 +833,7 @@ void run_vm(EngineState *s) {
 			           + 1 + s->r_rest;
 			StackPtr call_base = s->xs->sp - argc;
 
-			uint32 localCallOffset = s->xs->addr.pc.getOffset() + opparams[0];
+			uint32 localCallOffset = target;
 
 			int final_argc = (call_base->requireUint16()) + s->r_rest;
 			call_base[0] = make_reg(0, final_argc); // The first argument is argc
@@ -854,7 +857,7 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				run_gc(s, true);
 			}
 
 			// Call kernel function
@@ -1199,7 +1202,7 @@ void run_vm(EngineState *s) {
 			// Load offset to accumulator or push to stack
 
 			r_temp.setSegment(s->xs->addr.pc.getSegment());
-			r_temp.setOffset(findOffset(opparams[0], local_script, s->xs->addr.pc.getOffset()));
+			r_temp.setOffset(target);
 			if (r_temp.getOffset() >= scr->getBufSize())
 				error("VM: lofsa/lofss operation overflowed: %04x:%04x beyond end"
 						  " of script (at %04x)", PRINT_REG(r_temp), scr->getBufSize());
@@ -0,0 +1,93 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "sci/graphics/celobj32.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Sci {
+
+bool CelSpans::blitSSE2(byte *target, const byte *source, int16 width, uint8 skipColor, uint16 limit) {
+	if (limit == 0) {
+		return blitGeneric(target, source, width, skipColor, limit);
+	}
+
+	const __m128i skip = _mm_set1_epi8((char)skipColor);
+	// Pixels are below the limit if they are at most limit - 1
+	const __m128i maxColor = _mm_set1_epi8((char)(limit - 1));
+	__m128i aboveLimit = _mm_setzero_si128();
+
+	int16 i = 0;
+	for (; i + 16 <= width; i += 16) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)(const void *)(source + i));
+		const __m128i dst = _mm_loadu_si128((const __m128i *)(const void *)(target + i));
+		const __m128i isSkip = _mm_cmpeq_epi8(src, skip);
+		const __m128i isBelow = _mm_cmpeq_epi8(_mm_max_epu8(src, maxColor), maxColor);
+		const __m128i mask = _mm_andnot_si128(isSkip, isBelow);
+		aboveLimit = _mm_or_si128(aboveLimit, _mm_andnot_si128(_mm_or_si128(isSkip, isBelow), _mm_set1_epi8(-1)));
+		_mm_storeu_si128((__m128i *)(void *)(target + i), _mm_or_si128(_mm_and_si128(mask, src), _mm_andnot_si128(mask, dst)));
+	}
+
+	bool result = _mm_movemask_epi8(aboveLimit) != 0;
+	if (i < width && blitGeneric(target + i, source + i, width - i, skipColor, limit)) {
+		result = true;
+	}
+	return result;
+}
+
+void CelSpans::reverseSSE2(byte *target, const byte *source, int16 width) {
+	int16 i = 0;
+	for (; i + 16 <= width; i += 16) {
+		__m128i pixels = _mm_loadu_si128((const __m128i *)(const void *)(source - i - 15));
+		// Swap the bytes of each word, then the words of each half, then the
+		// two halves
+		pixels = _mm_or_si128(_mm_slli_epi16(pixels, 8), _mm_srli_epi16(pixels, 8));
+		pixels = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+		pixels = _mm_shufflehi_epi16(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+		pixels = _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 3, 2));
+		_mm_storeu_si128((__m128i *)(void *)(target + i), pixels);
+	}
+
+	reverseGeneric(target + i, source - i, width - i);
+}
+
+} // End of namespace Sci
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
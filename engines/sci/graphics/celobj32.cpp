@@ -87,10 +87,21 @@ bool CelObj::_drawBlackLines = false;
 
 void CelObj::init() {
 	CelObj::deinit();
+	CelSpans::select();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
 	_scaler = new CelScaler();
-	_cache = new CelCache(100);
+
+	// SSCI kept 100 cels. The decompressed pixels are limited separately,
+	// since a single high resolution pic can take several hundred KiB.
+	uint cacheSize = 250;
+	if (ConfMan.hasKey("cel_cache_size") && ConfMan.getInt("cel_cache_size") > 0) {
+		cacheSize = ConfMan.getInt("cel_cache_size");
+	}
+	uint32 pixelCacheSize = 8 * 1024 * 1024;
+	if (ConfMan.hasKey("cel_cache_pixels") && ConfMan.getInt("cel_cache_pixels") >= 0) {
+		pixelCacheSize = ConfMan.getInt("cel_cache_pixels") * 1024;
+	}
+	_cache = new CelCache(cacheSize, pixelCacheSize);
 }
 
 void CelObj::deinit() {
@@ -100,6 +111,45 @@ void CelObj::deinit() {
 	_cache = nullptr;
 }
 
+#pragma mark -
+#pragma mark CelSpans
+
+CelSpans::BlitFunc CelSpans::blit = CelSpans::blitGeneric;
+CelSpans::ReverseFunc CelSpans::reverse = CelSpans::reverseGeneric;
+
+bool CelSpans::blitGeneric(byte *target, const byte *source, int16 width, uint8 skipColor, uint16 limit) {
+	bool aboveLimit = false;
+	for (int16 i = 0; i < width; ++i) {
+		const byte pixel = source[i];
+		if (pixel != skipColor) {
+			if (pixel < limit) {
+				target[i] = pixel;
+			} else {
+				aboveLimit = true;
+			}
+		}
+	}
+	return aboveLimit;
+}
+
+void CelSpans::reverseGeneric(byte *target, const byte *source, int16 width) {
+	for (int16 i = 0; i < width; ++i) {
+		*target++ = *source--;
+	}
+}
+
+void CelSpans::select() {
+	blit = blitGeneric;
+	reverse = reverseGeneric;
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+		blit = blitSSE2;
+		reverse = reverseSSE2;
+	}
+#endif
+}
+
 #pragma mark -
 #pragma mark CelObj - Scalers
 
@@ -113,6 +163,8 @@ struct SCALER_NoScale {
 	const int16 _lastIndex;
 	const int16 _sourceX;
 	const int16 _sourceY;
+	// Pixels of the current row in drawing order, when mirrored
+	byte _span[kCelScalerTableSize];
 
 	SCALER_NoScale(const CelObj &celObj, const int16 maxWidth, const Common::Point &scaledPosition) :
 	_row(nullptr),
@@ -144,15 +196,23 @@ struct SCALER_NoScale {
 		}
 	}
 
-	inline byte read() {
+	inline const byte *readSpan(const int16 width) {
+		const byte *span;
+		if (FLIP) {
 #ifndef RELEASE_BUILD
-		assert(_row != _rowEdge);
+			assert(_row - width >= _rowEdge);
 #endif
-		if (FLIP) {
-			return *_row--;
+			CelSpans::reverse(_span, _row, width);
+			span = _span;
+			_row -= width;
 		} else {
-			return *_row++;
+#ifndef RELEASE_BUILD
+			assert(_row + width <= _rowEdge);
+#endif
+			span = _row;
+			_row += width;
 		}
+		return span;
 	}
 };
 
@@ -168,6 +228,8 @@ struct SCALER_Scale {
 	// image and takes precedence over _reader.
 	Common::SharedPtr<Buffer> _sourceBuffer;
 	int16 _x;
+	// Scaled pixels of the current row
+	byte _span[kCelScalerTableSize];
 	static int16 _valuesX[kCelScalerTableSize];
 	static int16 _valuesY[kCelScalerTableSize];
 
@@ -308,11 +370,16 @@ struct SCALER_Scale {
 #endif
 	}
 
-	inline byte read() {
+	inline const byte *readSpan(const int16 width) {
 #ifndef RELEASE_BUILD
-		assert(_x >= _minX && _x <= _maxX);
+		assert(_x >= _minX && _x + width - 1 <= _maxX);
 #endif
-		return _row[_valuesX[_x++]];
+		const int16 *valuesX = _valuesX + _x;
+		for (int16 i = 0; i < width; ++i) {
+			_span[i] = _row[valuesX[i]];
+		}
+		_x += width;
+		return _span;
 	}
 };
 
@@ -371,14 +438,19 @@ private:
 	const int16 _sourceHeight;
 	const uint8 _skipColor;
 	const int16 _maxWidth;
+	const int16 _sourceWidth;
+	// The whole decompressed cel, if the cel cache holds it
+	const byte *const _pixels;
 
 public:
-	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
+	READER_Compressed(const CelObj &celObj, const int16 maxWidth, const bool useCache = true) :
 	_resource(celObj.getResPointer()),
 	_y(-1),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
-	_maxWidth(maxWidth) {
+	_maxWidth(maxWidth),
+	_sourceWidth(celObj._width),
+	_pixels(useCache ? celObj.getCachedPixels() : nullptr) {
 		assert(maxWidth <= celObj._width);
 
 		const SciSpan<const byte> celHeader = _resource.subspan(celObj._celHeaderOffset);
@@ -389,6 +461,10 @@ public:
 
 	inline const byte *getRow(const int16 y) {
 		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels + y * _sourceWidth;
+		}
+
 		if (y != _y) {
 			// compressed data segment for row
 			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
@@ -480,6 +556,16 @@ struct MAPPER_NoMD {
 			*target = translateMacColor(isMacSource, pixel);
 		}
 	}
+
+	inline void drawSpan(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		if (isMacSource) {
+			for (int16 x = 0; x < width; ++x) {
+				draw(target++, *source++, skipColor, isMacSource);
+			}
+		} else {
+			CelSpans::blit(target, source, width, skipColor, 256);
+		}
+	}
 };
 
 /**
@@ -490,6 +576,16 @@ struct MAPPER_NoMDNoSkip {
 	inline void draw(byte *target, const byte pixel, const uint8, const bool isMacSource) const {
 		*target = translateMacColor(isMacSource, pixel);
 	}
+
+	inline void drawSpan(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		if (isMacSource) {
+			for (int16 x = 0; x < width; ++x) {
+				draw(target++, *source++, skipColor, isMacSource);
+			}
+		} else {
+			memcpy(target, source, width);
+		}
+	}
 };
 
 /**
@@ -508,6 +604,27 @@ struct MAPPER_Map {
 			}
 		}
 	}
+
+	inline void drawSpan(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		if (isMacSource) {
+			for (int16 x = 0; x < width; ++x) {
+				draw(target++, *source++, skipColor, isMacSource);
+			}
+			return;
+		}
+
+		// Draw the pixels below the remap range first, then remap the others
+		// if there are any
+		const uint8 startColor = g_sci->_gfxRemap32->getStartColor();
+		if (CelSpans::blit(target, source, width, skipColor, startColor)) {
+			for (int16 x = 0; x < width; ++x) {
+				const byte pixel = source[x];
+				if (pixel != skipColor && pixel >= startColor && g_sci->_gfxRemap32->remapEnabled(pixel)) {
+					target[x] = g_sci->_gfxRemap32->remapColor(pixel, target[x]);
+				}
+			}
+		}
+	}
 };
 
 /**
@@ -522,6 +639,16 @@ struct MAPPER_NoMap {
 			*target = translateMacColor(isMacSource, pixel);
 		}
 	}
+
+	inline void drawSpan(byte *target, const byte *source, const int16 width, const uint8 skipColor, const bool isMacSource) const {
+		if (isMacSource) {
+			for (int16 x = 0; x < width; ++x) {
+				draw(target++, *source++, skipColor, isMacSource);
+			}
+		} else {
+			CelSpans::blit(target, source, width, skipColor, g_sci->_gfxRemap32->getStartColor());
+		}
+	}
 };
 
 void CelObj::draw(Buffer &target, const ScreenItem &screenItem, const Common::Rect &targetRect) const {
@@ -698,45 +825,152 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
 
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+CelCache::CelCache(const uint maxSize, const uint32 maxPixelSize) :
+	_entries(MAX<uint>(maxSize, 1)),
+	_nextId(1),
+	_pixelSize(0),
+	_maxPixelSize(maxPixelSize),
+	_hits(0),
+	_misses(0),
+	_pixelHits(0),
+	_pixelMisses(0) {}
+
+CelCache::~CelCache() {
+	clear();
+}
+
+CelObj *CelCache::find(const CelInfo32 &celInfo) {
+	IndexMap::const_iterator it = _map.find(celInfo);
+	if (it == _map.end()) {
+		++_misses;
+		return nullptr;
+	}
+
+	++_hits;
+	CelCacheEntry &entry = _entries[it->_value];
+	entry.id = ++_nextId;
+	return entry.celObj.get();
+}
+
+void CelCache::insert(const CelObj &celObj) {
+	IndexMap::const_iterator it = _map.find(celObj._info);
+	if (it != _map.end()) {
+		// Views with out of range loop or cel numbers are looked up by the
+		// requested numbers but stored with the corrected ones, so the
+		// corrected cel may already be cached
+		_entries[it->_value].id = ++_nextId;
+		return;
+	}
+
+	// This only happens for cels which were not in the cache, which have to
+	// be loaded from their resource anyway, so a linear search is fine here
+	uint index = 0;
+	int oldestId = _nextId + 1;
+	for (uint i = 0; i < _entries.size(); ++i) {
+		if (_entries[i].celObj == nullptr) {
+			index = i;
+			break;
+		} else if (oldestId > _entries[i].id) {
+			oldestId = _entries[i].id;
+			index = i;
+		}
+	}
+
+	CelCacheEntry &entry = _entries[index];
+	dropEntry(entry);
+	entry.celObj.reset(celObj.duplicate());
+	entry.id = ++_nextId;
+	if (entry.celObj->_pixels) {
+		entry.celObj->_pixels->cached = true;
+	}
+	_map.setVal(entry.celObj->_info, index);
+}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+bool CelCache::reservePixels(CelPixels &pixels, const uint32 size) {
+	++_pixelMisses;
+	if (size == 0 || size > _maxPixelSize) {
+		return false;
+	}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
+	while (_pixelSize + size > _maxPixelSize) {
+		CelCacheEntry *oldest = nullptr;
+		for (uint i = 0; i < _entries.size(); ++i) {
+			CelCacheEntry &entry = _entries[i];
+			if (entry.celObj && entry.celObj->_pixels && !entry.celObj->_pixels->data.empty() &&
+				(oldest == nullptr || oldest->celObj->_pixels->lastUse > entry.celObj->_pixels->lastUse)) {
+				oldest = &entry;
 			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
 		}
+
+		if (oldest == nullptr) {
+			return false;
+		}
+		dropPixels(*oldest);
 	}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+	_pixelSize += size;
+	pixels.data.resize(size);
+	pixels.lastUse = ++_nextId;
+	return true;
+}
+
+void CelCache::clear() {
+	for (uint i = 0; i < _entries.size(); ++i) {
+		dropEntry(_entries[i]);
+	}
+}
+
+void CelCache::dropEntry(CelCacheEntry &entry) {
+	if (entry.celObj == nullptr) {
+		return;
+	}
+
+	dropPixels(entry);
+	if (entry.celObj->_pixels) {
+		// Copies of the cel outside of the cache go back to decompressing
+		// the cel while drawing
+		entry.celObj->_pixels->cached = false;
 	}
+	_map.erase(entry.celObj->_info);
+	entry.celObj.reset();
+}
 
-	return -1;
+void CelCache::dropPixels(CelCacheEntry &entry) {
+	CelPixels *pixels = entry.celObj->_pixels.get();
+	if (pixels && !pixels->data.empty()) {
+		_pixelSize -= pixels->data.size();
+		pixels->data.clear();
+	}
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+const byte *CelObj::getCachedPixels() const {
+	if (!_pixels || !_pixels->cached) {
+		return nullptr;
 	}
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+	if (!_pixels->data.empty()) {
+		_cache->usePixels(*_pixels);
+		return _pixels->data.data();
+	}
+
+	if (!_cache->reservePixels(*_pixels, _width * _height)) {
+		return nullptr;
+	}
+
+	READER_Compressed reader(*this, _width, false);
+	byte *target = _pixels->data.data();
+	for (int16 y = 0; y < _height; ++y) {
+		memcpy(target, reader.getRow(y), _width);
+		target += _width;
+	}
+
+	return _pixels->data.data();
+}
+
+void CelObj::putCopyInCache() const {
+	_cache->insert(*this);
 }
 
 #pragma mark -
@@ -769,12 +1003,9 @@ struct RENDERER {
 			}
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
+			_mapper.drawSpan(targetPixel, _scaler.readSpan(targetWidth), targetWidth, _skipColor, _isMacSource);
 
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor, _isMacSource);
-			}
-
-			targetPixel += skipStride;
+			targetPixel += targetWidth + skipStride;
 		}
 	}
 };
@@ -983,16 +1214,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cacheEntry = _cache->find(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1090,7 +1318,11 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	if (_compressionType == kCelCompressionRLE) {
+		_pixels.reset(new CelPixels());
+	}
+
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1191,16 +1423,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cacheEntry = _cache->find(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1264,7 +1493,11 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	if (_compressionType == kCelCompressionRLE) {
+		_pixels.reset(new CelPixels());
+	}
+
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
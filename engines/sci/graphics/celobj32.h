@@ -22,6 +22,8 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
+#include "common/ptr.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -104,8 +106,8 @@ struct CelInfo32 {
 		color(0) {}
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
-	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	// SSCI SQ6, and by CelCache. Notably, it does not check the color field.
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +117,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -135,6 +137,41 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &x) const {
+		// Like CelInfo32::operator==, this ignores the color field
+		return (x.type << 28) ^ (x.resourceId << 12) ^ ((uint16)x.loopNo << 6) ^ (uint16)x.celNo ^
+			((x.bitmap.getSegment() << 16) | x.bitmap.getOffset()) * 0x9E3779B1;
+	}
+};
+
+/**
+ * The decompressed pixels of an RLE-compressed view or pic cel. All copies of
+ * a cached cel object share one of these, so the cel only has to be
+ * decompressed once for as long as it stays in the cel cache.
+ */
+struct CelPixels {
+	/**
+	 * The pixels of the cel, `_width * _height` bytes, or empty if the cel has
+	 * not been decompressed yet or the cache dropped its pixels.
+	 */
+	Common::Array<byte> data;
+
+	/**
+	 * Whether the cel is in the cel cache. Pixels are only kept for cached
+	 * cels, so that the cache can account for their memory.
+	 */
+	bool cached;
+
+	/**
+	 * The cache ID of the last time the pixels were drawn, used to drop the
+	 * pixels of the least recently drawn cels first.
+	 */
+	int lastUse;
+
+	CelPixels() : cached(false), lastUse(0) {}
+};
+
 class CelObj;
 struct CelCacheEntry {
 	/**
@@ -146,7 +183,97 @@ struct CelCacheEntry {
 	CelCacheEntry() : id(0) {}
 };
 
-typedef Common::Array<CelCacheEntry> CelCache;
+/**
+ * A cache of cel objects used to avoid reinitialisation overhead for cels
+ * with the same CelInfo32, and of the decompressed pixels of RLE cels.
+ *
+ * SSCI used a fixed array of cels which was searched linearly. Here, cels are
+ * found through a hash map, and both the number of cels and the memory used
+ * for decompressed pixels can be set with the `cel_cache_size` (in cels) and
+ * `cel_cache_pixels` (in KiB) configuration keys.
+ */
+class CelCache {
+public:
+	CelCache(uint maxSize, uint32 maxPixelSize);
+	~CelCache();
+
+	/**
+	 * Returns the cached copy of the cel object with the given info, or
+	 * nullptr if it is not in the cache.
+	 */
+	CelObj *find(const CelInfo32 &celInfo);
+
+	/**
+	 * Puts a copy of the given cel object into the cache, replacing the least
+	 * recently used cel if the cache is full.
+	 */
+	void insert(const CelObj &celObj);
+
+	/**
+	 * Allocates `size` bytes for the decompressed pixels of a cached cel,
+	 * dropping the pixels of the least recently drawn cels if needed.
+	 *
+	 * @returns false if the pixels would not fit into the cache at all.
+	 */
+	bool reservePixels(CelPixels &pixels, uint32 size);
+
+	/**
+	 * Marks the decompressed pixels of a cel as used.
+	 */
+	void usePixels(CelPixels &pixels) {
+		pixels.lastUse = ++_nextId;
+		++_pixelHits;
+	}
+
+	/**
+	 * Removes all cels from the cache.
+	 */
+	void clear();
+
+	uint size() const { return _map.size(); }
+	uint getMaxSize() const { return _entries.size(); }
+	uint32 getPixelSize() const { return _pixelSize; }
+	uint32 getMaxPixelSize() const { return _maxPixelSize; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getPixelHits() const { return _pixelHits; }
+	uint32 getPixelMisses() const { return _pixelMisses; }
+
+	void resetStats() { _hits = _misses = _pixelHits = _pixelMisses = 0; }
+
+private:
+	typedef Common::HashMap<CelInfo32, uint, CelInfo32_Hash> IndexMap;
+
+	Common::Array<CelCacheEntry> _entries;
+
+	/**
+	 * The index into `_entries` of each cached cel.
+	 */
+	IndexMap _map;
+
+	/**
+	 * A monotonically increasing cache ID used to identify the least recently
+	 * used item in the cache for replacement.
+	 */
+	int _nextId;
+
+	/**
+	 * The memory used by, and allowed for, decompressed pixels.
+	 */
+	uint32 _pixelSize, _maxPixelSize;
+
+	uint32 _hits, _misses, _pixelHits, _pixelMisses;
+
+	/**
+	 * Drops the cel object and decompressed pixels of the given entry.
+	 */
+	void dropEntry(CelCacheEntry &entry);
+
+	/**
+	 * Drops the decompressed pixels of the given entry, keeping its cel object.
+	 */
+	void dropPixels(CelCacheEntry &entry);
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -231,6 +358,46 @@ public:
 	const CelScalerTable &getScalerTable(const Ratio &scaleX, const Ratio &scaleY);
 };
 
+#pragma mark -
+#pragma mark CelSpans
+
+/**
+ * Row primitives used to draw cels. CelObj::init() selects the fastest
+ * versions supported by the CPU.
+ */
+struct CelSpans {
+	/**
+	 * Copies the pixels of a row which are neither `skipColor` nor at or above
+	 * `limit` to `target`. `limit` may be 256 to copy all non-skip pixels.
+	 *
+	 * @returns true if the row has pixels at or above `limit` which are not
+	 * `skipColor`.
+	 */
+	typedef bool (*BlitFunc)(byte *target, const byte *source, int16 width, uint8 skipColor, uint16 limit);
+
+	/**
+	 * Copies a row in reverse order, from `source` down to
+	 * `source - width + 1`.
+	 */
+	typedef void (*ReverseFunc)(byte *target, const byte *source, int16 width);
+
+	static BlitFunc blit;
+	static ReverseFunc reverse;
+
+	static bool blitGeneric(byte *target, const byte *source, int16 width, uint8 skipColor, uint16 limit);
+	static void reverseGeneric(byte *target, const byte *source, int16 width);
+
+#ifdef SCUMMVM_SSE2
+	static bool blitSSE2(byte *target, const byte *source, int16 width, uint8 skipColor, uint16 limit);
+	static void reverseSSE2(byte *target, const byte *source, int16 width);
+#endif
+
+	/**
+	 * Picks the fastest primitives supported by the CPU.
+	 */
+	static void select();
+};
+
 #pragma mark -
 #pragma mark CelObj
 
@@ -240,6 +407,8 @@ class ScreenItem;
  * draws itself directly to a target pixel buffer.
  */
 class CelObj {
+	friend class CelCache;
+
 protected:
 	/**
 	 * When true, every second line of the cel will be rendered as a black line.
@@ -449,13 +618,7 @@ private:
 
 #pragma mark -
 #pragma mark CelObj - Caching
-protected:
-	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
-	 */
-	static int _nextCacheId;
-
+public:
 	/**
 	 * A cache of cel objects used to avoid reinitialisation overhead for cels
 	 * with the same CelInfo32.
@@ -463,17 +626,23 @@ protected:
 	static CelCache *_cache;
 
 	/**
-	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * Returns the decompressed pixels of this cel, decompressing it first if
+	 * needed, or nullptr if the cel is not an RLE-compressed cel in the cel
+	 * cache or its pixels do not fit into the cache.
+	 */
+	const byte *getCachedPixels() const;
+
+protected:
+	/**
+	 * The decompressed pixels of RLE-compressed view and pic cels, shared
+	 * between all copies of this cel object.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	Common::SharedPtr<CelPixels> _pixels;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache.
 	 */
-	void putCopyInCache(int index) const;
+	void putCopyInCache() const;
 };
 
 #pragma mark -
@@ -1496,4 +1496,51 @@ void GfxFrameout::printVisiblePlaneItemList(Console *con, const reg_t planeObjec
 	printPlaneItemListInternal(con, p->_screenItemList);
 }
 
+void GfxFrameout::benchmarkDraw(Console *con, const int frames) {
+	// Capture draw lists which cover the whole screen
+	for (PlaneList::iterator plane = _planes.begin(); plane != _planes.end(); ++plane) {
+		(*plane)->_redrawAllCount = getScreenCount();
+	}
+	frameOut(true);
+
+	uint itemCount = 0;
+	for (ScreenItemListList::const_iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
+		itemCount += list->size();
+	}
+
+	Buffer buffers[2];
+	uint32 times[2];
+	for (int pass = 0; pass < 2; ++pass) {
+		if (pass == 0) {
+			CelSpans::blit = CelSpans::blitGeneric;
+			CelSpans::reverse = CelSpans::reverseGeneric;
+		} else {
+			CelSpans::select();
+		}
+
+		buffers[pass].copyFrom(_currentBuffer);
+		const uint32 start = g_system->getMillis();
+		for (int frame = 0; frame < frames; ++frame) {
+			for (ScreenItemListList::const_iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
+				for (DrawList::const_iterator drawItem = list->begin(); drawItem != list->end(); ++drawItem) {
+					const ScreenItem &screenItem = *(*drawItem)->screenItem;
+					CelObj &celObj = *screenItem._celObj;
+					celObj.draw(buffers[pass], screenItem, (*drawItem)->rect, screenItem._mirrorX ^ celObj._mirrorX);
+				}
+			}
+		}
+		times[pass] = g_system->getMillis() - start;
+	}
+
+	const bool identical = !memcmp(buffers[0].getPixels(), buffers[1].getPixels(), buffers[0].pitch * buffers[0].h);
+	buffers[0].free();
+	buffers[1].free();
+
+	con->debugPrintf("%d frames of %u screen items at %dx%d\n", frames, itemCount, _currentBuffer.w, _currentBuffer.h);
+	con->debugPrintf("Generic: %.2f ms/frame, selected: %.2f ms/frame\n", (double)times[0] / frames, (double)times[1] / frames);
+	if (!identical) {
+		con->debugPrintf("The frames drawn with the selected primitives differ from the generic ones!\n");
+	}
+}
+
 } // End of namespace Sci
@@ -452,6 +452,14 @@ public:
 	void printPlaneItemList(Console *con, const reg_t planeObject) const;
 	void printVisiblePlaneItemList(Console *con, const reg_t planeObject) const;
 	void printPlaneItemListInternal(Console *con, const ScreenItemList &screenItemList) const;
+
+	/**
+	 * Redraws the whole screen, then replays the draw lists of that frame
+	 * `frames` times into copies of the screen buffer, with the generic cel
+	 * drawing primitives and with the ones selected for this CPU, and prints
+	 * the time per frame.
+	 */
+	void benchmarkDraw(Console *con, const int frames);
 };
 
 } // End of namespace Sci
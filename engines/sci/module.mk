@@ -23,6 +23,7 @@ MODULE_OBJS := \
 	engine/kmovement.o \
 	engine/kparse.o \
 	engine/kpathing.o \
+	engine/kpathing_search.o \
 	engine/kscripts.o \
 	engine/ksound.o \
 	engine/kstring.o \
@@ -124,6 +125,12 @@ MODULE_OBJS += \
 	sound/audio32.o \
 	sound/decoders/sol.o \
 	video/robot_decoder.o
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	graphics/celobj32-sse2.o \
+	sound/audio32-sse2.o
+endif
 endif
 
 # This module can be built as a plugin
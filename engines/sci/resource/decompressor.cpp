@@ -37,7 +37,9 @@ int Decompressor::unpack(Common::ReadStream *src, byte *dest, uint32 nPacked, ui
 }
 
 void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked) {
-	_src = src;
+	_srcData.resize(nPacked);
+	_srcData.resize(src->read(_srcData.data(), nPacked));
+	_srcPos = 0;
 	_dest = dest;
 	_szPacked = nPacked;
 	_szUnpacked = nUnpacked;
@@ -46,9 +48,22 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked, uin
 	_dwBits = 0;
 }
 
+// Both fetchBits functions fill _dwBits with as many whole bytes as fit,
+// like reading one byte at a time would. Past the end of the packed data,
+// zeros are read.
+
 void Decompressor::fetchBitsMSB() {
+	if (_srcPos + 4 <= _srcData.size()) {
+		const uint bytes = (32 - _nBits) >> 3;
+		_dwBits |= (READ_BE_UINT32(&_srcData[_srcPos]) & (0xFFFFFFFFU << (32 - bytes * 8))) >> _nBits;
+		_nBits += bytes * 8;
+		_srcPos += bytes;
+		_dwRead += bytes;
+		return;
+	}
+
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)readSourceByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -69,8 +84,20 @@ byte Decompressor::getByteMSB() {
 }
 
 void Decompressor::fetchBitsLSB() {
+	if (_srcPos + 4 <= _srcData.size()) {
+		const uint bytes = (32 - _nBits) >> 3;
+		uint32 word = READ_LE_UINT32(&_srcData[_srcPos]);
+		if (bytes < 4)
+			word &= (1U << (bytes * 8)) - 1;
+		_dwBits |= word << _nBits;
+		_nBits += bytes * 8;
+		_srcPos += bytes;
+		_dwRead += bytes;
+		return;
+	}
+
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readSourceByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -101,10 +128,11 @@ void Decompressor::putByte(byte b) {
 int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked) {
 	init(src, dest, nPacked, nUnpacked);
 
-	byte numnodes = _src->readByte();
-	uint16 terminator = _src->readByte() | 0x100;
+	byte numnodes = readSourceByte();
+	uint16 terminator = readSourceByte() | 0x100;
 	_nodes = new byte [numnodes << 1];
-	_src->read(_nodes, numnodes << 1);
+	for (int i = 0; i < numnodes << 1; i++)
+		_nodes[i] = readSourceByte();
 
 	int16 c;
 	while ((c = getc2()) != terminator && (c >= 0) && !isFinished())
@@ -211,9 +239,17 @@ int DecompressorLZW::unpackLZW(Common::ReadStream *src, byte *dest, uint32 nPack
 			// Boundary check included because the previous decompressor had a
 			// comment saying it's "a normal situation" for a string to attempt
 			// to write beyond the destination. I have not seen this occur.
-			for (int i = 0; i < stringLengths[code] && !isFinished(); i++) {
-				putByte(dest[stringOffsets[code] + i]);
-			}
+			uint32 length = stringLengths[code];
+			if (_dwRead >= _szPacked)
+				length = MIN<uint32>(length, _szUnpacked - _dwWrote);
+
+			// The string may end with the byte being written, so this has
+			// to be a forward copy
+			const byte *string = dest + stringOffsets[code];
+			byte *out = dest + _dwWrote;
+			for (uint32 i = 0; i < length; i++)
+				out[i] = string[i];
+			_dwWrote += length;
 		}
 
 		// Stop adding to the table once it is full
@@ -23,6 +23,7 @@
 #define SCI_RESOURCE_DECOMPRESSOR_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 
 namespace Common {
 class ReadStream;
@@ -57,7 +58,7 @@ public:
 		_szUnpacked(0),
 		_dwRead(0),
 		_dwWrote(0),
-		_src(nullptr),
+		_srcPos(0),
 		_dest(nullptr)
 	{}
 
@@ -73,6 +74,8 @@ public:
 protected:
 	/**
 	 * Initialize decompressor.
+	 * The packed data is read into memory at once, so that bits can
+	 * be fetched from there a word at a time.
 	 * @param src		source stream to read from
 	 * @param dest		destination stream to write to
 	 * @param nPacked	size of packed data
@@ -106,6 +109,14 @@ protected:
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get one byte of the packed data without going through the bits
+	 * buffer, e.g. for headers. Reads zero past the end of the data.
+	 */
+	byte readSourceByte() {
+		return _srcPos < _srcData.size() ? _srcData[_srcPos++] : 0;
+	}
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
@@ -126,7 +137,8 @@ protected:
 	uint32 _szUnpacked;	///< size of the decompressed data
 	uint32 _dwRead;		///< number of bytes read from _src
 	uint32 _dwWrote;	///< number of bytes written to _dest
-	Common::ReadStream *_src;
+	Common::Array<byte> _srcData;	///< packed data
+	uint32 _srcPos;		///< position of the next unread byte in _srcData
 	byte *_dest;
 };
 
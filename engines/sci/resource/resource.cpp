@@ -25,6 +25,7 @@
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -1009,6 +1010,8 @@ void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
+	_prefetchQueue.clear();
+	resetTypeStats();
 	_resMap.clear();
 	_audioMapSCI1 = nullptr;
 #ifdef ENABLE_SCI32
@@ -1082,6 +1085,14 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// Hosts with plenty of memory can keep a lot more resources around
+	if (!_detectionMode && ConfMan.hasKey("resource_cache_size")) {
+		const int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0)
+			_maxMemoryLRU = cacheSize * 1024;
+	}
+	debugC(1, kDebugLevelResMan, "resMan: Resource cache size is %d KiB", _maxMemoryLRU / 1024);
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1128,7 +1139,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	_LRU.erase(res->_lruPosition);
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1139,6 +1150,7 @@ void ResourceManager::addToLRU(Resource *res) {
 		return;
 	}
 	_LRU.push_front(res);
+	res->_lruPosition = _LRU.begin();
 	_memoryLRU += res->size();
 #ifdef SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1196,9 +1208,15 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return nullptr;
 
-	if (retval->_status == kResStatusNoMalloc)
-		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
+	ResourceTypeStats &stats = _typeStats[retval->getType()];
+	if (retval->_status == kResStatusNoMalloc) {
+		loadResourceTimed(retval);
+		stats.misses++;
+	} else {
+		stats.hits++;
+	}
+
+	if (retval->_status == kResStatusEnqueued)
 		// The resource is removed from its current position
 		// in the LRU list because it has been requested
 		// again. Below, it will either be locked, or it
@@ -1248,6 +1266,83 @@ void ResourceManager::unlockResource(Resource *res) {
 	freeOldResources();
 }
 
+void ResourceManager::prefetchRoom(uint16 roomNumber) {
+	// Rooms usually use the script, picture, palette and messages with the
+	// same number as the room itself
+	static const ResourceType types[] = {
+		kResourceTypeScript, kResourceTypeHeap, kResourceTypePic,
+		kResourceTypePalette, kResourceTypeMessage
+	};
+
+	_prefetchQueue.clear();
+	for (int i = 0; i < ARRAYSIZE(types); i++) {
+		const ResourceId id(types[i], roomNumber);
+		Resource *res = testResource(id);
+		if (res && res->_status == kResStatusNoMalloc)
+			_prefetchQueue.push_back(id);
+	}
+}
+
+bool ResourceManager::prefetchNext() {
+	while (!_prefetchQueue.empty()) {
+		const ResourceId id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		// Don't push the resources of the current room out of the cache
+		if (_memoryLRU > _maxMemoryLRU / 2) {
+			_prefetchQueue.clear();
+			return false;
+		}
+
+		Resource *res = testResource(id);
+		if (!res || res->_status != kResStatusNoMalloc)
+			continue;
+
+		// Not counted as a miss, as nothing is waiting for it
+		debugC(kDebugLevelResMan, 2, "[resMan] Prefetching %s", id.toString().c_str());
+		loadResourceTimed(res);
+		_typeStats[res->getType()].prefetches++;
+		if (res->_status == kResStatusAllocated)
+			addToLRU(res);
+		freeOldResources();
+		return true;
+	}
+
+	return false;
+}
+
+void ResourceManager::loadResourceTimed(Resource *res) {
+	// Not recorded by the event recorder, so that playback isn't affected
+	const uint32 startTime = g_system->getMillis(true);
+	loadResource(res);
+	_typeStats[res->getType()].loadTime += g_system->getMillis(true) - startTime;
+}
+
+void ResourceManager::resetTypeStats() {
+	memset(_typeStats, 0, sizeof(_typeStats));
+}
+
+uint32 ResourceManager::benchmarkLoading(ResourceType type, uint32 &count, uint32 &size) {
+	count = size = 0;
+	const uint32 start = g_system->getMillis(true);
+
+	for (ResourceMap::iterator it = _resMap.begin(); it != _resMap.end(); ++it) {
+		Resource *res = it->_value;
+		if (it->_key.getType() != type || res->_status != kResStatusNoMalloc)
+			continue;
+
+		loadResource(res);
+		if (res->_status == kResStatusNoMalloc)
+			continue;
+
+		count++;
+		size += res->size();
+		res->unalloc();
+	}
+
+	return g_system->getMillis(true) - start;
+}
+
 const char *ResourceManager::versionDescription(ResVersion version) const {
 	switch (version) {
 	case kResVersionUnknown:
@@ -308,6 +308,7 @@ protected:
 	ResourceId _id;	// TODO: _id could almost be made const, only readResourceInfo() modifies it...
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in the LRU list, if enqueued */
 	uint16 _lockers; /**< Number of places where this resource was locked */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
@@ -323,6 +324,14 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/** Cache statistics of a resource type */
+struct ResourceTypeStats {
+	uint32 hits;       ///< Requests for resources which were already loaded
+	uint32 misses;     ///< Requests which needed to load the resource
+	uint32 prefetches; ///< Resources loaded by the prefetcher, before any request
+	uint32 loadTime;   ///< Time spent loading and decompressing, including prefetches, in milliseconds
+};
+
 class IntMapResourceSource;
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
@@ -380,6 +389,39 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Queues the resources which are likely to be used by the given room,
+	 * so that they can be loaded while the game is idle. This is only a
+	 * guess from the resource numbers: the script, heap, picture, palette
+	 * and messages numbered like the room. Views, sounds and the resources
+	 * of other scripts used by the room are not prefetched.
+	 * @param roomNumber	The number of the room being entered
+	 */
+	void prefetchRoom(uint16 roomNumber);
+
+	/**
+	 * Loads the next queued resource, if the LRU cache has room for it.
+	 * @return true if a resource was loaded, false if there was nothing to do
+	 */
+	bool prefetchNext();
+
+	const ResourceTypeStats &getTypeStats(ResourceType type) const { return _typeStats[type]; }
+	void resetTypeStats();
+
+	int getMemoryLRU() const { return _memoryLRU; }
+	int getMaxMemoryLRU() const { return _maxMemoryLRU; }
+	int getMemoryLocked() const { return _memoryLocked; }
+
+	/**
+	 * Loads every resource of the given type which is not in memory yet,
+	 * and drops it again right away.
+	 * @param type	The resource type to load
+	 * @param count	Set to the number of resources loaded
+	 * @param size	Set to the total unpacked size of the loaded resources
+	 * @return the time spent loading, in milliseconds
+	 */
+	uint32 benchmarkLoading(ResourceType type, uint32 &count, uint32 &size);
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -502,6 +544,8 @@ protected:
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	Common::List<ResourceId> _prefetchQueue; ///< Resources to load while idle
+	ResourceTypeStats _typeStats[kResourceTypeInvalid + 1];
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -562,6 +606,8 @@ protected:
 	Common::SeekableReadStream *getVolumeFile(ResourceSource *source);
 	void disposeVolumeFileStream(Common::SeekableReadStream *fileStream, ResourceSource *source);
 	void loadResource(Resource *res);
+	/** Loads a resource, adding the time spent to the statistics of its type */
+	void loadResourceTimed(Resource *res);
 	void freeOldResources();
 	bool validateResource(const ResourceId &resourceId, const Common::Path &sourceMapLocation, const Common::Path &sourceName, const uint32 offset, const uint32 size, const uint32 sourceSize) const;
 	Resource *addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0, const Common::Path &sourceMapLocation = Common::Path("(no map location)"));
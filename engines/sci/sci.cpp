@@ -969,7 +969,16 @@ void SciEngine::sleep(uint32 msecs) {
 #endif
 		uint32 time = _system->getMillis();
 		if (time + 10 < wakeUpTime) {
-			_system->delayMillis(10);
+			// Use the idle time to decode the next frame of a playing robot,
+			// or to load the resources of a new room
+			bool busy = false;
+#ifdef ENABLE_SCI32
+			if (_video32) {
+				busy = _video32->getRobotPlayer().decodeAhead();
+			}
+#endif
+			if (!busy && !_resMan->prefetchNext())
+				_system->delayMillis(10);
 		} else {
 			if (time < wakeUpTime)
 				_system->delayMillis(wakeUpTime - time);
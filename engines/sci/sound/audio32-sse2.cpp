@@ -0,0 +1,77 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "sci/sound/audio32.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Sci {
+
+void Audio32::mixSamplesSSE2(int32 *target, const int16 *source, const int numSamples) {
+	int i = 0;
+	for (; i + 8 <= numSamples; i += 8) {
+		const __m128i samples = _mm_loadu_si128((const __m128i *)(const void *)(source + i));
+		// Sign extend the samples to 32 bits
+		const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+		const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+		__m128i *dst = (__m128i *)(void *)(target + i);
+		_mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), low));
+		_mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), high));
+	}
+
+	mixSamplesGeneric(target + i, source + i, numSamples - i);
+}
+
+void Audio32::clampSamplesSSE2(int16 *target, const int32 *source, const int numSamples) {
+	int i = 0;
+	for (; i + 8 <= numSamples; i += 8) {
+		const __m128i low = _mm_loadu_si128((const __m128i *)(const void *)(source + i));
+		const __m128i high = _mm_loadu_si128((const __m128i *)(const void *)(source + i + 4));
+		// Packing with signed saturation clamps the samples
+		_mm_storeu_si128((__m128i *)(void *)(target + i), _mm_packs_epi32(low, high));
+	}
+
+	clampSamplesGeneric(target + i, source + i, numSamples - i);
+}
+
+} // End of namespace Sci
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -35,6 +35,7 @@
 #include "common/system.h"          // for OSystem, g_system
 #include "common/textconsole.h"     // for warning
 #include "common/types.h"           // for Flag::NO
+#include "common/util.h"            // for CLIP
 #include "engines/engine.h"         // for Engine, g_engine
 #include "sci/console.h"            // for Console
 #include "sci/engine/features.h"    // for GameFeatures
@@ -211,6 +212,20 @@ Audio32::Audio32(ResourceManager *resMan) :
 
 	_monitoredChannelIndex(-1),
 	_numMonitoredSamples(0) {
+	_mixSamples = mixSamplesGeneric;
+	_clampSamples = clampSamplesGeneric;
+#if defined(SCUMMVM_SSE2) && !defined(OUTPUT_UNSIGNED_AUDIO)
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+		_mixSamples = mixSamplesSSE2;
+		_clampSamples = clampSamplesSSE2;
+	}
+#endif
+
+	// Freed channels put their converters here, possibly from the audio
+	// thread, which should not allocate memory
+	_freeConverters[0].reserve(_channels.size());
+	_freeConverters[1].reserve(_channels.size());
+
 	// In games where scripts premultiply master audio volumes into the volumes
 	// of the individual audio channels sent to the mixer, Audio32 needs to use
 	// the kPlainSoundType so that the master SFX volume is not applied twice.
@@ -227,6 +242,12 @@ Audio32::Audio32(ResourceManager *resMan) :
 Audio32::~Audio32() {
 	stop(kAllChannels);
 	_mixer->stopHandle(_handle);
+
+	for (int i = 0; i < ARRAYSIZE(_freeConverters); ++i) {
+		for (uint j = 0; j < _freeConverters[i].size(); ++j) {
+			delete _freeConverters[i][j];
+		}
+	}
 }
 
 #pragma mark -
@@ -238,6 +259,18 @@ int Audio32::writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateCon
 	return samplePairsWritten << 1;
 }
 
+void Audio32::mixSamplesGeneric(int32 *target, const int16 *source, const int numSamples) {
+	for (int i = 0; i < numSamples; ++i) {
+		target[i] += source[i];
+	}
+}
+
+void Audio32::clampSamplesGeneric(int16 *target, const int32 *source, const int numSamples) {
+	for (int i = 0; i < numSamples; ++i) {
+		target[i] = CLIP<int32>(source[i], -32768, 32767);
+	}
+}
+
 int16 Audio32::getNumChannelsToMix() const {
 	Common::StackLock lock(_mutex);
 	int16 numChannels = 0;
@@ -304,10 +337,15 @@ int Audio32::readBuffer(int16 *const buffer, const int numSamples) {
 
 	const bool playOnlyMonitoredChannel = getSciVersion() != SCI_VERSION_3 && _monitoredChannelIndex != -1;
 
-	// The caller of `readBuffer` is a rate converter, which reuses (without
-	// clearing) an intermediate buffer, so we need to zero the intermediate
-	// buffer to prevent mixing into audio data from the last callback.
-	memset(buffer, 0, numSamples * sizeof(int16));
+	// Channels are added together at full precision, and only clamped once
+	// they are all mixed. The caller of `readBuffer` is a rate converter,
+	// which reuses (without clearing) an intermediate buffer, so the whole
+	// buffer is written at the end even if no channel is mixed.
+	if (numSamples > (int)_mixBuffer.size()) {
+		_mixBuffer.resize(numSamples);
+		_channelBuffer.resize(numSamples);
+	}
+	memset(_mixBuffer.data(), 0, numSamples * sizeof(int32));
 
 	// This emulates the attenuated mixing mode of SSCI engine, which reduces
 	// the volume of the target buffer when each new channel is mixed in.
@@ -413,15 +451,9 @@ int Audio32::readBuffer(int16 *const buffer, const int numSamples) {
 			if (numSamples > (int)_monitoredBuffer.size()) {
 				_monitoredBuffer.resize(numSamples);
 			}
-			memset(_monitoredBuffer.data(), 0, _monitoredBuffer.size() * sizeof(int16));
+			memset(_monitoredBuffer.data(), 0, numSamples * sizeof(int16));
 			_numMonitoredSamples = writeAudioInternal(*channel.stream, *channel.converter, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
-
-			int16 *sourceBuffer = _monitoredBuffer.data();
-			int16 *targetBuffer = buffer;
-			const int16 *const end = _monitoredBuffer.data() + _numMonitoredSamples;
-			while (sourceBuffer != end) {
-				Audio::clampedAdd(*targetBuffer++, *sourceBuffer++);
-			}
+			_mixSamples(_mixBuffer.data(), _monitoredBuffer.data(), _numMonitoredSamples);
 
 			if (_numMonitoredSamples > maxSamplesWritten) {
 				maxSamplesWritten = _numMonitoredSamples;
@@ -437,13 +469,20 @@ int Audio32::readBuffer(int16 *const buffer, const int numSamples) {
 				leftVolume = rightVolume = 0;
 			}
 
-			const int channelSamplesWritten = writeAudioInternal(*channel.stream, *channel.converter, buffer, numSamples, leftVolume, rightVolume);
+			memset(_channelBuffer.data(), 0, numSamples * sizeof(int16));
+			const int channelSamplesWritten = writeAudioInternal(*channel.stream, *channel.converter, _channelBuffer.data(), numSamples, leftVolume, rightVolume);
+			if (leftVolume || rightVolume) {
+				_mixSamples(_mixBuffer.data(), _channelBuffer.data(), channelSamplesWritten);
+			}
+
 			if (channelSamplesWritten > maxSamplesWritten) {
 				maxSamplesWritten = channelSamplesWritten;
 			}
 		}
 	}
 
+	_clampSamples(buffer, _mixBuffer.data(), numSamples);
+
 	_inAudioThread = false;
 
 	return maxSamplesWritten;
@@ -580,6 +619,12 @@ void Audio32::freeChannel(const int16 channelIndex) {
 	Common::StackLock lock(_mutex);
 	AudioChannel &channel = getChannel(channelIndex);
 
+	// Keep the converter for the next channel with the same kind of input,
+	// since games play most of their audio at one or two sample rates
+	if (channel.converter) {
+		_freeConverters[channel.stream->isStereo()].push_back(channel.converter.release());
+	}
+
 	// Robots have no corresponding resource to free
 	if (channel.robot) {
 		channel.stream.reset();
@@ -599,13 +644,25 @@ void Audio32::freeChannel(const int16 channelIndex) {
 		channel.stream.reset();
 	}
 
-	channel.converter.reset();
-
 	if (_monitoredChannelIndex == channelIndex) {
 		_monitoredChannelIndex = -1;
 	}
 }
 
+Audio::RateConverter *Audio32::makeConverter(const int inputRate, const bool inputStereo) {
+	Common::Array<Audio::RateConverter *> &freeConverters = _freeConverters[inputStereo];
+	if (freeConverters.empty()) {
+		return Audio::makeRateConverter(inputRate, getRate(), inputStereo, true, false);
+	}
+
+	Audio::RateConverter *converter = freeConverters.back();
+	freeConverters.pop_back();
+	converter->reset();
+	converter->setInputRate(inputRate);
+	converter->setOutputRate(getRate());
+	return converter;
+}
+
 void Audio32::unlockResources() {
 	Common::StackLock lock(_mutex);
 	assert(!_inAudioThread);
@@ -695,7 +752,7 @@ bool Audio32::playRobotAudio(const RobotAudioStream::RobotAudioPacket &packet) {
 		channel.volume = kMaxVolume;
 		channel.pan = -1;
 		// TODO: Avoid unnecessary channel conversion
-		channel.converter.reset(Audio::makeRateConverter(RobotAudioStream::kRobotSampleRate, getRate(), false, true, false));
+		channel.converter.reset(makeConverter(RobotAudioStream::kRobotSampleRate, false));
 		// The RobotAudioStream buffer size is
 		// ((bytesPerSample * channels * sampleRate * 2000ms) / 1000ms) & ~3
 		// where bytesPerSample = 2, channels = 1, and sampleRate = 22050
@@ -862,7 +919,7 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 
 	channel.stream.reset(new MutableLoopAudioStream(audioStream, loop));
 	// TODO: Avoid unnecessary channel conversion
-	channel.converter.reset(Audio::makeRateConverter(channel.stream->getRate(), getRate(), channel.stream->isStereo(), true, false));
+	channel.converter.reset(makeConverter(channel.stream->getRate(), channel.stream->isStereo()));
 
 	// SSCI sets up a decompression buffer here for the audio stream, plus
 	// writes information about the sample to the channel to convert to the
@@ -221,6 +221,44 @@ private:
 	 */
 	int writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateConverter &converter, int16 *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
 
+	/**
+	 * Adds `numSamples` samples from `source` to the 32-bit mixing buffer
+	 * `target`, without clamping.
+	 */
+	typedef void (*MixSamplesFunc)(int32 *target, const int16 *source, const int numSamples);
+
+	/**
+	 * Writes `numSamples` mixed samples from `source` to `target`, clamping
+	 * them to the range of a sample.
+	 */
+	typedef void (*ClampSamplesFunc)(int16 *target, const int32 *source, const int numSamples);
+
+	/**
+	 * The fastest versions of mixSamples and clampSamples supported by the
+	 * CPU.
+	 */
+	MixSamplesFunc _mixSamples;
+	ClampSamplesFunc _clampSamples;
+
+	static void mixSamplesGeneric(int32 *target, const int16 *source, const int numSamples);
+	static void clampSamplesGeneric(int16 *target, const int32 *source, const int numSamples);
+#ifdef SCUMMVM_SSE2
+	static void mixSamplesSSE2(int32 *target, const int16 *source, const int numSamples);
+	static void clampSamplesSSE2(int16 *target, const int32 *source, const int numSamples);
+#endif
+
+	/**
+	 * The buffer where all channels are added together, before being clamped
+	 * into the output buffer.
+	 */
+	Common::Array<int32> _mixBuffer;
+
+	/**
+	 * The buffer holding the audio of the channel being mixed, unless it is
+	 * the monitored channel.
+	 */
+	Common::Array<int16> _channelBuffer;
+
 #pragma mark -
 #pragma mark Channel management
 public:
@@ -299,6 +337,18 @@ private:
 	 */
 	LockList _lockedResourceIds;
 
+	/**
+	 * Rate converters of freed channels, for mono and stereo input. These are
+	 * reused for new channels instead of allocating new converters.
+	 */
+	Common::Array<Audio::RateConverter *> _freeConverters[2];
+
+	/**
+	 * Gets a rate converter from the given input format to the output format
+	 * of the mixer.
+	 */
+	Audio::RateConverter *makeConverter(const int inputRate, const bool inputStereo);
+
 	/**
 	 * Gets the audio channel at the given index.
 	 */
@@ -21,6 +21,7 @@
 
 #include "sci/video/robot_decoder.h"
 #include "common/archive.h"          // for SearchMan
+#include "common/config-manager.h"   // for ConfMan
 #include "common/debug.h"            // for debugC
 #include "common/endian.h"           // for MKTAG
 #include "common/memstream.h"        // for MemoryReadStream
@@ -28,6 +29,7 @@
 #include "common/rational.h"         // for operator*, Rational
 #include "common/str.h"              // for String
 #include "common/stream.h"           // for SeekableReadStream, SeekableReadStreamEndianWrapper
+#include "common/system.h"           // for g_system
 #include "common/textconsole.h"      // for error, warning
 #include "common/types.h"            // for Flag::NO, Flag::YES
 #include "sci/engine/seg_manager.h"  // for SegManager
@@ -353,7 +355,8 @@ RobotDecoder::RobotDecoder(SegManager *segMan) :
 	_segMan(segMan),
 	_status(kRobotStatusUninitialized),
 	_audioBuffer(nullptr),
-	_rawPalette((uint8 *)malloc(kRawPaletteSize)) {}
+	_rawPalette((uint8 *)malloc(kRawPaletteSize)),
+	_lookAheadEnabled(true) {}
 
 RobotDecoder::~RobotDecoder() {
 	close();
@@ -404,6 +407,11 @@ void RobotDecoder::initPlayback() {
 	_previousFrameNo = -1;
 	_currentFrameNo = 0;
 	_status = kRobotStatusPaused;
+	_lookAhead.frameNo = -1;
+	_numFramesRendered = 0;
+	_numFramesDecodedAhead = 0;
+	_totalRenderTime = 0;
+	_maxRenderTime = 0;
 }
 
 void RobotDecoder::initAudio() {
@@ -547,6 +555,7 @@ void RobotDecoder::open(const GuiResourceId robotId, const reg_t plane, const in
 
 	initPlayback();
 
+	_lookAheadEnabled = !ConfMan.hasKey("robot_look_ahead") || ConfMan.getBool("robot_look_ahead");
 	_syncFrame = true;
 	_audioBlockSize = _stream->readUint16();
 	_primerZeroCompressFlag = _stream->readSint16();
@@ -588,6 +597,9 @@ void RobotDecoder::close() {
 	}
 
 	debugC(kDebugLevelVideo, "Closing robot");
+	if (_numFramesRendered) {
+		debugC(kDebugLevelVideo, "Rendered %u frames (%u decoded ahead) in %u ms on average, %u ms at most", _numFramesRendered, _numFramesDecodedAhead, _totalRenderTime / _numFramesRendered, _maxRenderTime);
+	}
 
 	for (CelHandleList::size_type i = 0; i < _celHandles.size(); ++i) {
 		if (_celHandles[i].status == CelHandleInfo::kFrameLifetime) {
@@ -622,6 +634,7 @@ void RobotDecoder::close() {
 	_recordPositions.clear();
 	_celDecompressionBuffer.clear();
 	_doVersion5Scratch.clear();
+	_lookAhead = LookAheadFrame();
 	delete _stream;
 	_stream = nullptr;
 }
@@ -1245,12 +1258,92 @@ void RobotDecoder::doRobot() {
 		_audioList.submitDriverMax();
 	}
 
+	const uint32 startTime = g_system->getMillis();
+	const bool decodedAhead = (_lookAhead.frameNo == _currentFrameNo);
+
 	_delayTime.startTiming();
 	seekToFrame(_currentFrameNo);
 	doVersion5();
 	if (_hasAudio) {
 		_audioList.submitDriverMax();
 	}
+
+	const uint32 renderTime = g_system->getMillis() - startTime;
+	++_numFramesRendered;
+	_totalRenderTime += renderTime;
+	_maxRenderTime = MAX(_maxRenderTime, renderTime);
+	if (decodedAhead) {
+		++_numFramesDecodedAhead;
+		debugC(kDebugLevelVideo, "Frame %d rendered in %u ms, decoded ahead in %u ms", _currentFrameNo, renderTime, _lookAhead.decodeTime);
+	} else {
+		debugC(kDebugLevelVideo, "Frame %d rendered in %u ms", _currentFrameNo, renderTime);
+	}
+}
+
+bool RobotDecoder::decodeAhead() {
+	if (!_lookAheadEnabled || _status != kRobotStatusPlaying) {
+		return false;
+	}
+
+	// Once the current frame has been shown, the next one is usually the
+	// one after it; a newly started robot still has to show its first frame
+	int frameNo;
+	if (_cueForceShowFrame != -1) {
+		frameNo = _cueForceShowFrame;
+	} else if (_currentFrameNo != _previousFrameNo) {
+		frameNo = _currentFrameNo;
+	} else {
+		frameNo = _currentFrameNo + 1;
+	}
+
+	if (frameNo >= _numFramesTotal || frameNo == _lookAhead.frameNo) {
+		return false;
+	}
+
+	const uint32 startTime = g_system->getMillis();
+	const int64 oldPosition = _stream->pos();
+	_lookAhead.frameNo = -1;
+
+	const int videoSize = _videoSizes[frameNo];
+	_lookAhead.videoData.resize(videoSize);
+	seekToFrame(frameNo);
+	if (_stream->read(_lookAhead.videoData.begin(), videoSize) != (uint32)videoSize) {
+		// Leave the error to doVersion5, when the frame is actually needed
+		_stream->clearErr();
+		_stream->seek(oldPosition, SEEK_SET);
+		return false;
+	}
+
+	const byte *videoFrameData = _lookAhead.videoData.begin();
+	const int16 numCels = READ_SCI11ENDIAN_UINT16(videoFrameData);
+	if (numCels <= kScreenItemListSize) {
+		uint totalArea = 0;
+		const byte *rawVideoData = videoFrameData + 2;
+		for (int16 i = 0; i < numCels; ++i) {
+			totalArea += READ_SCI11ENDIAN_UINT16(rawVideoData + 2) * READ_SCI11ENDIAN_UINT16(rawVideoData + 4);
+			rawVideoData += kCelHeaderSize + READ_SCI11ENDIAN_UINT16(rawVideoData + 14);
+		}
+
+		_lookAhead.pixels.resize(totalArea);
+		byte *target = _lookAhead.pixels.begin();
+		rawVideoData = videoFrameData + 2;
+		for (int16 i = 0; i < numCels; ++i) {
+			decompressCel5(target, rawVideoData, _lookAhead.squashedCelBuffer);
+			target += READ_SCI11ENDIAN_UINT16(rawVideoData + 2) * READ_SCI11ENDIAN_UINT16(rawVideoData + 4);
+			rawVideoData += kCelHeaderSize + READ_SCI11ENDIAN_UINT16(rawVideoData + 14);
+		}
+	}
+
+	_lookAhead.hasAudioBlock = false;
+	if (_hasAudio) {
+		_lookAhead.audioData.resize(kRobotZeroCompressSize + _expectedAudioBlockSize);
+		_lookAhead.hasAudioBlock = readAudioDataFromRecord(frameNo, _lookAhead.audioData.begin(), _lookAhead.audioPosition, _lookAhead.audioSize);
+	}
+
+	_stream->seek(oldPosition, SEEK_SET);
+	_lookAhead.frameNo = frameNo;
+	_lookAhead.decodeTime = g_system->getMillis() - startTime;
+	return true;
 }
 
 void RobotDecoder::frameAlmostVisible() {
@@ -1365,13 +1458,20 @@ void RobotDecoder::setPriority(const int16 newPriority) {
 
 void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 	const RobotScreenItemList::size_type oldScreenItemCount = _screenItemList.size();
-	const int videoSize = _videoSizes[_currentFrameNo];
-	_doVersion5Scratch.resize(videoSize);
+	const bool decodedAhead = (_lookAhead.frameNo == _currentFrameNo);
+
+	byte *videoFrameData;
+	if (decodedAhead) {
+		videoFrameData = _lookAhead.videoData.begin();
+	} else {
+		const int videoSize = _videoSizes[_currentFrameNo];
+		_doVersion5Scratch.resize(videoSize);
 
-	byte *videoFrameData = _doVersion5Scratch.begin();
+		videoFrameData = _doVersion5Scratch.begin();
 
-	if (!_stream->read(videoFrameData, videoSize)) {
-		error("RobotDecoder::doVersion5: Read error");
+		if (!_stream->read(videoFrameData, videoSize)) {
+			error("RobotDecoder::doVersion5: Read error");
+		}
 	}
 
 	const RobotScreenItemList::size_type screenItemCount = READ_SCI11ENDIAN_UINT16(videoFrameData);
@@ -1382,9 +1482,17 @@ void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 
 	if (_hasAudio &&
 		(getSciVersion() < SCI_VERSION_3 || shouldSubmitAudio)) {
-		int audioPosition, audioSize;
-		if (readAudioDataFromRecord(_currentFrameNo, _audioBuffer, audioPosition, audioSize)) {
-			_audioList.addBlock(audioPosition, audioSize, _audioBuffer);
+		if (decodedAhead) {
+			// readAudioDataFromRecord did this when the block was read
+			_audioList.submitDriverMax();
+			if (_lookAhead.hasAudioBlock) {
+				_audioList.addBlock(_lookAhead.audioPosition, _lookAhead.audioSize, _lookAhead.audioData.begin());
+			}
+		} else {
+			int audioPosition, audioSize;
+			if (readAudioDataFromRecord(_currentFrameNo, _audioBuffer, audioPosition, audioSize)) {
+				_audioList.addBlock(audioPosition, audioSize, _audioBuffer);
+			}
 		}
 	}
 
@@ -1396,7 +1504,7 @@ void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 		_originalScreenItemY.resize(screenItemCount);
 	}
 
-	createCels5(videoFrameData + 2, screenItemCount, true);
+	createCels5(videoFrameData + 2, screenItemCount, true, decodedAhead ? _lookAhead.pixels.begin() : nullptr);
 	for (RobotScreenItemList::size_type i = 0; i < screenItemCount; ++i) {
 		Common::Point position(_screenItemX[i], _screenItemY[i]);
 
@@ -1449,23 +1557,23 @@ void RobotDecoder::doVersion5(const bool shouldSubmitAudio) {
 	}
 }
 
-void RobotDecoder::createCels5(const byte *rawVideoData, const int16 numCels, const bool usePalette) {
+void RobotDecoder::createCels5(const byte *rawVideoData, const int16 numCels, const bool usePalette, const byte *decodedPixels) {
 	preallocateCelMemory(rawVideoData, numCels);
 	for (int16 i = 0; i < numCels; ++i) {
-		rawVideoData += createCel5(rawVideoData, i, usePalette);
+		const byte *celPixels = decodedPixels;
+		if (decodedPixels) {
+			decodedPixels += READ_SCI11ENDIAN_UINT16(rawVideoData + 2) * READ_SCI11ENDIAN_UINT16(rawVideoData + 4);
+		}
+		rawVideoData += createCel5(rawVideoData, i, usePalette, celPixels);
 	}
 }
 
-uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItemIndex, const bool usePalette) {
-	_verticalScaleFactor = rawVideoData[1];
+uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItemIndex, const bool usePalette, const byte *decodedPixels) {
 	const int16 celWidth = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 2);
 	const int16 celHeight = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 4);
 	const Common::Point celPosition((int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 10),
 									(int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 12));
 	const uint16 dataSize = READ_SCI11ENDIAN_UINT16(rawVideoData + 14);
-	const int16 numDataChunks = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 16);
-
-	rawVideoData += kCelHeaderSize;
 
 	const int16 scriptWidth = g_sci->_gfxFrameout->getScriptWidth();
 	const int16 scriptHeight = g_sci->_gfxFrameout->getScriptHeight();
@@ -1515,14 +1623,38 @@ uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItem
 	assert(bitmap.getHunkPaletteOffset() == (uint32)bitmap.getWidth() * bitmap.getHeight() + SciBitmap::getBitmapHeaderSize());
 	bitmap.setOrigin(origin);
 
+	if (decodedPixels) {
+		Common::copy(decodedPixels, decodedPixels + celWidth * celHeight, bitmap.getPixels());
+	} else {
+		decompressCel5(bitmap.getPixels(), rawVideoData, _celDecompressionBuffer);
+	}
+
+	if (usePalette) {
+		Common::copy(_rawPalette, _rawPalette + kRawPaletteSize, bitmap.getHunkPalette());
+	}
+
+	return kCelHeaderSize + dataSize;
+}
+
+void RobotDecoder::decompressCel5(byte *target, const byte *rawVideoData, ScratchMemory &squashedCelBuffer) {
+	_verticalScaleFactor = rawVideoData[1];
+	const int16 celWidth = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 2);
+	const int16 celHeight = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 4);
+	const int16 numDataChunks = (int16)READ_SCI11ENDIAN_UINT16(rawVideoData + 16);
+
+	rawVideoData += kCelHeaderSize;
+
 	byte *targetBuffer;
 	if (_verticalScaleFactor == 100) {
 		// direct copy to bitmap
-		targetBuffer = bitmap.getPixels();
+		targetBuffer = target;
 	} else {
 		// go through squashed cel decompressor
-		_celDecompressionBuffer.resize(_celDecompressionArea >= celWidth * (celHeight * _verticalScaleFactor / 100));
-		targetBuffer = _celDecompressionBuffer.begin();
+		const uint squashedArea = celWidth * (celHeight * _verticalScaleFactor / 100);
+		if (squashedCelBuffer.size() < squashedArea) {
+			squashedCelBuffer.resize(squashedArea);
+		}
+		targetBuffer = squashedCelBuffer.begin();
 	}
 
 	for (int i = 0; i < numDataChunks; ++i) {
@@ -1549,14 +1681,8 @@ uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItem
 	}
 
 	if (_verticalScaleFactor != 100) {
-		expandCel(bitmap.getPixels(), _celDecompressionBuffer.begin(), celWidth, celHeight);
-	}
-
-	if (usePalette) {
-		Common::copy(_rawPalette, _rawPalette + kRawPaletteSize, bitmap.getHunkPalette());
+		expandCel(target, squashedCelBuffer.begin(), celWidth, celHeight);
 	}
-
-	return kCelHeaderSize + dataSize;
 }
 
 void RobotDecoder::preallocateCelMemory(const byte *rawVideoData, const int16 numCels) {
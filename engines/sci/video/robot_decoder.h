@@ -1149,6 +1149,15 @@ public:
 	 */
 	void frameNowVisible();
 
+	/**
+	 * Reads and decompresses the frame that will most likely be rendered
+	 * next, so that rendering it later only needs to copy the finished cels
+	 * into place. This is called while the engine is idle between frames.
+	 *
+	 * @returns true if a frame was decoded.
+	 */
+	bool decodeAhead();
+
 	/**
 	 * Scales a vertically compressed cel to its original uncompressed
 	 * dimensions.
@@ -1215,16 +1224,23 @@ private:
 	void doVersion5(const bool shouldSubmitAudio = true);
 
 	/**
-	 * Creates screen items for a version 5/6 robot.
+	 * Creates screen items for a version 5/6 robot. If `decodedPixels` is
+	 * given, it holds the already decompressed pixels of all the cels.
 	 */
-	void createCels5(const byte *rawVideoData, const int16 numCels, const bool usePalette);
+	void createCels5(const byte *rawVideoData, const int16 numCels, const bool usePalette, const byte *decodedPixels = nullptr);
 
 	/**
 	 * Creates a single screen item for a cel in a version 5/6 robot.
 	 *
 	 * Returns the size, in bytes, of the raw cel data.
 	 */
-	uint32 createCel5(const byte *rawVideoData, const int16 screenItemIndex, const bool usePalette);
+	uint32 createCel5(const byte *rawVideoData, const int16 screenItemIndex, const bool usePalette, const byte *decodedPixels = nullptr);
+
+	/**
+	 * Decompresses the pixels of the version 5/6 cel whose header starts at
+	 * `rawVideoData` into `target`, unsquashing it if necessary.
+	 */
+	void decompressCel5(byte *target, const byte *rawVideoData, ScratchMemory &squashedCelBuffer);
 
 	/**
 	 * Preallocates memory for the next `numCels` cels in the robot data stream.
@@ -1366,6 +1382,60 @@ private:
 	 * dimensions.
 	 */
 	uint8 _verticalScaleFactor;
+
+	/**
+	 * A frame that was read and decompressed by `decodeAhead` before it was
+	 * due to be rendered.
+	 */
+	struct LookAheadFrame {
+		/**
+		 * The number of the decoded frame, or -1 if there is none.
+		 */
+		int frameNo;
+
+		/**
+		 * The raw video data of the frame.
+		 */
+		ScratchMemory videoData;
+
+		/**
+		 * The decompressed pixels of every cel in the frame, one after the
+		 * other.
+		 */
+		ScratchMemory pixels;
+
+		/**
+		 * Scratch memory for vertically squashed cels.
+		 */
+		ScratchMemory squashedCelBuffer;
+
+		/**
+		 * The audio block of the frame, if `hasAudioBlock` is true.
+		 */
+		ScratchMemory audioData;
+		bool hasAudioBlock;
+		int audioPosition, audioSize;
+
+		/**
+		 * The time it took to decode the frame, in milliseconds.
+		 */
+		uint32 decodeTime;
+
+		LookAheadFrame() : frameNo(-1), hasAudioBlock(false), audioPosition(0), audioSize(0), decodeTime(0) {}
+	};
+
+	LookAheadFrame _lookAhead;
+
+	/**
+	 * Whether frames are decoded ahead of time when the engine is idle.
+	 */
+	bool _lookAheadEnabled;
+
+	/**
+	 * Rendering statistics for the current robot, reported when it is closed.
+	 */
+	uint _numFramesRendered, _numFramesDecodedAhead;
+	uint32 _totalRenderTime, _maxRenderTime;
 };
 
 } // end of namespace Sci
@@ -0,0 +1,110 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "graphics/VectorRendererSpec.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+void VectorRendererSpans::blend32SSE2(uint32 *first, uint32 *last, uint32 color, uint8 alpha, uint32 mask) {
+	const __m128i zero = _mm_setzero_si128();
+	// Two copies of the color, widened to 16 bits per channel and premultiplied
+	const __m128i src = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)color), zero), _mm_set1_epi16(alpha));
+	const __m128i invAlpha = _mm_set1_epi16((short)(256 - alpha));
+	const __m128i outMask = _mm_set1_epi32((int)mask);
+
+	// dst * (256 - alpha) + src * alpha never exceeds 255 * 256, so the
+	// intermediate sums fit in unsigned 16-bit lanes.
+	while (last - first >= 4) {
+		__m128i dst = _mm_loadu_si128((const __m128i *)first);
+		__m128i lo = _mm_unpacklo_epi8(dst, zero);
+		__m128i hi = _mm_unpackhi_epi8(dst, zero);
+
+		lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, invAlpha), src), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, invAlpha), src), 8);
+
+		dst = _mm_and_si128(_mm_packus_epi16(lo, hi), outMask);
+		_mm_storeu_si128((__m128i *)first, dst);
+		first += 4;
+	}
+
+	blend32Generic(first, last, color, alpha, mask);
+}
+
+void VectorRendererSpans::shade16SSE2(uint16 *first, uint16 *last, uint16 keep, int shift, uint16 orBits, uint16 addBits) {
+	const __m128i keepMask = _mm_set1_epi16((short)keep);
+	const __m128i orMask = _mm_set1_epi16((short)orBits);
+	const __m128i add = _mm_set1_epi16((short)addBits);
+	const __m128i count = _mm_cvtsi32_si128(shift);
+
+	while (last - first >= 8) {
+		__m128i p = _mm_loadu_si128((const __m128i *)first);
+		p = _mm_srl_epi16(_mm_and_si128(p, keepMask), count);
+		p = _mm_add_epi16(_mm_or_si128(p, orMask), add);
+		_mm_storeu_si128((__m128i *)first, p);
+		first += 8;
+	}
+
+	shade16Generic(first, last, keep, shift, orBits, addBits);
+}
+
+void VectorRendererSpans::shade32SSE2(uint32 *first, uint32 *last, uint32 keep, int shift, uint32 orBits, uint32 addBits) {
+	const __m128i keepMask = _mm_set1_epi32((int)keep);
+	const __m128i orMask = _mm_set1_epi32((int)orBits);
+	const __m128i add = _mm_set1_epi32((int)addBits);
+	const __m128i count = _mm_cvtsi32_si128(shift);
+
+	while (last - first >= 4) {
+		__m128i p = _mm_loadu_si128((const __m128i *)first);
+		p = _mm_srl_epi32(_mm_and_si128(p, keepMask), count);
+		p = _mm_add_epi32(_mm_or_si128(p, orMask), add);
+		_mm_storeu_si128((__m128i *)first, p);
+		first += 4;
+	}
+
+	shade32Generic(first, last, keep, shift, orBits, addBits);
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
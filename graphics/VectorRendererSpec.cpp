@@ -524,11 +524,60 @@ void colorVFillClip(PixelType *first, PixelType *last, int pitch, PixelType colo
 }
 
 
+VectorRendererSpans::BlendFunc32 VectorRendererSpans::blend32 = VectorRendererSpans::blend32Generic;
+VectorRendererSpans::ShadeFunc16 VectorRendererSpans::shade16 = VectorRendererSpans::shade16Generic;
+VectorRendererSpans::ShadeFunc32 VectorRendererSpans::shade32 = VectorRendererSpans::shade32Generic;
+
+void VectorRendererSpans::blend32Generic(uint32 *first, uint32 *last, uint32 color, uint8 alpha, uint32 mask) {
+	const uint32 invAlpha = 256 - alpha;
+
+	while (first < last) {
+		const uint32 dst = *first;
+		uint32 out = 0;
+		for (int shift = 0; shift < 32; shift += 8) {
+			const uint32 d = (dst >> shift) & 0xFF;
+			const uint32 c = (color >> shift) & 0xFF;
+			out |= ((d * invAlpha + c * alpha) >> 8) << shift;
+		}
+		*first++ = out & mask;
+	}
+}
+
+void VectorRendererSpans::shade16Generic(uint16 *first, uint16 *last, uint16 keep, int shift, uint16 orBits, uint16 addBits) {
+	while (first < last) {
+		*first = (uint16)((((*first & keep) >> shift) | orBits) + addBits);
+		++first;
+	}
+}
+
+void VectorRendererSpans::shade32Generic(uint32 *first, uint32 *last, uint32 keep, int shift, uint32 orBits, uint32 addBits) {
+	while (first < last) {
+		*first = (((*first & keep) >> shift) | orBits) + addBits;
+		++first;
+	}
+}
+
+void VectorRendererSpans::select() {
+	blend32 = blend32Generic;
+	shade16 = shade16Generic;
+	shade32 = shade32Generic;
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+		blend32 = blend32SSE2;
+		shade16 = shade16SSE2;
+		shade32 = shade32SSE2;
+	}
+#endif
+}
+
 VectorRenderer *createRenderer(int mode) {
 #ifdef DISABLE_FANCY_THEMES
 	assert(mode == GUI::ThemeEngine::kGfxStandard);
 #endif
 
+	VectorRendererSpans::select();
+
 	PixelFormat format = g_system->getOverlayFormat();
 	switch (mode) {
 	case GUI::ThemeEngine::kGfxStandard:
@@ -570,6 +619,12 @@ VectorRendererSpec(PixelFormat format) :
 
 	_fgColor = _bgColor = _bevelColor = 0;
 	_gradientStart = _gradientEnd = 0;
+
+	_byteChannels = format.bytesPerPixel == 4 &&
+		format.rLoss == 0 && format.gLoss == 0 && format.bLoss == 0 &&
+		(format.aLoss == 0 || format.aLoss == 8) &&
+		(format.rShift % 8) == 0 && (format.gShift % 8) == 0 &&
+		(format.bShift % 8) == 0 && (format.aShift % 8) == 0;
 }
 
 /****************************
@@ -659,16 +714,19 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
-
+		// The dithering pattern only depends on the column parity
+		PixelType colors[2];
+		for (int oy = 0; oy < 2; oy++) {
 			if ((ox && oy) ||
 				((grad == 2 || grad == 3) && ox && !oy) ||
 				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
+				colors[oy] = _gradCache[curGrad + 1];
 			else
-				*ptr = _gradCache[curGrad];
+				colors[oy] = _gradCache[curGrad];
 		}
+
+		for (int j = 0; j < width; j++)
+			ptr[j] = colors[(x + j) & 1];
 	}
 }
 
@@ -827,10 +885,7 @@ applyScreenShading(GUI::ThemeEngine::ShadingStyle shadingStyle) {
 	if (shadingStyle == GUI::ThemeEngine::kShadingDim) {
 
 		// TODO: Check how this interacts with kFeatureOverlaySupportsAlpha
-		for (int i = 0; i < pixels; ++i) {
-			*ptr = ((*ptr & colorMask) >> 1) | _alphaMask;
-			++ptr;
-		}
+		shadeFill(ptr, ptr + pixels, (PixelType)colorMask, 1, _alphaMask, 0);
 
 	} else if (shadingStyle == GUI::ThemeEngine::kShadingLuminance) {
 		while (pixels--) {
@@ -925,10 +980,7 @@ darkenFill(PixelType *ptr, PixelType *end) {
 
 		mask |= _alphaMask;
 
-		while (ptr != end) {
-			*ptr = ((*ptr & ~mask) >> 2) | _alphaMask;
-			++ptr;
-		}
+		shadeFill(ptr, end, (PixelType)~mask, 2, _alphaMask, 0);
 	} else {
 		// kFeatureOverlaySupportsAlpha
 		// assuming at least 3 alpha bits
@@ -936,11 +988,23 @@ darkenFill(PixelType *ptr, PixelType *end) {
 		mask |= 3 << _format.aShift;
 		PixelType addA = (PixelType)(3 << (_format.aShift + 6 - _format.aLoss));
 
-		while (ptr != end) {
-			// Darken the color, and increase the alpha
-			// (0% -> 75%, 100% -> 100%)
-			*ptr = (PixelType)(((*ptr & ~mask) >> 2) + addA);
-			++ptr;
+		// Darken the color, and increase the alpha
+		// (0% -> 75%, 100% -> 100%)
+		shadeFill(ptr, end, (PixelType)~mask, 2, 0, addA);
+	}
+}
+
+template<typename PixelType>
+inline void VectorRendererSpec<PixelType>::
+shadeFill(PixelType *first, PixelType *last, PixelType keep, int shift, PixelType orBits, PixelType addBits) {
+	if (sizeof(PixelType) == 4) {
+		VectorRendererSpans::shade32((uint32 *)(void *)first, (uint32 *)(void *)last, keep, shift, orBits, addBits);
+	} else if (sizeof(PixelType) == 2) {
+		VectorRendererSpans::shade16((uint16 *)(void *)first, (uint16 *)(void *)last, keep, shift, orBits, addBits);
+	} else {
+		while (first < last) {
+			*first = (PixelType)((((*first & keep) >> shift) | orBits) + addBits);
+			++first;
 		}
 	}
 }
@@ -35,6 +35,45 @@ namespace Graphics {
  * @{
  */
 
+/**
+ * Row kernels shared by all the VectorRendererSpec instances.
+ *
+ * The generic versions are always available. select() replaces them
+ * with SIMD versions when the CPU supports them.
+ */
+struct VectorRendererSpans {
+	/**
+	 * Blends a constant color into a row of 32-bit pixels whose color
+	 * channels are 8 bits wide and byte aligned.
+	 *
+	 * Every byte becomes (dst * (256 - alpha) + src * alpha) >> 8, which
+	 * matches VectorRendererSpec::blendPixelPtr(). The result is then
+	 * masked with @p mask to clear the unused bits.
+	 */
+	typedef void (*BlendFunc32)(uint32 *first, uint32 *last, uint32 color, uint8 alpha, uint32 mask);
+
+	/** Replaces every pixel p of a row with (((p & keep) >> shift) | orBits) + addBits. */
+	typedef void (*ShadeFunc16)(uint16 *first, uint16 *last, uint16 keep, int shift, uint16 orBits, uint16 addBits);
+	typedef void (*ShadeFunc32)(uint32 *first, uint32 *last, uint32 keep, int shift, uint32 orBits, uint32 addBits);
+
+	static BlendFunc32 blend32;
+	static ShadeFunc16 shade16;
+	static ShadeFunc32 shade32;
+
+	static void blend32Generic(uint32 *first, uint32 *last, uint32 color, uint8 alpha, uint32 mask);
+	static void shade16Generic(uint16 *first, uint16 *last, uint16 keep, int shift, uint16 orBits, uint16 addBits);
+	static void shade32Generic(uint32 *first, uint32 *last, uint32 keep, int shift, uint32 orBits, uint32 addBits);
+
+#ifdef SCUMMVM_SSE2
+	static void blend32SSE2(uint32 *first, uint32 *last, uint32 color, uint8 alpha, uint32 mask);
+	static void shade16SSE2(uint16 *first, uint16 *last, uint16 keep, int shift, uint16 orBits, uint16 addBits);
+	static void shade32SSE2(uint32 *first, uint32 *last, uint32 keep, int shift, uint32 orBits, uint32 addBits);
+#endif
+
+	/** Picks the fastest kernels supported by the CPU. */
+	static void select();
+};
+
 /**
  * VectorRendererSpec: Specialized Vector Renderer Class
  *
@@ -287,22 +326,33 @@ protected:
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
 	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
+		if (sizeof(PixelType) == 4 && _byteChannels && alpha != 0xff && first < last) {
+			VectorRendererSpans::blend32((uint32 *)(void *)first, (uint32 *)(void *)last,
+			                             (color & (_redMask | _greenMask | _blueMask)) | _alphaMask, alpha,
+			                             _redMask | _greenMask | _blueMask | _alphaMask);
+			return;
+		}
+
 		while (first < last)
 			blendPixelPtr(first++, color, alpha);
 	}
 
 	inline void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
-		if (_clippingArea.top <= realY && realY < _clippingArea.bottom) {
-			while (first < last) {
-				if (_clippingArea.left <= realX && realX < _clippingArea.right)
-					blendPixelPtr(first++, color, alpha);
-				else
-					++first;
-				++realX;
-			}
-		}
+		if (realY < _clippingArea.top || realY >= _clippingArea.bottom)
+			return;
+
+		// Clip in pixels first, so that no pointer outside the row is formed
+		const int start = MAX<int>(_clippingArea.left - realX, 0);
+		const int end = MIN<int>(last - first, _clippingArea.right - realX);
+		if (end <= start)
+			return;
+
+		blendFill(first + start, first + end, color, alpha);
 	}
 
+	/** Replaces every pixel p of a row with (((p & keep) >> shift) | orBits) + addBits. */
+	void shadeFill(PixelType *first, PixelType *last, PixelType keep, int shift, PixelType orBits, PixelType addBits);
+
 	void darkenFill(PixelType *first, PixelType *last);
 	void darkenFillClip(PixelType *first, PixelType *last, int x, int y);
 
@@ -321,6 +371,9 @@ protected:
 	Common::Array<int> _gradIndexes;
 
 	PixelType _bevelColor;
+
+	/** Whether the color channels are 8 bits wide and byte aligned, as expected by VectorRendererSpans::blend32. */
+	bool _byteChannels;
 };
 
 
@@ -23,10 +23,69 @@
 #include "graphics/managed_surface.h"
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/util.h"
 
 namespace Graphics {
 
+/**
+ * Results of string measurements for fonts which enabled it with
+ * Font::enableTextRunCache(). Each table is simply flushed once it grows
+ * past its limit, the working set of a dialog or a text window is much
+ * smaller than that.
+ */
+template<class StringType>
+struct TextRunTables {
+	enum {
+		kMaxWidths = 2048,
+		kMaxWraps = 256
+	};
+
+	struct WrapKey {
+		StringType str;
+		int maxWidth;
+		int initWidth;
+		uint32 mode;
+
+		bool operator==(const WrapKey &other) const {
+			return maxWidth == other.maxWidth && initWidth == other.initWidth && mode == other.mode && str == other.str;
+		}
+	};
+
+	struct WrapKeyHash {
+		uint operator()(const WrapKey &key) const {
+			return Common::Hash<StringType>()(key.str) ^ (key.maxWidth * 31 + key.initWidth * 7 + key.mode);
+		}
+	};
+
+	struct WrapEntry {
+		Common::Array<StringType> lines;
+		Common::Array<bool> lineContinuation;
+		int width;
+	};
+
+	Common::HashMap<StringType, int> widths;
+	Common::HashMap<WrapKey, WrapEntry, WrapKeyHash> wraps;
+};
+
+struct TextRunCache {
+	TextRunTables<Common::String> strings;
+	TextRunTables<Common::U32String> u32Strings;
+
+	TextRunTables<Common::String> &get(const Common::String &) { return strings; }
+	TextRunTables<Common::U32String> &get(const Common::U32String &) { return u32Strings; }
+};
+
+Font::~Font() {
+	delete _runCache;
+}
+
+void Font::enableTextRunCache() {
+	if (!_runCache)
+		_runCache = new TextRunCache();
+}
+
 int Font::getFontAscent() const {
 	return -1;
 }
@@ -109,6 +168,50 @@ int getStringWidthImpl(const Font &font, const StringType &str) {
 	return space;
 }
 
+template<class StringType>
+int getCachedStringWidth(const Font &font, TextRunCache *cache, const StringType &str) {
+	if (!cache)
+		return getStringWidthImpl(font, str);
+
+	TextRunTables<StringType> &tables = cache->get(str);
+
+	typename Common::HashMap<StringType, int>::const_iterator entry = tables.widths.find(str);
+	if (entry != tables.widths.end())
+		return entry->_value;
+
+	if (tables.widths.size() >= TextRunTables<StringType>::kMaxWidths)
+		tables.widths.clear(true);
+
+	int width = getStringWidthImpl(font, str);
+	tables.widths[str] = width;
+	return width;
+}
+
+bool drawRunImpl(const Font &font, Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color, bool allowCharClipping) {
+	// Runs are only handled for Unicode strings
+	return false;
+}
+
+bool drawRunImpl(const Font &font, ManagedSurface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color, bool allowCharClipping) {
+	return false;
+}
+
+bool drawRunImpl(const Font &font, Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color, bool allowCharClipping) {
+	return font.drawRun(dst, str, x, y, leftX, rightX, color, nullptr, allowCharClipping);
+}
+
+bool drawRunImpl(const Font &font, ManagedSurface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color, bool allowCharClipping) {
+	uint32 transColor = 0;
+	if (dst->hasTransparentColor())
+		transColor = dst->getTransparentColor();
+
+	if (!font.drawRun(dst->surfacePtr(), str, x, y, leftX, rightX, color, dst->hasTransparentColor() ? &transColor : nullptr, allowCharClipping))
+		return false;
+
+	dst->addDirtyRect(font.getBoundingBox(str, x, y));
+	return true;
+}
+
 template<class SurfaceType, class StringType>
 void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, int x, int y, int w, uint32 color, TextAlign align, int deltax, bool alpha, bool allowCharClipping) {
 	// The logic in getBoundingImpl is the same as we use here. In case we
@@ -124,6 +227,9 @@ void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, i
 		x = x + w - width;
 	x += deltax;
 
+	if (!alpha && drawRunImpl(font, dst, str, x, y, leftX, rightX, color, allowCharClipping))
+		return;
+
 	typename StringType::unsigned_type last = 0;
 	for (typename StringType::const_iterator i = str.begin(), end = str.end(); i != end; ++i) {
 		const typename StringType::unsigned_type cur = *i;
@@ -347,6 +453,42 @@ int wordWrapTextImpl(const Font &font, const StringType &str, int maxWidth, Comm
 	return wrapper.actualMaxLineWidth;
 }
 
+template<class StringType>
+int cachedWordWrapText(const Font &font, TextRunCache *cache, const StringType &str, int maxWidth, Common::Array<StringType> &lines, Common::Array<bool> &lineContinuation, int initWidth, uint32 mode) {
+	// Wrapping appends to the given arrays, except in even width lines mode
+	// which may clear them. Only cache the common case of empty arrays so
+	// both behave the same.
+	if (!cache || !lines.empty() || !lineContinuation.empty())
+		return wordWrapTextImpl(font, str, maxWidth, lines, lineContinuation, initWidth, mode);
+
+	TextRunTables<StringType> &tables = cache->get(str);
+
+	typename TextRunTables<StringType>::WrapKey key;
+	key.str = str;
+	key.maxWidth = maxWidth;
+	key.initWidth = initWidth;
+	key.mode = mode;
+
+	typename Common::HashMap<typename TextRunTables<StringType>::WrapKey, typename TextRunTables<StringType>::WrapEntry, typename TextRunTables<StringType>::WrapKeyHash>::const_iterator entry = tables.wraps.find(key);
+	if (entry != tables.wraps.end()) {
+		lines = entry->_value.lines;
+		lineContinuation = entry->_value.lineContinuation;
+		return entry->_value.width;
+	}
+
+	if (tables.wraps.size() >= TextRunTables<StringType>::kMaxWraps)
+		tables.wraps.clear(true);
+
+	int width = wordWrapTextImpl(font, str, maxWidth, lines, lineContinuation, initWidth, mode);
+
+	typename TextRunTables<StringType>::WrapEntry &newEntry = tables.wraps[key];
+	newEntry.lines = lines;
+	newEntry.lineContinuation = lineContinuation;
+	newEntry.width = width;
+
+	return width;
+}
+
 template<typename StringType>
 StringType handleEllipsis(const Font &font, const StringType &input, int w) {
 	StringType s = input;
@@ -468,11 +610,11 @@ Common::Rect Font::getBoundingBox(const Common::U32String &input, int x, int y,
 }
 
 int Font::getStringWidth(const Common::String &str) const {
-	return getStringWidthImpl(*this, str);
+	return getCachedStringWidth(*this, _runCache, str);
 }
 
 int Font::getStringWidth(const Common::U32String &str) const {
-	return getStringWidthImpl(*this, str);
+	return getCachedStringWidth(*this, _runCache, str);
 }
 
 void Font::drawChar(ManagedSurface *dst, uint32 chr, int x, int y, uint32 color) const {
@@ -562,16 +704,16 @@ void Font::drawAlphaString(ManagedSurface *dst, const Common::U32String &str, in
 
 int Font::wordWrapText(const Common::String &str, int maxWidth, Common::Array<Common::String> &lines, int initWidth, uint32 mode) const {
 	Common::Array<bool> dummyLineContinuation;
-	return wordWrapTextImpl(*this, str, maxWidth, lines, dummyLineContinuation, initWidth, mode);
+	return cachedWordWrapText(*this, _runCache, str, maxWidth, lines, dummyLineContinuation, initWidth, mode);
 }
 
 int Font::wordWrapText(const Common::U32String &str, int maxWidth, Common::Array<Common::U32String> &lines, int initWidth, uint32 mode) const {
 	Common::Array<bool> dummyLineContinuation;
-	return wordWrapTextImpl(*this, str, maxWidth, lines, dummyLineContinuation, initWidth, mode);
+	return cachedWordWrapText(*this, _runCache, str, maxWidth, lines, dummyLineContinuation, initWidth, mode);
 }
 
 int Font::wordWrapText(const Common::U32String &str, int maxWidth, Common::Array<Common::U32String> &lines, Common::Array<bool> &lineContinuation, int initWidth, uint32 mode) const {
-	return wordWrapTextImpl(*this, str, maxWidth, lines, lineContinuation, initWidth, mode);
+	return cachedWordWrapText(*this, _runCache, str, maxWidth, lines, lineContinuation, initWidth, mode);
 }
 
 TextAlign convertTextAlignH(TextAlign alignH, bool rtl) {
@@ -43,6 +43,7 @@ namespace Graphics {
 
 struct Surface;
 class ManagedSurface;
+struct TextRunCache;
 
 /** Text alignment modes. */
 enum TextAlign {
@@ -82,8 +83,11 @@ TextAlign convertTextAlignH(TextAlign alignH, bool rtl);
  */
 class Font {
 public:
-	Font() {}
-	virtual ~Font() {}
+	Font() : _runCache(nullptr) {}
+	Font(const Font &) : _runCache(nullptr) {}
+	virtual ~Font();
+
+	Font &operator=(const Font &) { return *this; }
 
 	/**
 	 * Return the height of the font.
@@ -242,6 +246,25 @@ public:
 	virtual void drawAlphaChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const;
 	virtual void drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint32 color) const;
 
+	/**
+	 * Draw a whole run of characters at once.
+	 *
+	 * This is used by drawString() for fonts which can render a complete
+	 * string more efficiently than character by character. The run is
+	 * already aligned, @p x is the position of its first character.
+	 * Characters are only drawn if they fit between @p leftX and @p rightX,
+	 * following the same rules as drawString().
+	 *
+	 * @param transparentColor  Color of the destination surface to treat as
+	 *                          transparent, can be nullptr.
+	 *
+	 * @return True if the run was drawn, false if the caller should fall
+	 *         back to drawing the characters one by one. The default
+	 *         implementation always returns false.
+	 */
+	virtual bool drawRun(Surface *dst, const Common::U32String &run, int x, int y, int leftX, int rightX, uint32 color,
+	                     const uint32 *transparentColor, bool allowCharClipping) const { return false; }
+
 	/** @overload */
 
 	/**
@@ -358,6 +381,17 @@ public:
 	 */
 	void scaleSingleGlyph(Surface *scaleSurface, int *grayScaleMap, int grayScaleMapSize, int width, int height, int xOffset, int yOffset, int grayLevel, int chr, int srcheight, int srcwidth, float scale) const;
 
+protected:
+	/**
+	 * Remember the results of getStringWidth() and wordWrapText().
+	 *
+	 * Meant for fonts where measuring is expensive, such as TrueType fonts.
+	 * The metrics of the font must not change once this is enabled.
+	 */
+	void enableTextRunCache();
+
+private:
+	mutable TextRunCache *_runCache;
 };
 /** @} */
 } // End of namespace Graphics
@@ -186,6 +186,9 @@ public:
 	void drawAlphaChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const override;
 	void drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint32 color) const override;
 
+	bool drawRun(Surface *dst, const Common::U32String &run, int x, int y, int leftX, int rightX, uint32 color,
+	             const uint32 *transparentColor, bool allowCharClipping) const override;
+
 private:
 	bool _initialized;
 	FT_StreamRec_ _stream;
@@ -202,6 +205,7 @@ private:
 		int xOffset, yOffset;
 		int advance;
 		FT_UInt slot;
+		bool ownsImage; ///< Whether image has its own pixels instead of pointing into the atlas
 	};
 
 	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
@@ -210,6 +214,47 @@ private:
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
+	/**
+	 * Glyph bitmaps are packed into shared atlas pages, filled shelf by
+	 * shelf, instead of being allocated one by one.
+	 */
+	struct AtlasPage {
+		Surface surface;
+		int shelfX, shelfY, shelfHeight;
+	};
+
+	mutable Common::Array<AtlasPage *> _atlas;
+	int _atlasPageSize;
+	void allocateGlyphImage(Glyph &glyph, int w, int h) const;
+
+	/**
+	 * Pre-composed coverage of complete strings, so drawing them again
+	 * only needs a single blit.
+	 *
+	 * Blending a glyph depends on what the glyphs before it left in the
+	 * destination, so runs where glyphs overlap (kerning, italics) cannot be
+	 * merged into a single coverage. They are remembered without coverage
+	 * and always drawn character by character.
+	 */
+	struct Run {
+		bool overlaps;
+		Surface coverage;
+		int xOffset, yOffset; ///< Position of the coverage relative to the pen start
+		int minRight;         ///< Leftmost right edge of the character boxes
+		int maxRight;         ///< Rightmost right edge of the character boxes
+	};
+
+	enum {
+		kMaxRunLength = 256,
+		kMaxRunCachePixels = 1024 * 1024
+	};
+
+	typedef Common::HashMap<Common::U32String, Run> RunCache;
+	mutable RunCache _runs;
+	mutable uint _runCachePixels;
+	bool cacheRun(Run &run, const Common::U32String &str) const;
+	void clearRunCache() const;
+
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
 	int computePointSize(int size, TTFSizeMode sizeMode) const;
@@ -217,6 +262,8 @@ private:
 	int computePointSizeFromHeaders(int height) const;
 	void drawCharIntern(Surface *dst, uint32 chr, int x, int y, uint32 color,
 		const uint32 *transparentColor, bool alpha) const;
+	void blitCoverage(Surface *dst, const Surface &coverage, int x, int y, uint32 color,
+		const uint32 *transparentColor, bool alpha) const;
 
 	FT_Int32 _loadFlags;
 	FT_Render_Mode _renderMode;
@@ -230,7 +277,7 @@ TTFFont::TTFFont()
 	: _initialized(false), _stream(), _face(), _ttfFile(0), _width(0), _height(0), _ascent(0),
 	  _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
 	  _hasKerning(false), _allowLateCaching(false), _fakeBold(false), _fakeItalic(false),
-	  _disposeAfterUse(DisposeAfterUse::NO) {
+	  _disposeAfterUse(DisposeAfterUse::NO), _atlasPageSize(0), _runCachePixels(0) {
 }
 
 TTFFont::~TTFFont() {
@@ -241,8 +288,17 @@ TTFFont::~TTFFont() {
 			delete _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
+		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i) {
+			if (i->_value.ownsImage)
+				i->_value.image.free();
+		}
+
+		for (uint i = 0; i < _atlas.size(); ++i) {
+			_atlas[i]->surface.free();
+			delete _atlas[i];
+		}
+
+		clearRunCache();
 
 		_initialized = false;
 	}
@@ -380,6 +436,9 @@ bool TTFFont::load(Common::SeekableReadStream *ttfFile, DisposeAfterUse::Flag di
 		_loadFlags |= FT_LOAD_NO_BITMAP;
 	}
 
+	// Enough for the ISO-8859-1 range of a typical font in a single page
+	_atlasPageSize = CLIP(_height * 16, 256, 1024);
+
 	if (!mapping) {
 		// Allow loading of all unicode characters.
 		_allowLateCaching = true;
@@ -422,6 +481,7 @@ bool TTFFont::load(Common::SeekableReadStream *ttfFile, DisposeAfterUse::Flag di
 		return false;
 	} else {
 		_initialized = true;
+		enableTextRunCache();
 		// At this point we get ownership of _ttfFile
 		return true;
 	}
@@ -719,7 +779,7 @@ void TTFFont::drawAlphaChar(ManagedSurface *dst, uint32 chr, int x, int y, uint3
 	dst->addDirtyRect(charBox);
 }
 
-void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 color,
+void TTFFont::drawCharIntern(Surface *dst, uint32 chr, int x, int y, uint32 color,
 		const uint32 *transparentColor, bool alpha) const {
 	assureCached(chr);
 	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
@@ -727,19 +787,20 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 		return;
 
 	const Glyph &glyph = glyphEntry->_value;
+	blitCoverage(dst, glyph.image, x + glyph.xOffset, y + glyph.yOffset, color, transparentColor, alpha);
+}
 
-	x += glyph.xOffset;
-	y += glyph.yOffset;
-
+void TTFFont::blitCoverage(Surface *dst, const Surface &coverage, int x, int y, uint32 color,
+		const uint32 *transparentColor, bool alpha) const {
 	if (x > dst->w)
 		return;
 	if (y > dst->h)
 		return;
 
-	int w = glyph.image.w;
-	int h = glyph.image.h;
+	int w = coverage.w;
+	int h = coverage.h;
 
-	const uint8 *srcPos = (const uint8 *)glyph.image.getPixels();
+	const uint8 *srcPos = (const uint8 *)coverage.getPixels();
 
 	// Make sure we are not drawing outside the screen bounds
 	if (x < 0) {
@@ -755,7 +816,7 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 		return;
 
 	if (y < 0) {
-		srcPos -= y * glyph.image.pitch;
+		srcPos -= y * coverage.pitch;
 		h += y;
 		y = 0;
 	}
@@ -770,11 +831,11 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 
 	if (alpha) {
 		if (dst->format.bytesPerPixel == 1) {
-			renderAlphaGlyph<uint8>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint8>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format);
 		} else if (dst->format.bytesPerPixel == 2) {
-			renderAlphaGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint16>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format);
 		} else if (dst->format.bytesPerPixel == 4) {
-			renderAlphaGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format);
+			renderAlphaGlyph<uint32>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format);
 		}
 	} else {
 		if (dst->format.isCLUT8()) {
@@ -793,16 +854,138 @@ void TTFFont::drawCharIntern(Surface * dst, uint32 chr, int x, int y, uint32 col
 				}
 
 				dstPos += dst->pitch;
-				srcPos += glyph.image.pitch;
+				srcPos += coverage.pitch;
 			}
 		} else if (dst->format.bytesPerPixel == 1) {
-			renderGlyph<uint8>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint8>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format, transparentColor);
 		} else if (dst->format.bytesPerPixel == 2) {
-			renderGlyph<uint16>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint16>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format, transparentColor);
 		} else if (dst->format.bytesPerPixel == 4) {
-			renderGlyph<uint32>(dstPos, dst->pitch, srcPos, glyph.image.pitch, w, h, color, dst->format, transparentColor);
+			renderGlyph<uint32>(dstPos, dst->pitch, srcPos, coverage.pitch, w, h, color, dst->format, transparentColor);
+		}
+	}
+}
+
+bool TTFFont::drawRun(Surface *dst, const Common::U32String &run, int x, int y, int leftX, int rightX, uint32 color,
+		const uint32 *transparentColor, bool allowCharClipping) const {
+	// Single characters are not worth it, and the 1Bpp path thresholds the
+	// coverage of every glyph on its own, so it has to stay per character.
+	if (run.size() < 2 || run.size() > kMaxRunLength || dst->format.bytesPerPixel == 1)
+		return false;
+
+	RunCache::const_iterator entry = _runs.find(run);
+	if (entry == _runs.end()) {
+		Run newRun;
+		if (!cacheRun(newRun, run))
+			return false;
+
+		// Runs without coverage still take some memory
+		const uint pixels = MAX<uint>(newRun.coverage.w * newRun.coverage.h, run.size());
+		if (_runCachePixels + pixels > kMaxRunCachePixels)
+			clearRunCache();
+
+		_runCachePixels += pixels;
+		_runs[run] = newRun;
+		entry = _runs.find(run);
+	}
+
+	const Run &cached = entry->_value;
+	if (cached.overlaps)
+		return false;
+
+	// Let the caller handle partially visible runs character by character
+	if (x + cached.minRight < leftX)
+		return false;
+	if (!allowCharClipping && x + cached.maxRight > rightX)
+		return false;
+
+	blitCoverage(dst, cached.coverage, x + cached.xOffset, y + cached.yOffset, color, transparentColor, false);
+	return true;
+}
+
+bool TTFFont::cacheRun(Run &run, const Common::U32String &str) const {
+	// This follows the character placement of Font::drawString
+	Common::Rect bbox;
+	bool first = true;
+	int x = 0;
+	uint32 last = 0;
+
+	run.minRight = 0x7FFFFFFF;
+	run.maxRight = -0x7FFFFFFF;
+
+	for (uint i = 0; i < str.size(); ++i) {
+		const uint32 cur = str[i];
+		x += getKerningOffset(last, cur);
+		last = cur;
+
+		Common::Rect charBox = getBoundingBox(cur);
+		run.minRight = MIN<int>(run.minRight, x + charBox.right);
+		run.maxRight = MAX<int>(run.maxRight, x + charBox.right);
+
+		if (!charBox.isEmpty()) {
+			charBox.translate(x, 0);
+			if (first) {
+				bbox = charBox;
+				first = false;
+			} else {
+				bbox.extend(charBox);
+			}
+		}
+
+		x += getCharWidth(cur);
+	}
+
+	if (bbox.width() > 4096 || bbox.height() > 1024)
+		return false;
+
+	run.overlaps = false;
+	run.xOffset = bbox.left;
+	run.yOffset = bbox.top;
+	run.coverage.create(bbox.width(), bbox.height(), PixelFormat::createFormatCLUT8());
+
+	x = 0;
+	last = 0;
+
+	for (uint i = 0; i < str.size(); ++i) {
+		const uint32 cur = str[i];
+		x += getKerningOffset(last, cur);
+		last = cur;
+
+		GlyphCache::const_iterator glyphEntry = _glyphs.find(cur);
+		if (glyphEntry != _glyphs.end()) {
+			const Glyph &glyph = glyphEntry->_value;
+
+			for (int gy = 0; gy < glyph.image.h; ++gy) {
+				const uint8 *src = (const uint8 *)glyph.image.getBasePtr(0, gy);
+				uint8 *dst = (uint8 *)run.coverage.getBasePtr(x + glyph.xOffset - bbox.left, glyph.yOffset + gy - bbox.top);
+
+				for (int gx = 0; gx < glyph.image.w; ++gx) {
+					if (!src[gx])
+						continue;
+
+					if (dst[gx]) {
+						run.overlaps = true;
+						run.coverage.free();
+						return true;
+					}
+
+					dst[gx] = src[gx];
+				}
+			}
 		}
+
+		x += getCharWidth(cur);
 	}
+
+	return true;
+}
+
+void TTFFont::clearRunCache() const {
+	for (RunCache::iterator i = _runs.begin(), end = _runs.end(); i != end; ++i)
+		i->_value.coverage.free();
+
+	_runs.clear();
+	_runCachePixels = 0;
 }
 
 bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
@@ -870,7 +1053,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	}
 
 
-	glyph.image.create(bitmap->width, bitmap->rows, PixelFormat::createFormatCLUT8());
+	allocateGlyphImage(glyph, bitmap->width, bitmap->rows);
 
 	const uint8 *src = bitmap->buffer;
 	int srcPitch = bitmap->pitch;
@@ -885,6 +1068,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	case FT_PIXEL_MODE_MONO:
 		for (int y = 0; y < (int)bitmap->rows; ++y) {
 			const uint8 *curSrc = src;
+			uint8 *curDst = dst;
 			uint8 mask = 0;
 
 			for (int x = 0; x < (int)bitmap->width; ++x) {
@@ -892,12 +1076,13 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					*curDst = 255;
 
 				mask <<= 1;
-				++dst;
+				++curDst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
 		break;
@@ -912,7 +1097,8 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 
 	default:
 		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap->pixel_mode);
-		glyph.image.free();
+		if (glyph.ownsImage)
+			glyph.image.free();
 		return false;
 	}
 
@@ -925,6 +1111,36 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	return true;
 }
 
+void TTFFont::allocateGlyphImage(Glyph &glyph, int w, int h) const {
+	if (w == 0 || h == 0 || w > _atlasPageSize || h > _atlasPageSize) {
+		glyph.image.create(w, h, PixelFormat::createFormatCLUT8());
+		glyph.ownsImage = true;
+		return;
+	}
+
+	AtlasPage *page = _atlas.empty() ? nullptr : _atlas.back();
+
+	// Start a new shelf when the current one is full
+	if (page && page->shelfX + w > page->surface.w) {
+		page->shelfY += page->shelfHeight;
+		page->shelfX = 0;
+		page->shelfHeight = 0;
+	}
+
+	if (!page || page->shelfY + h > page->surface.h) {
+		page = new AtlasPage();
+		page->surface.create(_atlasPageSize, _atlasPageSize, PixelFormat::createFormatCLUT8());
+		page->shelfX = page->shelfY = page->shelfHeight = 0;
+		_atlas.push_back(page);
+	}
+
+	glyph.image = page->surface.getSubArea(Common::Rect(page->shelfX, page->shelfY, page->shelfX + w, page->shelfY + h));
+	glyph.ownsImage = false;
+
+	page->shelfX += w;
+	page->shelfHeight = MAX(page->shelfHeight, h);
+}
+
 void TTFFont::assureCached(uint32 chr) const {
 	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
 		return;
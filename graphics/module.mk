@@ -221,7 +221,8 @@ MODULE_OBJS += \
 endif
 ifdef SCUMMVM_SSE2
 MODULE_OBJS += \
-	blit/blit-sse2.o
+	blit/blit-sse2.o \
+	VectorRendererSpec-sse2.o
 endif
 ifdef SCUMMVM_AVX2
 MODULE_OBJS += \
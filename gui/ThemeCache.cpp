@@ -0,0 +1,661 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "base/version.h"
+
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/endian.h"
+#include "common/fs.h"
+#include "common/md5.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "graphics/VectorRenderer.h"
+
+#include "gui/ThemeCache.h"
+
+namespace GUI {
+
+enum {
+	kThemeCacheTag = MKTAG('S', 'T', 'X', 'C'),
+	kThemeCacheVersion = 1
+};
+
+ThemeCache::ThemeCache() : _recorder(nullptr) {
+}
+
+ThemeCache::~ThemeCache() {
+	delete _recorder;
+}
+
+Common::String ThemeCache::makeKey(const Common::String &themeId, const Common::String &digest, int w, int h, float scale) {
+	return Common::String::format("%s|%d|%s|%s|%dx%d@%d", gScummVMFullVersion, kThemeCacheVersion,
+		themeId.c_str(), digest.c_str(), w, h, (int)(scale * 1000));
+}
+
+/**********************************************************
+ * Recording
+ *********************************************************/
+void ThemeCache::beginRecording() {
+	delete _recorder;
+	_recorder = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES);
+}
+
+void ThemeCache::commitRecording(const Common::String &key) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpEnd);
+
+	Buffer data(_recorder->getData(), _recorder->size());
+
+	delete _recorder;
+	_recorder = nullptr;
+
+	store(key, data);
+	saveToDisk(key, data);
+}
+
+void ThemeCache::abortRecording() {
+	delete _recorder;
+	_recorder = nullptr;
+}
+
+void ThemeCache::writeString(const Common::String &str) {
+	_recorder->writeUint16LE(str.size());
+	_recorder->writeString(str);
+}
+
+Common::String ThemeCache::readString(Common::ReadStream &stream) {
+	uint16 len = stream.readUint16LE();
+	return stream.readString(0, len);
+}
+
+void ThemeCache::recordStoreFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpStoreFontNames);
+	_recorder->writeSint16LE(textId);
+	writeString(language);
+	writeString(file);
+	writeString(scalableFile);
+	_recorder->writeSint32LE(pointsize);
+}
+
+void ThemeCache::recordAddFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddFont);
+	_recorder->writeSint16LE(textId);
+	writeString(language);
+	writeString(file);
+	writeString(scalableFile);
+	_recorder->writeSint32LE(pointsize);
+}
+
+void ThemeCache::recordAddTextColor(TextColor colorId, int r, int g, int b) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddTextColor);
+	_recorder->writeSint16LE(colorId);
+	_recorder->writeByte(r);
+	_recorder->writeByte(g);
+	_recorder->writeByte(b);
+}
+
+void ThemeCache::recordCreateCursor(const Common::String &filename, int hotspotX, int hotspotY, ThemeEngine::CursorType type) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpCreateCursor);
+	writeString(filename);
+	_recorder->writeSint32LE(hotspotX);
+	_recorder->writeSint32LE(hotspotY);
+	_recorder->writeByte(type);
+}
+
+void ThemeCache::recordAddBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddBitmap);
+	writeString(filename);
+	writeString(scalableFile);
+	_recorder->writeSint32LE(width);
+	_recorder->writeSint32LE(height);
+}
+
+void ThemeCache::recordAddTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddTextData);
+	writeString(drawDataId);
+	_recorder->writeSint16LE(textId);
+	_recorder->writeSint16LE(colorId);
+	_recorder->writeSint16LE(alignH);
+	_recorder->writeSint16LE(alignV);
+}
+
+void ThemeCache::recordAddDrawData(const Common::String &data, bool cached) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddDrawData);
+	writeString(data);
+	_recorder->writeByte(cached);
+}
+
+void ThemeCache::recordAddDrawStep(const Common::String &drawDataId, const Common::String &function, const Common::String &blitFile, const Graphics::DrawStep &step) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddDrawStep);
+	writeString(drawDataId);
+	writeString(function);
+	writeString(blitFile);
+
+	const Graphics::DrawStep::Color *colors[] = {
+		&step.fgColor, &step.bgColor, &step.gradColor1, &step.gradColor2, &step.bevelColor
+	};
+
+	for (int i = 0; i < ARRAYSIZE(colors); ++i) {
+		_recorder->writeByte(colors[i]->r);
+		_recorder->writeByte(colors[i]->g);
+		_recorder->writeByte(colors[i]->b);
+		_recorder->writeByte(colors[i]->set);
+	}
+
+	_recorder->writeByte(step.alphaType);
+	_recorder->writeByte(step.autoWidth);
+	_recorder->writeByte(step.autoHeight);
+	_recorder->writeSint16LE(step.x);
+	_recorder->writeSint16LE(step.y);
+	_recorder->writeSint16LE(step.w);
+	_recorder->writeSint16LE(step.h);
+
+	const Common::Rect *rects[] = { &step.padding, &step.clip };
+	for (int i = 0; i < ARRAYSIZE(rects); ++i) {
+		_recorder->writeSint16LE(rects[i]->left);
+		_recorder->writeSint16LE(rects[i]->top);
+		_recorder->writeSint16LE(rects[i]->right);
+		_recorder->writeSint16LE(rects[i]->bottom);
+	}
+
+	_recorder->writeByte(step.xAlign);
+	_recorder->writeByte(step.yAlign);
+	_recorder->writeByte(step.shadow);
+	_recorder->writeByte(step.stroke);
+	_recorder->writeByte(step.factor);
+	_recorder->writeByte(step.radius);
+	_recorder->writeByte(step.bevel);
+	_recorder->writeByte(step.fillMode);
+	_recorder->writeByte(step.shadowFillMode);
+	_recorder->writeUint32LE(step.extraData);
+	_recorder->writeUint32LE(step.scale);
+	_recorder->writeUint32LE(step.shadowIntensity);
+	_recorder->writeByte(step.autoscale);
+}
+
+void ThemeCache::recordSetVar(const Common::String &name, int val) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpSetVar);
+	writeString(name);
+	_recorder->writeSint32LE(val);
+}
+
+void ThemeCache::recordAddDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddDialog);
+	writeString(name);
+	writeString(overlays);
+	_recorder->writeSint16LE(maxWidth);
+	_recorder->writeSint16LE(maxHeight);
+	_recorder->writeSint32LE(inset);
+}
+
+void ThemeCache::recordAddLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddLayout);
+	_recorder->writeByte(type);
+	_recorder->writeSint32LE(spacing);
+	_recorder->writeByte(itemAlign);
+}
+
+void ThemeCache::recordAddWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddWidget);
+	writeString(name);
+	writeString(type);
+	_recorder->writeSint32LE(w);
+	_recorder->writeSint32LE(h);
+	_recorder->writeSint16LE(align);
+	_recorder->writeByte(useRTL);
+}
+
+void ThemeCache::recordAddImportedLayout(const Common::String &name) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddImportedLayout);
+	writeString(name);
+}
+
+void ThemeCache::recordAddSpace(int size) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddSpace);
+	_recorder->writeSint32LE(size);
+}
+
+void ThemeCache::recordAddPadding(int16 l, int16 r, int16 t, int16 b) {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpAddPadding);
+	_recorder->writeSint16LE(l);
+	_recorder->writeSint16LE(r);
+	_recorder->writeSint16LE(t);
+	_recorder->writeSint16LE(b);
+}
+
+void ThemeCache::recordCloseLayout() {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpCloseLayout);
+}
+
+void ThemeCache::recordCloseDialog() {
+	if (!_recorder)
+		return;
+
+	_recorder->writeByte(kOpCloseDialog);
+}
+
+/**********************************************************
+ * Lookup
+ *********************************************************/
+const ThemeCache::Buffer *ThemeCache::lookup(const Common::String &key) {
+	if (_entries.contains(key)) {
+		touch(key);
+	} else {
+		Buffer data;
+		if (!loadFromDisk(key, data))
+			return nullptr;
+
+		store(key, data);
+	}
+
+	return &_entries[key];
+}
+
+void ThemeCache::store(const Common::String &key, const Buffer &data) {
+	_entries[key] = data;
+	touch(key);
+
+	while (_lru.size() > kMaxEntries) {
+		_entries.erase(_lru.back());
+		_lru.pop_back();
+	}
+}
+
+void ThemeCache::touch(const Common::String &key) {
+	_lru.remove(key);
+	_lru.push_front(key);
+}
+
+/**********************************************************
+ * Replaying
+ *********************************************************/
+bool ThemeCache::replay(const Common::String &key, Target &target) {
+	const Buffer *data = lookup(key);
+	if (!data)
+		return false;
+
+	Common::MemoryReadStream stream(data->data(), data->size());
+
+	if (!replayOps(stream, target)) {
+		warning("ThemeCache: Corrupted compiled theme, falling back to the XML parser");
+		_entries.erase(key);
+		_lru.remove(key);
+		return false;
+	}
+
+	return true;
+}
+
+bool ThemeCache::replayOps(Common::SeekableReadStream &stream, Target &target) {
+	while (!stream.eos() && !stream.err()) {
+		byte op = stream.readByte();
+
+		switch (op) {
+		case kOpEnd:
+			return true;
+
+		case kOpStoreFontNames:
+		case kOpAddFont: {
+			TextData textId = (TextData)stream.readSint16LE();
+			Common::String language = readString(stream);
+			Common::String file = readString(stream);
+			Common::String scalableFile = readString(stream);
+			int pointsize = stream.readSint32LE();
+
+			if (op == kOpStoreFontNames) {
+				if (!target.storeFontNames(textId, language, file, scalableFile, pointsize))
+					return false;
+			} else if (!target.addFont(textId, language, file, scalableFile, pointsize)) {
+				return false;
+			}
+			break;
+		}
+
+		case kOpAddTextColor: {
+			TextColor colorId = (TextColor)stream.readSint16LE();
+			byte r = stream.readByte();
+			byte g = stream.readByte();
+			byte b = stream.readByte();
+
+			if (!target.addTextColor(colorId, r, g, b))
+				return false;
+			break;
+		}
+
+		case kOpCreateCursor: {
+			Common::String filename = readString(stream);
+			int hotspotX = stream.readSint32LE();
+			int hotspotY = stream.readSint32LE();
+			ThemeEngine::CursorType type = (ThemeEngine::CursorType)stream.readByte();
+
+			if (!target.createCursor(filename, hotspotX, hotspotY, type))
+				return false;
+			break;
+		}
+
+		case kOpAddBitmap: {
+			Common::String filename = readString(stream);
+			Common::String scalableFile = readString(stream);
+			int width = stream.readSint32LE();
+			int height = stream.readSint32LE();
+
+			if (!target.addBitmap(filename, scalableFile, width, height))
+				return false;
+			break;
+		}
+
+		case kOpAddTextData: {
+			Common::String drawDataId = readString(stream);
+			TextData textId = (TextData)stream.readSint16LE();
+			TextColor colorId = (TextColor)stream.readSint16LE();
+			Graphics::TextAlign alignH = (Graphics::TextAlign)stream.readSint16LE();
+			ThemeEngine::TextAlignVertical alignV = (ThemeEngine::TextAlignVertical)stream.readSint16LE();
+
+			if (!target.addTextData(drawDataId, textId, colorId, alignH, alignV))
+				return false;
+			break;
+		}
+
+		case kOpAddDrawData: {
+			Common::String data = readString(stream);
+			bool cached = stream.readByte() != 0;
+
+			if (!target.addDrawData(data, cached))
+				return false;
+			break;
+		}
+
+		case kOpAddDrawStep: {
+			Common::String drawDataId = readString(stream);
+			Common::String function = readString(stream);
+			Common::String blitFile = readString(stream);
+
+			Graphics::DrawStep step;
+			Graphics::DrawStep::Color *colors[] = {
+				&step.fgColor, &step.bgColor, &step.gradColor1, &step.gradColor2, &step.bevelColor
+			};
+
+			for (int i = 0; i < ARRAYSIZE(colors); ++i) {
+				colors[i]->r = stream.readByte();
+				colors[i]->g = stream.readByte();
+				colors[i]->b = stream.readByte();
+				colors[i]->set = stream.readByte() != 0;
+			}
+
+			step.alphaType = (Graphics::AlphaType)stream.readByte();
+			step.autoWidth = stream.readByte() != 0;
+			step.autoHeight = stream.readByte() != 0;
+			step.x = stream.readSint16LE();
+			step.y = stream.readSint16LE();
+			step.w = stream.readSint16LE();
+			step.h = stream.readSint16LE();
+
+			Common::Rect *rects[] = { &step.padding, &step.clip };
+			for (int i = 0; i < ARRAYSIZE(rects); ++i) {
+				rects[i]->left = stream.readSint16LE();
+				rects[i]->top = stream.readSint16LE();
+				rects[i]->right = stream.readSint16LE();
+				rects[i]->bottom = stream.readSint16LE();
+			}
+
+			step.xAlign = (Graphics::DrawStep::VectorAlignment)stream.readByte();
+			step.yAlign = (Graphics::DrawStep::VectorAlignment)stream.readByte();
+			step.shadow = stream.readByte();
+			step.stroke = stream.readByte();
+			step.factor = stream.readByte();
+			step.radius = stream.readByte();
+			step.bevel = stream.readByte();
+			step.fillMode = stream.readByte();
+			step.shadowFillMode = stream.readByte();
+			step.extraData = stream.readUint32LE();
+			step.scale = stream.readUint32LE();
+			step.shadowIntensity = stream.readUint32LE();
+			step.autoscale = (ThemeEngine::AutoScaleMode)stream.readByte();
+
+			if (!target.addDrawStep(drawDataId, function, blitFile, step))
+				return false;
+			break;
+		}
+
+		case kOpSetVar: {
+			Common::String name = readString(stream);
+			if (!target.setVar(name, stream.readSint32LE()))
+				return false;
+			break;
+		}
+
+		case kOpAddDialog: {
+			Common::String name = readString(stream);
+			Common::String overlays = readString(stream);
+			int16 maxWidth = stream.readSint16LE();
+			int16 maxHeight = stream.readSint16LE();
+			int inset = stream.readSint32LE();
+
+			if (!target.addDialog(name, overlays, maxWidth, maxHeight, inset))
+				return false;
+			break;
+		}
+
+		case kOpAddLayout: {
+			ThemeLayout::LayoutType type = (ThemeLayout::LayoutType)stream.readByte();
+			int spacing = stream.readSint32LE();
+			ThemeLayout::ItemAlign itemAlign = (ThemeLayout::ItemAlign)stream.readByte();
+
+			if (!target.addLayout(type, spacing, itemAlign))
+				return false;
+			break;
+		}
+
+		case kOpAddWidget: {
+			Common::String name = readString(stream);
+			Common::String type = readString(stream);
+			int w = stream.readSint32LE();
+			int h = stream.readSint32LE();
+			Graphics::TextAlign align = (Graphics::TextAlign)stream.readSint16LE();
+			bool useRTL = stream.readByte() != 0;
+
+			if (!target.addWidget(name, type, w, h, align, useRTL))
+				return false;
+			break;
+		}
+
+		case kOpAddImportedLayout: {
+			Common::String name = readString(stream);
+			if (!target.addImportedLayout(name))
+				return false;
+			break;
+		}
+
+		case kOpAddSpace:
+			if (!target.addSpace(stream.readSint32LE()))
+				return false;
+			break;
+
+		case kOpAddPadding: {
+			int16 l = stream.readSint16LE();
+			int16 r = stream.readSint16LE();
+			int16 t = stream.readSint16LE();
+			int16 b = stream.readSint16LE();
+
+			if (!target.addPadding(l, r, t, b))
+				return false;
+			break;
+		}
+
+		case kOpCloseLayout:
+			if (!target.closeLayout())
+				return false;
+			break;
+
+		case kOpCloseDialog:
+			if (!target.closeDialog())
+				return false;
+			break;
+
+		default:
+			return false;
+		}
+	}
+
+	// Ran out of data before reaching kOpEnd
+	return false;
+}
+
+/**********************************************************
+ * Persistent storage
+ *********************************************************/
+Common::Path ThemeCache::getCacheDirectory() {
+	if (ConfMan.hasKey("themecachepath"))
+		return ConfMan.getPath("themecachepath");
+
+	// Default to a directory next to the configuration file
+	Common::Path configFile = ConfMan.getCustomConfigFileName();
+	if (configFile.empty())
+		configFile = g_system->getDefaultConfigFileName();
+
+	Common::FSNode configDir = Common::FSNode(configFile).getParent();
+	if (!configDir.isDirectory() || !configDir.isWritable())
+		return Common::Path();
+
+	Common::FSNode cacheDir = configDir.getChild("themecache");
+	if (!cacheDir.exists() && !cacheDir.createDirectory())
+		return Common::Path();
+
+	return cacheDir.getPath();
+}
+
+Common::Path ThemeCache::getCacheFile(const Common::String &key) const {
+	Common::Path cacheDir = getCacheDirectory();
+	if (cacheDir.empty())
+		return Common::Path();
+
+	Common::MemoryReadStream keyStream((const byte *)key.c_str(), key.size());
+	return cacheDir.appendComponent(Common::computeStreamMD5AsString(keyStream) + ".stc");
+}
+
+bool ThemeCache::loadFromDisk(const Common::String &key, Buffer &data) const {
+	Common::Path path = getCacheFile(key);
+	if (path.empty())
+		return false;
+
+	Common::FSNode node(path);
+	if (!node.exists())
+		return false;
+
+	Common::SeekableReadStream *stream = node.createReadStream();
+	if (!stream)
+		return false;
+
+	bool result = false;
+	if (stream->readUint32BE() == kThemeCacheTag && stream->readUint32LE() == kThemeCacheVersion) {
+		uint32 keyLen = stream->readUint32LE();
+		Common::String storedKey = stream->readString(0, keyLen);
+		uint32 size = stream->readUint32LE();
+
+		// The file name is only a digest of the key, make sure it is really ours
+		if (storedKey == key && !stream->err() && size <= stream->size() - stream->pos()) {
+			data.resize(size);
+			result = stream->read(data.data(), size) == size;
+		}
+	}
+
+	delete stream;
+
+	if (result)
+		debug(6, "ThemeCache: Loaded compiled theme from '%s'", path.toString(Common::Path::kNativeSeparator).c_str());
+
+	return result;
+}
+
+void ThemeCache::saveToDisk(const Common::String &key, const Buffer &data) const {
+	Common::Path path = getCacheFile(key);
+	if (path.empty())
+		return;
+
+	Common::WriteStream *stream = Common::FSNode(path).createWriteStream();
+	if (!stream) {
+		warning("ThemeCache: Could not write compiled theme to '%s'", path.toString(Common::Path::kNativeSeparator).c_str());
+		return;
+	}
+
+	stream->writeUint32BE(kThemeCacheTag);
+	stream->writeUint32LE(kThemeCacheVersion);
+	stream->writeUint32LE(key.size());
+	stream->writeString(key);
+	stream->writeUint32LE(data.size());
+	stream->write(data.data(), data.size());
+	stream->finalize();
+	delete stream;
+}
+
+} // End of namespace GUI
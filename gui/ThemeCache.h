@@ -0,0 +1,218 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GUI_THEME_CACHE_H
+#define GUI_THEME_CACHE_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/memstream.h"
+#include "common/path.h"
+#include "common/str.h"
+
+#include "graphics/font.h"
+
+#include "gui/ThemeEngine.h"
+#include "gui/ThemeLayout.h"
+
+namespace Graphics {
+struct DrawStep;
+}
+
+namespace GUI {
+
+/**
+ * Compiled form of a parsed theme.
+ *
+ * While the ThemeParser processes the STX files, every call it makes into
+ * the ThemeEngine and its ThemeEval is recorded as a compact binary op.
+ * Replaying those ops later rebuilds exactly the same draw data, text data,
+ * variables and layouts without going through the XML parser.
+ *
+ * The most recently used compiled themes are kept in memory for the
+ * lifetime of the ThemeEngine, so that switching back and forth between
+ * resolutions and scale factors only parses a given layout once.
+ * They are additionally written to disk so subsequent launches can skip
+ * parsing too, in the directory set by the "themecachepath" configuration
+ * key, or in a "themecache" directory next to the configuration file.
+ * Setting "themecachepath" to an empty value disables this.
+ *
+ * The key of a compiled theme includes the ScummVM version, the cache
+ * format version, a digest of all the STX data and the base resolution
+ * and scale factor, so stale entries are never replayed.
+ */
+class ThemeCache {
+public:
+	/**
+	 * Receiver of the calls rebuilt by replay().
+	 *
+	 * The methods mirror the recording interface below. The ThemeEngine
+	 * forwards them to itself and to its ThemeEval.
+	 * They return false to abort the replay, e.g. if a file is missing.
+	 */
+	class Target {
+	public:
+		virtual ~Target() {}
+
+		virtual bool storeFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) = 0;
+		virtual bool addFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) = 0;
+		virtual bool addTextColor(TextColor colorId, int r, int g, int b) = 0;
+		virtual bool createCursor(const Common::String &filename, int hotspotX, int hotspotY, ThemeEngine::CursorType type) = 0;
+		virtual bool addBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height) = 0;
+		virtual bool addTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV) = 0;
+		virtual bool addDrawData(const Common::String &data, bool cached) = 0;
+		/** The drawing function and the blit source of the step are only given by their names. */
+		virtual bool addDrawStep(const Common::String &drawDataId, const Common::String &function, const Common::String &blitFile, Graphics::DrawStep &step) = 0;
+
+		virtual bool setVar(const Common::String &name, int val) = 0;
+		virtual bool addDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset) = 0;
+		virtual bool addLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign) = 0;
+		virtual bool addWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL) = 0;
+		virtual bool addImportedLayout(const Common::String &name) = 0;
+		virtual bool addSpace(int size) = 0;
+		virtual bool addPadding(int16 l, int16 r, int16 t, int16 b) = 0;
+		virtual bool closeLayout() = 0;
+		virtual bool closeDialog() = 0;
+	};
+
+	ThemeCache();
+	~ThemeCache();
+
+	/**
+	 * Build the key identifying a compiled theme.
+	 *
+	 * @param themeId     Identifier of the theme.
+	 * @param digest      Digest of the concatenated STX data.
+	 * @param w, h, scale Base resolution and scale factor the theme is parsed for.
+	 */
+	static Common::String makeKey(const Common::String &themeId, const Common::String &digest, int w, int h, float scale);
+
+	/**
+	 * Rebuild the theme state associated with the given key.
+	 *
+	 * @return true if a compiled theme was found and successfully replayed.
+	 */
+	bool replay(const Common::String &key, Target &target);
+
+	/**
+	 * Look up the compiled theme associated with the given key, in memory
+	 * first and then on disk, and mark it as the most recently used one.
+	 *
+	 * @return The recorded ops, or nullptr if the theme was never compiled.
+	 */
+	const Common::Array<byte> *lookup(const Common::String &key);
+
+	/** Start recording the calls of a ThemeParser run. */
+	void beginRecording();
+
+	/** Store the recorded ops under the given key. */
+	void commitRecording(const Common::String &key);
+
+	/** Drop the recorded ops, e.g. if the parser failed. */
+	void abortRecording();
+
+	bool isRecording() const { return _recorder != nullptr; }
+
+	/** Drop all compiled themes held in memory. */
+	void clear() { _entries.clear(); _lru.clear(); }
+
+	/** Number of compiled themes held in memory. */
+	uint size() const { return _entries.size(); }
+
+	/** Maximum number of compiled themes held in memory. */
+	static const uint kMaxEntries = 8;
+
+	/**
+	 * @name Recording interface
+	 * These mirror the ThemeEngine and ThemeEval methods used by the ThemeParser.
+	 * They are no-ops when not recording.
+	 * @{
+	 */
+	void recordStoreFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize);
+	void recordAddFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize);
+	void recordAddTextColor(TextColor colorId, int r, int g, int b);
+	void recordCreateCursor(const Common::String &filename, int hotspotX, int hotspotY, ThemeEngine::CursorType type);
+	void recordAddBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height);
+	void recordAddTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV);
+	void recordAddDrawData(const Common::String &data, bool cached);
+	void recordAddDrawStep(const Common::String &drawDataId, const Common::String &function, const Common::String &blitFile, const Graphics::DrawStep &step);
+
+	void recordSetVar(const Common::String &name, int val);
+	void recordAddDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset);
+	void recordAddLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign);
+	void recordAddWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL);
+	void recordAddImportedLayout(const Common::String &name);
+	void recordAddSpace(int size);
+	void recordAddPadding(int16 l, int16 r, int16 t, int16 b);
+	void recordCloseLayout();
+	void recordCloseDialog();
+	/** @} */
+
+private:
+	enum Op {
+		kOpEnd = 0,
+		kOpStoreFontNames,
+		kOpAddFont,
+		kOpAddTextColor,
+		kOpCreateCursor,
+		kOpAddBitmap,
+		kOpAddTextData,
+		kOpAddDrawData,
+		kOpAddDrawStep,
+		kOpSetVar,
+		kOpAddDialog,
+		kOpAddLayout,
+		kOpAddWidget,
+		kOpAddImportedLayout,
+		kOpAddSpace,
+		kOpAddPadding,
+		kOpCloseLayout,
+		kOpCloseDialog
+	};
+
+	typedef Common::Array<byte> Buffer;
+	typedef Common::HashMap<Common::String, Buffer> EntryMap;
+
+	void store(const Common::String &key, const Buffer &data);
+	void touch(const Common::String &key);
+
+	void writeString(const Common::String &str);
+	static Common::String readString(Common::ReadStream &stream);
+
+	bool replayOps(Common::SeekableReadStream &stream, Target &target);
+
+	static Common::Path getCacheDirectory();
+	Common::Path getCacheFile(const Common::String &key) const;
+	bool loadFromDisk(const Common::String &key, Buffer &data) const;
+	void saveToDisk(const Common::String &key, const Buffer &data) const;
+
+	EntryMap _entries;
+	/** Keys of the compiled themes in memory, most recently used first. */
+	Common::List<Common::String> _lru;
+	Common::MemoryWriteStreamDynamic *_recorder;
+};
+
+} // End of namespace GUI
+
+#endif
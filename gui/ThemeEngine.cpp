@@ -23,6 +23,8 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
 #include "common/compression/unzip.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
@@ -41,6 +43,7 @@
 #include "image/png.h"
 
 #include "gui/widget.h"
+#include "gui/ThemeCache.h"
 #include "gui/ThemeEngine.h"
 #include "gui/ThemeEval.h"
 #include "gui/ThemeParser.h"
@@ -189,7 +192,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(nullptr), _vectorRenderer(nullptr),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(nullptr), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(nullptr), _scaleFactor(1.0f) {
+	_cursor(nullptr), _scaleFactor(1.0f),
+	_debugRedraw(false), _lastUpdateRects(0), _lastUpdateArea(0) {
 
 	_baseWidth = 640;	// Default sane values
 	_baseHeight = 480;
@@ -198,6 +202,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_parser = new ThemeParser(this);
 	_themeEval = new GUI::ThemeEval();
 	_themeEval->setScaleFactor(_scaleFactor);
+	_themeCache = new ThemeCache();
 
 	_useCursor = false;
 
@@ -245,6 +250,7 @@ ThemeEngine::~ThemeEngine() {
 
 	delete _parser;
 	delete _themeEval;
+	delete _themeCache;
 }
 
 
@@ -741,6 +747,7 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 	unloadTheme();
 
 	debug(6, "Loading theme %s", themeId.c_str());
+	uint32 startTime = _system->getMillis();
 
 	if (themeId == "builtin") {
 		_themeOk = loadDefaultXML();
@@ -762,13 +769,18 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 		}
 	}
 
-	debug(6, "Finished loading theme %s", themeId.c_str());
+	debug(6, "Finished loading theme %s in %d ms", themeId.c_str(), _system->getMillis() - startTime);
 }
 
 void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearThemeData();
+	_themeOk = false;
+}
+
+void ThemeEngine::clearThemeData() {
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = nullptr;
@@ -788,7 +800,158 @@ void ThemeEngine::unloadTheme() {
 	}
 
 	_themeEval->reset();
-	_themeOk = false;
+}
+
+/**
+ * Forwards the calls of a compiled theme to the theme engine and its evaluator,
+ * the same way the ThemeParser does.
+ */
+class ThemeCacheTarget : public ThemeCache::Target {
+public:
+	ThemeCacheTarget(ThemeEngine *theme) : _theme(theme), _eval(theme->getEvaluator()) {}
+
+	bool storeFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) override {
+		_theme->storeFontNames(textId, language, file, scalableFile, pointsize);
+		return true;
+	}
+
+	bool addFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) override {
+		return _theme->addFont(textId, language, file, scalableFile, pointsize);
+	}
+
+	bool addTextColor(TextColor colorId, int r, int g, int b) override {
+		return _theme->addTextColor(colorId, r, g, b);
+	}
+
+	bool createCursor(const Common::String &filename, int hotspotX, int hotspotY, ThemeEngine::CursorType type) override {
+		return _theme->createCursor(filename, hotspotX, hotspotY, type);
+	}
+
+	bool addBitmap(const Common::String &filename, const Common::String &scalableFile, int width, int height) override {
+		return _theme->addBitmap(filename, scalableFile, width, height);
+	}
+
+	bool addTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV) override {
+		return _theme->addTextData(drawDataId, textId, colorId, alignH, alignV);
+	}
+
+	bool addDrawData(const Common::String &data, bool cached) override {
+		return _theme->addDrawData(data, cached);
+	}
+
+	bool addDrawStep(const Common::String &drawDataId, const Common::String &function, const Common::String &blitFile, Graphics::DrawStep &step) override {
+		step.drawingCall = ThemeParser::getDrawingFunctionCallback(function);
+		if (!step.drawingCall)
+			return false;
+
+		if (!blitFile.empty()) {
+			step.blitSrc = _theme->getImageSurface(blitFile);
+			if (!step.blitSrc)
+				return false;
+		}
+
+		_theme->addDrawStep(drawDataId, step);
+		return true;
+	}
+
+	bool setVar(const Common::String &name, int val) override {
+		_eval->setVar(name, val);
+		return true;
+	}
+
+	bool addDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset) override {
+		_eval->addDialog(name, overlays, maxWidth, maxHeight, inset);
+		return true;
+	}
+
+	bool addLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign) override {
+		_eval->addLayout(type, spacing, itemAlign);
+		return true;
+	}
+
+	bool addWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL) override {
+		_eval->addWidget(name, type, w, h, align, useRTL);
+		return true;
+	}
+
+	bool addImportedLayout(const Common::String &name) override {
+		if (!_eval->hasDialog(name))
+			return false;
+
+		_eval->addImportedLayout(name);
+		return true;
+	}
+
+	bool addSpace(int size) override {
+		_eval->addSpace(size);
+		return true;
+	}
+
+	bool addPadding(int16 l, int16 r, int16 t, int16 b) override {
+		_eval->addPadding(l, r, t, b);
+		return true;
+	}
+
+	bool closeLayout() override {
+		_eval->closeLayout();
+		return true;
+	}
+
+	bool closeDialog() override {
+		_eval->closeDialog();
+		return true;
+	}
+
+private:
+	ThemeEngine *_theme;
+	ThemeEval *_eval;
+};
+
+bool ThemeEngine::parseThemeStreams(const Common::String &cacheKey, const Common::Array<Common::SeekableReadStream *> &streams, const Common::StringArray &names) {
+	ThemeCacheTarget target(this);
+	if (_themeCache->replay(cacheKey, target)) {
+		debug(6, "Using compiled theme for '%s'", _themeId.c_str());
+
+		for (uint i = 0; i < streams.size(); ++i)
+			delete streams[i];
+
+		return true;
+	}
+
+	// Anything replayed before the compiled theme was found to be unusable
+	// must not end up mixed with the parsed theme
+	clearThemeData();
+
+	_themeCache->beginRecording();
+	_parser->setRecorder(_themeCache);
+
+	bool result = true;
+	for (uint i = 0; i < streams.size(); ++i) {
+		if (!result) {
+			delete streams[i];
+			continue;
+		}
+
+		// The parser takes ownership of the stream
+		if (_parser->loadStream(streams[i]) == false) {
+			warning("Failed to load STX file '%s'", names[i].c_str());
+			result = false;
+		} else if (_parser->parse() == false) {
+			warning("Failed to parse STX file '%s'", names[i].c_str());
+			result = false;
+		}
+
+		_parser->close();
+	}
+
+	_parser->setRecorder(nullptr);
+
+	if (result)
+		_themeCache->commitRecording(cacheKey);
+	else
+		_themeCache->abortRecording();
+
+	return result;
 }
 
 void ThemeEngine::unloadExtraFont() {
@@ -815,22 +978,20 @@ bool ThemeEngine::loadDefaultXML() {
 	for (int i = 0; i < ARRAYSIZE(defaultXML); i++)
 		strncat((char *)tmpXML, defaultXML[i], xmllen);
 
-	if (!_parser->loadBuffer(tmpXML, xmllen)) {
-		free(tmpXML);
-
-		return false;
-	}
-
 	_themeName = "ScummVM Classic Theme (Builtin Version)";
 	_themeId = "builtin";
 	_themeFile.clear();
 
-	bool result = _parser->parse();
-	_parser->close();
+	Common::Array<Common::SeekableReadStream *> streams;
+	streams.push_back(new Common::MemoryReadStream(tmpXML, xmllen, DisposeAfterUse::YES));
 
-	free(tmpXML);
+	Common::StringArray names;
+	names.push_back("builtin");
 
-	return result;
+	Common::String digest = Common::computeStreamMD5AsString(*streams[0]);
+	streams[0]->seek(0);
+
+	return parseThemeStreams(ThemeCache::makeKey(_themeId, digest, _baseWidth, _baseHeight, _scaleFactor), streams, names);
 #else
 	warning("The built-in theme is not enabled in the current build. Please load an external theme");
 	return false;
@@ -870,26 +1031,36 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 	}
 
 	//
-	// Loop over all STX files, load and parse them
+	// Load all STX files. Their digest identifies the compiled theme,
+	// so the XML only needs to be parsed when the theme changed.
 	//
+	Common::Array<Common::SeekableReadStream *> streams;
+	Common::StringArray names;
+	Common::String digest;
+
 	for (auto &member : members) {
 		assert(member->getName().hasSuffix(".stx"));
 
-		if (_parser->loadStream(member->createReadStream()) == false) {
+		Common::SeekableReadStream *stream = member->createReadStream();
+		if (!stream) {
 			warning("Failed to load STX file '%s'", member->getName().c_str());
-			_parser->close();
-			return false;
-		}
 
-		if (_parser->parse() == false) {
-			warning("Failed to parse STX file '%s'", member->getName().c_str());
-			_parser->close();
+			for (uint i = 0; i < streams.size(); ++i)
+				delete streams[i];
+
 			return false;
 		}
 
-		_parser->close();
+		digest += member->getName() + ":" + Common::computeStreamMD5AsString(*stream) + ";";
+		stream->seek(0);
+
+		streams.push_back(stream);
+		names.push_back(member->getName());
 	}
 
+	if (!parseThemeStreams(ThemeCache::makeKey(themeId, digest, _baseWidth, _baseHeight, _scaleFactor), streams, names))
+		return false;
+
 	assert(!_themeName.empty());
 	return true;
 }
@@ -1536,6 +1707,26 @@ void ThemeEngine::copyBackBufferToScreen() {
 	memcpy(_screen.getPixels(), _backBuffer.getPixels(), (size_t)(_screen.pitch * _screen.h));
 }
 
+void ThemeEngine::copyBackBufferToScreen(Common::Rect r) {
+	r.clip(_screen.w, _screen.h);
+	if (r.isEmpty())
+		return;
+
+	_screen.copyRectToSurface(_backBuffer.rawSurface(), r.left, r.top, r);
+}
+
+void ThemeEngine::saveBackBuffer(Graphics::ManagedSurface &surface) const {
+	surface.copyFrom(_backBuffer);
+}
+
+bool ThemeEngine::restoreBackBuffer(const Graphics::ManagedSurface &surface) {
+	if (surface.w != _backBuffer.w || surface.h != _backBuffer.h || surface.format != _backBuffer.format)
+		return false;
+
+	_backBuffer.copyRectToSurface(surface.rawSurface(), 0, 0, Common::Rect(surface.w, surface.h));
+	return true;
+}
+
 void ThemeEngine::updateScreen() {
 #ifdef LAYOUT_DEBUG_DIALOG
 	_vectorRenderer->fillSurface();
@@ -1575,12 +1766,28 @@ void ThemeEngine::addDirtyRect(Common::Rect r) {
 }
 
 void ThemeEngine::updateDirtyScreen() {
+	_lastUpdateRects = 0;
+	_lastUpdateArea = 0;
+
 	if (_dirtyScreen.empty())
 		return;
 
 	Common::List<Common::Rect>::iterator i;
 	for (i = _dirtyScreen.begin(); i != _dirtyScreen.end(); ++i) {
-		_vectorRenderer->copyFrame(_system, *i);
+		_lastUpdateRects++;
+		_lastUpdateArea += (uint32)i->width() * i->height();
+
+		if (!_debugRedraw) {
+			_vectorRenderer->copyFrame(_system, *i);
+			continue;
+		}
+
+		// Outline the area on a copy, so that the frame does not end up
+		// in the screen surface and disappears on the next update.
+		Graphics::ManagedSurface area(i->width(), i->height(), _screen.format);
+		area.copyRectToSurface(_screen.rawSurface(), 0, 0, *i);
+		area.frameRect(Common::Rect(i->width(), i->height()), _screen.format.RGBToColor(255, 0, 255));
+		_system->copyRectToOverlay(area.getPixels(), area.pitch, i->left, i->top, i->width(), i->height());
 	}
 
 	_dirtyScreen.clear();
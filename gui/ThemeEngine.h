@@ -29,6 +29,7 @@
 #include "common/language.h"
 #include "common/list.h"
 #include "common/str.h"
+#include "common/str-array.h"
 #include "common/rect.h"
 
 #include "graphics/managed_surface.h"
@@ -51,6 +52,7 @@ struct WidgetDrawData;
 struct TextDrawData;
 class Dialog;
 class GuiObject;
+class ThemeCache;
 class ThemeEval;
 class ThemeParser;
 
@@ -413,6 +415,34 @@ public:
 	 */
 	void copyBackBufferToScreen();
 
+	/**
+	 * Copy an area of the backbuffer surface to the screen surface
+	 */
+	void copyBackBufferToScreen(Common::Rect r);
+
+	/**
+	 * Copy the backbuffer surface into the given surface
+	 */
+	void saveBackBuffer(Graphics::ManagedSurface &surface) const;
+
+	/**
+	 * Replace the backbuffer surface with a copy made by saveBackBuffer().
+	 * Fails if the overlay size or format changed since the copy was made.
+	 */
+	bool restoreBackBuffer(const Graphics::ManagedSurface &surface);
+
+	/**
+	 * Outline every area copied to the overlay by updateScreen().
+	 * Only the overlay is affected, the screen surface is left untouched.
+	 */
+	void setDebugRedraw(bool enable) { _debugRedraw = enable; }
+
+	/** Number of rectangles copied to the overlay by the last updateScreen() call. */
+	uint getLastUpdateRectCount() const { return _lastUpdateRects; }
+
+	/** Number of pixels copied to the overlay by the last updateScreen() call. */
+	uint32 getLastUpdateArea() const { return _lastUpdateArea; }
+
 
 	/** @name FONT MANAGEMENT METHODS */
 	//@{
@@ -651,6 +681,16 @@ protected:
 	/** Load the them from the file with the specified name. */
 	void loadTheme(const Common::String &themeid);
 
+	/** Release all the draw, text and layout data of the current theme. */
+	void clearThemeData();
+
+	/**
+	 * Load the theme from its compiled version if available, otherwise
+	 * parse the given STX streams and compile them for later use.
+	 * Takes ownership of the streams.
+	 */
+	bool parseThemeStreams(const Common::String &cacheKey, const Common::Array<Common::SeekableReadStream *> &streams, const Common::StringArray &names);
+
 	/**
 	 * Changes the active graphics mode of the GUI; may be used to either
 	 * initialize the GUI or to change the mode while the GUI is already running.
@@ -800,6 +840,9 @@ protected:
 	/** Theme getEvaluator (changed from GUI::Eval to add functionality) */
 	GUI::ThemeEval *_themeEval;
 
+	/** Compiled versions of the themes parsed so far */
+	GUI::ThemeCache *_themeCache;
+
 	/** Main screen surface. This is blitted straight into the overlay. */
 	Graphics::ManagedSurface _screen;
 
@@ -850,6 +893,10 @@ protected:
 	/** List of all the dirty screens that must be blitted to the overlay. */
 	Common::List<Common::Rect> _dirtyScreen;
 
+	bool _debugRedraw;       ///< Outline the areas copied to the overlay
+	uint _lastUpdateRects;   ///< Rects copied by the last updateDirtyScreen()
+	uint32 _lastUpdateArea;  ///< Pixels copied by the last updateDirtyScreen()
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
@@ -19,6 +19,7 @@
  *
  */
 
+#include "gui/ThemeCache.h"
 #include "gui/ThemeEngine.h"
 #include "gui/ThemeEval.h"
 #include "gui/ThemeParser.h"
@@ -192,6 +193,7 @@ ThemeParser::ThemeParser(ThemeEngine *parent) : XMLParser() {
 	_defaultStepGlobal = defaultDrawStep();
 	_defaultStepLocal = nullptr;
 	_theme = parent;
+	_recorder = nullptr;
 
 	_baseWidth = _baseHeight = 0;
 	_scaleFactor = 1.0f;
@@ -240,6 +242,12 @@ Graphics::DrawStep *ThemeParser::newDrawStep() {
 	return step;
 }
 
+void ThemeParser::setVar(const Common::String &name, int val) {
+	_theme->getEvaluator()->setVar(name, val);
+	if (_recorder)
+		_recorder->recordSetVar(name, val);
+}
+
 bool ThemeParser::parserCallback_defaults(ParserNode *node) {
 	ParserNode *parentNode = getParentNode(node);
 	Graphics::DrawStep *step = nullptr;
@@ -311,10 +319,15 @@ bool ThemeParser::parserCallback_language(ParserNode *node) {
 
 
 	_theme->storeFontNames(textDataId, node->values["id"], file, scalableFile, pointsize);
+	if (_recorder)
+		_recorder->recordStoreFontNames(textDataId, node->values["id"], file, scalableFile, pointsize);
 
 	if (!_theme->addFont(textDataId, node->values["id"], file, scalableFile, pointsize))
 		return parserError("Error loading localized Font in theme engine.");
 
+	if (_recorder)
+		_recorder->recordAddFont(textDataId, node->values["id"], file, scalableFile, pointsize);
+
 	return true;
 }
 
@@ -333,6 +346,9 @@ bool ThemeParser::parserCallback_text_color(ParserNode *node) {
 	if (!_theme->addTextColor(colorId, red, green, blue))
 		return parserError("Error while adding text color information.");
 
+	if (_recorder)
+		_recorder->recordAddTextColor(colorId, red, green, blue);
+
 	return true;
 }
 
@@ -365,6 +381,9 @@ bool ThemeParser::parserCallback_cursor(ParserNode *node) {
 	if (!_theme->createCursor(node->values["file"], spotx, spoty, cursorType))
 		return parserError("Error creating Bitmap Cursor.");
 
+	if (_recorder)
+		_recorder->recordCreateCursor(node->values["file"], spotx, spoty, cursorType);
+
 	return true;
 }
 
@@ -397,6 +416,9 @@ bool ThemeParser::parserCallback_bitmap(ParserNode *node) {
 	if (!_theme->addBitmap(node->values["filename"], scalableFile, width, height))
 		return parserError("Error loading Bitmap file '" + node->values["filename"] + "'");
 
+	if (_recorder)
+		_recorder->recordAddBitmap(node->values["filename"], scalableFile, width, height);
+
 	return true;
 }
 
@@ -417,6 +439,9 @@ bool ThemeParser::parserCallback_text(ParserNode *node) {
 	if (!_theme->addTextData(id, textDataId, textColorId, alignH, alignV))
 		return parserError("Error adding Text Data for '" + id + "'.");
 
+	if (_recorder)
+		_recorder->recordAddTextData(id, textDataId, textColorId, alignH, alignV);
+
 	return true;
 }
 
@@ -458,7 +483,7 @@ bool ThemeParser::parserCallback_color(ParserNode *node) {
 }
 
 
-static Graphics::DrawingFunctionCallback getDrawingFunctionCallback(const Common::String &name) {
+Graphics::DrawingFunctionCallback ThemeParser::getDrawingFunctionCallback(const Common::String &name) {
 
 	if (name == "circle")
 		return &Graphics::VectorRenderer::drawCallback_CIRCLE;
@@ -505,6 +530,15 @@ bool ThemeParser::parserCallback_drawstep(ParserNode *node) {
 	}
 
 	_theme->addDrawStep(getParentNode(node)->values["id"], *drawstep);
+
+	if (_recorder) {
+		Common::String blitFile;
+		if (drawstep->blitSrc)
+			blitFile = node->values["file"];
+
+		_recorder->recordAddDrawStep(getParentNode(node)->values["id"], functionName, blitFile, *drawstep);
+	}
+
 	delete drawstep;
 
 	return true;
@@ -526,6 +560,9 @@ bool ThemeParser::parserCallback_drawdata(ParserNode *node) {
 	if (_theme->addDrawData(node->values["id"], cached) == false)
 		return parserError("Error adding Draw Data set: Invalid DrawData name.");
 
+	if (_recorder)
+		_recorder->recordAddDrawData(node->values["id"], cached);
+
 	delete _defaultStepLocal;
 	_defaultStepLocal = nullptr;
 
@@ -769,7 +806,7 @@ bool ThemeParser::parserCallback_def(ParserNode *node) {
 	if (scalable)
 		value = SCALEVALUE(value);
 
-	_theme->getEvaluator()->setVar(var, value);
+	setVar(var, value);
 	return true;
 }
 
@@ -824,6 +861,8 @@ bool ThemeParser::parserCallback_widget(ParserNode *node) {
 			useRTL = parseBoolean(node->values["rtl"]);
 
 		_theme->getEvaluator()->addWidget(var, node->values["type"], width, height, alignH, useRTL);
+		if (_recorder)
+			_recorder->recordAddWidget(var, node->values["type"], width, height, alignH, useRTL);
 	}
 
 	return true;
@@ -861,6 +900,8 @@ bool ThemeParser::parserCallback_dialog(ParserNode *node) {
 	}
 
 	_theme->getEvaluator()->addDialog(name, overlays, SCALEVALUE(width), SCALEVALUE(height), inset);
+	if (_recorder)
+		_recorder->recordAddDialog(name, overlays, SCALEVALUE(width), SCALEVALUE(height), inset);
 
 	if (node->values.contains("shading")) {
 		int shading = 0;
@@ -870,7 +911,7 @@ bool ThemeParser::parserCallback_dialog(ParserNode *node) {
 			shading = 2;
 		else return parserError("Invalid value for Dialog background shading.");
 
-		_theme->getEvaluator()->setVar("Dialog." + name + ".Shading", shading);
+		setVar("Dialog." + name + ".Shading", shading);
 	}
 
 	return true;
@@ -883,6 +924,8 @@ bool ThemeParser::parserCallback_import(ParserNode *node) {
 		return parserError("Imported layout was not found: " + importedName);
 
 	_theme->getEvaluator()->addImportedLayout(importedName);
+	if (_recorder)
+		_recorder->recordAddImportedLayout(importedName);
 
 	return true;
 }
@@ -919,13 +962,18 @@ bool ThemeParser::parserCallback_layout(ParserNode *node) {
 		}
 	}
 
+	ThemeLayout::LayoutType layoutType;
 	if (node->values["type"] == "vertical")
-		_theme->getEvaluator()->addLayout(GUI::ThemeLayout::kLayoutVertical, spacing, itemAlign);
+		layoutType = GUI::ThemeLayout::kLayoutVertical;
 	else if (node->values["type"] == "horizontal")
-		_theme->getEvaluator()->addLayout(GUI::ThemeLayout::kLayoutHorizontal, spacing, itemAlign);
+		layoutType = GUI::ThemeLayout::kLayoutHorizontal;
 	else
 		return parserError("Invalid layout type. Only 'horizontal' and 'vertical' layouts allowed.");
 
+	_theme->getEvaluator()->addLayout(layoutType, spacing, itemAlign);
+	if (_recorder)
+		_recorder->recordAddLayout(layoutType, spacing, itemAlign);
+
 	if (node->values.contains("padding")) {
 		int paddingL, paddingR, paddingT, paddingB;
 
@@ -934,6 +982,8 @@ bool ThemeParser::parserCallback_layout(ParserNode *node) {
 
 		// values are scaled inside this method
 		_theme->getEvaluator()->addPadding(paddingL, paddingR, paddingT, paddingB);
+		if (_recorder)
+			_recorder->recordAddPadding(paddingL, paddingR, paddingT, paddingB);
 	}
 
 	return true;
@@ -958,14 +1008,21 @@ bool ThemeParser::parserCallback_space(ParserNode *node) {
 	}
 
 	_theme->getEvaluator()->addSpace(size);
+	if (_recorder)
+		_recorder->recordAddSpace(size);
 	return true;
 }
 
 bool ThemeParser::closedKeyCallback(ParserNode *node) {
-	if (node->name == "layout")
+	if (node->name == "layout") {
 		_theme->getEvaluator()->closeLayout();
-	else if (node->name == "dialog")
+		if (_recorder)
+			_recorder->recordCloseLayout();
+	} else if (node->name == "dialog") {
 		_theme->getEvaluator()->closeDialog();
+		if (_recorder)
+			_recorder->recordCloseDialog();
+	}
 
 	return true;
 }
@@ -1018,8 +1075,8 @@ bool ThemeParser::parseCommonLayoutProps(ParserNode *node, const Common::String
 				return false;
 		}
 
-		_theme->getEvaluator()->setVar(var + "Width", width);
-		_theme->getEvaluator()->setVar(var + "Height", height);
+		setVar(var + "Width", width);
+		setVar(var + "Height", height);
 	}
 
 	if (node->values.contains("pos")) {
@@ -1079,8 +1136,8 @@ bool ThemeParser::parseCommonLayoutProps(ParserNode *node, const Common::String
 				return false;
 		}
 
-		_theme->getEvaluator()->setVar(var + "X", x);
-		_theme->getEvaluator()->setVar(var + "Y", y);
+		setVar(var + "X", x);
+		setVar(var + "Y", y);
 	}
 
 	if (node->values.contains("padding")) {
@@ -1089,10 +1146,10 @@ bool ThemeParser::parseCommonLayoutProps(ParserNode *node, const Common::String
 		if (!parseList(node->values["padding"], 4, &paddingL, &paddingR, &paddingT, &paddingB))
 			return false;
 
-		_theme->getEvaluator()->setVar(var + "Padding.Left", SCALEVALUE(paddingL));
-		_theme->getEvaluator()->setVar(var + "Padding.Right", SCALEVALUE(paddingR));
-		_theme->getEvaluator()->setVar(var + "Padding.Top", SCALEVALUE(paddingT));
-		_theme->getEvaluator()->setVar(var + "Padding.Bottom", SCALEVALUE(paddingB));
+		setVar(var + "Padding.Left", SCALEVALUE(paddingL));
+		setVar(var + "Padding.Right", SCALEVALUE(paddingR));
+		setVar(var + "Padding.Top", SCALEVALUE(paddingT));
+		setVar(var + "Padding.Bottom", SCALEVALUE(paddingB));
 	}
 
 
@@ -1102,7 +1159,7 @@ bool ThemeParser::parseCommonLayoutProps(ParserNode *node, const Common::String
 		if ((alignH = parseTextHAlign(node->values["textalign"])) == Graphics::kTextAlignInvalid)
 			return parserError("Invalid value for text alignment.");
 
-		_theme->getEvaluator()->setVar(var + "Align", alignH);
+		setVar(var + "Align", alignH);
 	}
 	return true;
 }
@@ -25,8 +25,11 @@
 #include "common/scummsys.h"
 #include "common/formats/xmlparser.h"
 
+#include "graphics/VectorRenderer.h"
+
 namespace GUI {
 
+class ThemeCache;
 class ThemeEngine;
 
 class ThemeParser : public Common::XMLParser {
@@ -52,8 +55,17 @@ public:
 		return true;
 	}
 
+	/**
+	 * Record all the calls made into the ThemeEngine while parsing,
+	 * so they can later be replayed without parsing the XML again.
+	 */
+	void setRecorder(ThemeCache *recorder) { _recorder = recorder; }
+
+	static Graphics::DrawingFunctionCallback getDrawingFunctionCallback(const Common::String &name);
+
 protected:
 	ThemeEngine *_theme;
+	ThemeCache *_recorder;
 
 	CUSTOM_XML_PARSER(ThemeParser) {
 		XML_KEY(render_info)
@@ -271,6 +283,8 @@ protected:
 	bool parseDrawStep(ParserNode *stepNode, Graphics::DrawStep *drawstep, bool functionSpecific);
 	bool parseCommonLayoutProps(ParserNode *node, const Common::String &var);
 
+	void setVar(const Common::String &name, int val);
+
 	bool parseList(const char *key, int count, ...);
 	bool parseList(const Common::String &keyStr, int count, ...);
 	bool vparseList(const char *key, int count, va_list args);
@@ -76,6 +76,7 @@ Debugger::Debugger() {
 	registerCmd("clear",			WRAP_METHOD(Debugger, cmdClearLog));
 	registerCmd("cls",			WRAP_METHOD(Debugger, cmdClearLog)); // alias
 	registerCmd("exec",				WRAP_METHOD(Debugger, cmdExecFile));
+	registerCmd("searchman_stats",	WRAP_METHOD(Debugger, cmdSearchManStats));
 
 	registerCmd("debuglevel",		WRAP_METHOD(Debugger, cmdDebugLevel));
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
@@ -820,6 +821,13 @@ bool Debugger::cmdClearLog(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdSearchManStats(int argc, const char **argv) {
+	uint entries, hits, misses;
+	SearchMan.getPathIndexStats(entries, hits, misses);
+	debugPrintf("SearchMan path index: %u entries, %u hits, %u misses\n", entries, hits, misses);
+	return true;
+}
+
 bool Debugger::cmdExecFile(int argc, const char **argv) {
 	if (argc <= 1) {
 		debugPrintf("Expected to get the file with debug commands\n");
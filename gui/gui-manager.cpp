@@ -101,6 +101,7 @@ GuiManager::GuiManager() : CommandSender(nullptr), _redrawStatus(kRedrawDisabled
 }
 
 GuiManager::~GuiManager() {
+	clearUnderlays();
 	delete _theme;
 	delete _wm;
 }
@@ -344,6 +345,9 @@ bool GuiManager::loadNewTheme(Common::String id, ThemeEngine::GraphicsMode gfx,
 	_theme = newTheme;
 	_useStdCursor = !_theme->ownCursor();
 
+	// Put gui_debug_redraw = true to your scummvm.ini to outline the redrawn areas
+	_theme->setDebugRedraw(ConfMan.hasKey("gui_debug_redraw") && ConfMan.getBool("gui_debug_redraw"));
+
 	// If _stateIsSaved is set, we know that a Theme is already initialized,
 	// thus we initialize the new theme properly
 	if (_stateIsSaved) {
@@ -377,6 +381,8 @@ void GuiManager::displayTopDialogOnly(bool mode) {
 
 	_displayTopDialogOnly = mode;
 
+	// The underlays are only kept up to date when drawing the whole stack
+	clearUnderlays();
 	redrawFull();
 }
 
@@ -450,7 +456,40 @@ void GuiManager::redrawInternal() {
 
 	switch (_redrawStatus) {
 		case kRedrawCloseDialog:
+			// When the backbuffer under the new top dialog is still known,
+			// only that dialog needs to be drawn again
+			if (restoreUnderlay()) {
+				_theme->drawToBackbuffer();
+				_dialogStack.top()->drawDialog(kDrawLayerBackground);
+
+				_theme->drawToScreen();
+				_theme->copyBackBufferToScreen();
+
+				// The shading was applied when opening the second dialog
+				// of the stack, closing it removes the shading everywhere
+				if (_dialogStack.size() > 1) {
+					_theme->addDirtyRect(_closedDialogRect);
+					_theme->addDirtyRect(_dialogStack.top()->getMaxDirtyRect());
+				} else {
+					_theme->addDirtyRect(Common::Rect(_system->getOverlayWidth(), _system->getOverlayHeight()));
+				}
+
+				_dialogStack.top()->drawDialog(kDrawLayerForeground);
+
+				if (_tooltip) {
+					// There is no background for tooltips as we never save them in backbuffer
+					_tooltip->drawDialog(kDrawLayerForeground);
+				}
+				break;
+			}
+
+			// fall through
+
 		case kRedrawFull:
+			// The shading of the whole stack is applied at once below,
+			// so the underlays saved when opening the dialogs don't match anymore
+			clearUnderlays();
+
 			// Clear everything
 			_theme->clearAll();
 
@@ -485,12 +524,22 @@ void GuiManager::redrawInternal() {
 				_theme->applyScreenShading(shading);
 			}
 
+			// The backbuffer only holds the dialogs under the top one at this
+			// point, unless only the top dialog is being redrawn
+			if (_redrawStatus != kRedrawTopDialog)
+				saveUnderlay();
+
 			// Finally, draw the top dialog background
 			_dialogStack.top()->drawDialog(kDrawLayerBackground);
 
-			// copy everything to screen and render the top dialog foreground
+			// copy everything to screen and render the top dialog foreground.
+			// When only the top dialog changed, the rest of the backbuffer
+			// is already on screen, so only its area needs to be copied.
 			_theme->drawToScreen();
-			_theme->copyBackBufferToScreen();
+			if (_redrawStatus == kRedrawTopDialog)
+				_theme->copyBackBufferToScreen(_dialogStack.top()->getMaxDirtyRect());
+			else
+				_theme->copyBackBufferToScreen();
 
 			_dialogStack.top()->drawDialog(kDrawLayerForeground);
 
@@ -535,10 +584,44 @@ void GuiManager::redrawInternal() {
 	}
 }
 
+void GuiManager::saveUnderlay() {
+	const uint top = _dialogStack.size() - 1;
+
+	clearUnderlays(top);
+	_underlays.resize(top + 1, nullptr);
+	for (uint i = 0; i + kMaxRetainedUnderlays <= top; i++) {
+		delete _underlays[i];
+		_underlays[i] = nullptr;
+	}
+
+	_underlays[top] = new Graphics::ManagedSurface();
+	_theme->saveBackBuffer(*_underlays[top]);
+}
+
+bool GuiManager::restoreUnderlay() {
+	const uint top = _dialogStack.size() - 1;
+
+	if (top >= _underlays.size() || !_underlays[top])
+		return false;
+
+	return _theme->restoreBackBuffer(*_underlays[top]);
+}
+
+void GuiManager::clearUnderlays(uint from) {
+	for (uint i = from; i < _underlays.size(); i++)
+		delete _underlays[i];
+
+	if (from < _underlays.size())
+		_underlays.resize(from);
+}
+
 void GuiManager::redraw() {
 	if (_dialogStack.empty())
 		return;
 
+	uint32 startTime = _system->getMillis(true);
+	RedrawStatus status = _redrawStatus;
+
 	if (_displayTopDialogOnly) {
 		redrawInternalTopDialogOnly();
 	} else {
@@ -547,6 +630,10 @@ void GuiManager::redraw() {
 
 	_theme->updateScreen();
 	_redrawStatus = kRedrawDisabled;
+
+	if (_theme->getLastUpdateRectCount())
+		debug(9, "GUI redraw: status %d, %u rects, %u pixels, %u ms", status,
+		      _theme->getLastUpdateRectCount(), _theme->getLastUpdateArea(), _system->getMillis(true) - startTime);
 }
 
 Dialog *GuiManager::getTopDialog() const {
@@ -783,6 +870,9 @@ void GuiManager::restoreState() {
 
 	_system->updateScreen();
 
+	// The overlay contents will be different when the GUI is shown again
+	clearUnderlays();
+
 	_stateIsSaved = false;
 }
 
@@ -820,7 +910,11 @@ void GuiManager::closeTopDialog() {
 
 	if (!_tooltip) {
 		// Remove the dialog from the stack
+		_closedDialogRect = _dialogStack.top()->getMaxDirtyRect();
 		_dialogStack.pop()->lostFocus();
+
+		// Drop the underlay of the closed dialog
+		clearUnderlays(_dialogStack.size());
 	}
 
 	if (!_dialogStack.empty()) {
@@ -191,6 +191,14 @@ protected:
 
 	bool		_displayTopDialogOnly;
 
+	// Backbuffer contents under each dialog of the stack, as they were just
+	// before the dialog background was drawn. Closing the top dialog restores
+	// the one under the new top dialog instead of redrawing the whole stack.
+	// Only the topmost ones are kept, each of them is as large as the overlay.
+	enum { kMaxRetainedUnderlays = 4 };
+	Common::Array<Graphics::ManagedSurface *> _underlays;
+	Common::Rect _closedDialogRect;
+
 	Common::Mutex _iconsMutex;
 	Common::SearchSet _iconsSet;
 	bool _iconsSetChanged;
@@ -238,6 +246,10 @@ protected:
 	void redrawInternalTopDialogOnly();
 	void redrawInternal();
 
+	void saveUnderlay();
+	bool restoreUnderlay();
+	void clearUnderlays(uint from = 0);
+
 	void setupCursor();
 	void animateCursor();
 
@@ -70,6 +70,10 @@ MassAddDialog::MassAddDialog(const Common::FSNode &startDir)
 	// The dir we start our scan at
 	_scanStack.push(startDir);
 
+	// The engines list the subdirectories of each scanned directory, keep
+	// these listings so that each directory is read only once
+	ADCacheMan.keepDirectories(true);
+
 	// Removed for now... Why would you put a title on mass add dialog called "Mass Add Dialog"?
 	// new StaticTextWidget(this, "massadddialog_caption", "Mass Add Dialog");
 
@@ -109,6 +113,10 @@ MassAddDialog::MassAddDialog(const Common::FSNode &startDir)
 	}
 }
 
+MassAddDialog::~MassAddDialog() {
+	ADCacheMan.keepDirectories(false);
+}
+
 struct GameTargetLess {
 	bool operator()(const DetectedGame &x, const DetectedGame &y) const {
 		return x.preferredTarget.compareToIgnoreCase(y.preferredTarget) < 0;
@@ -194,13 +202,17 @@ void MassAddDialog::handleTickle() {
 		Common::FSNode dir = _scanStack.pop();
 
 		Common::FSList files;
-		if (!dir.getChildren(files, Common::FSNode::kListAll)) {
+		if (!ADCacheMan.getChildren(dir, files)) {
 			continue;
 		}
 
 		// Run the detector on the dir
 		DetectionResults detectionResults = EngineMan.detectGames(files, (ADGF_WARNING | ADGF_UNSUPPORTED | ADGF_ADDON), true);
 
+		// The engines are done with this directory, and its parents were
+		// scanned before it
+		ADCacheMan.forgetDirectory(dir);
+
 		if (detectionResults.foundUnknownGames()) {
 			Common::U32String report = detectionResults.generateUnknownGameReport(false, 80);
 			g_system->logMessage(LogMessageType::kInfo, report.encode().c_str());
@@ -654,7 +654,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->getCachedSaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
 		if (!_saveList[selItem].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[selItem] = desc;
 
@@ -664,9 +664,17 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 		isLocked = desc.getLocked();
 
 		if (_thumbnailSupport) {
-			const Graphics::Surface *thumb = desc.getThumbnail();
-			if (thumb && _gfxWidget->isVisible())
-				_gfxWidget->setGfx(thumb, true);
+			if (_gfxWidget->isVisible()) {
+				if (isLocked) {
+					const Graphics::Surface *thumb = desc.getThumbnail();
+					if (thumb)
+						_gfxWidget->setGfx(thumb, true);
+				} else {
+					Common::SharedPtr<Graphics::ManagedSurface> thumb = _metaEngine->getCachedSaveThumbnail(_target.c_str(), _saveList[selItem].getSaveSlot(), g_gui.getScaleFactor());
+					if (thumb)
+						_gfxWidget->setGfx(thumb);
+				}
+			}
 		}
 
 		if (_saveDateSupport) {
@@ -954,7 +962,7 @@ void SaveLoadChooserGrid::open() {
 			// In case there was a gap found use the slot.
 			if (lastSlot + 1 < curSlot) {
 				// Check that the save slot can be used for user saves.
-				SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), lastSlot + 1);
+				SaveStateDescriptor desc = _metaEngine->getCachedSaveMetaInfos(_target.c_str(), lastSlot + 1);
 				if (!desc.getWriteProtectedFlag()) {
 					_nextFreeSaveSlot = lastSlot + 1;
 					break;
@@ -968,7 +976,7 @@ void SaveLoadChooserGrid::open() {
 		const int maxSlot = _metaEngine->getMaximumSaveSlot();
 		for (int i = lastSlot; _nextFreeSaveSlot == -1 && i < maxSlot; ++i) {
 			// Check that the save slot can be used for user saves.
-			SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), i + 1);
+			SaveStateDescriptor desc = _metaEngine->getCachedSaveMetaInfos(_target.c_str(), i + 1);
 			if (!desc.getWriteProtectedFlag()) {
 				_nextFreeSaveSlot = i + 1;
 			}
@@ -1169,14 +1177,18 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->getCachedSaveMetaInfos(_target.c_str(), saveSlot));
 		if (!_saveList[i].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[i] = desc;
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
 		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
+		if (thumbnail && _saveList[i].getLocked()) {
+			curButton.button->setGfx(thumbnail);
+		} else if (thumbnail) {
+			// Shared with the cache, so that turning pages doesn't scale the thumbnails again
+			Common::SharedPtr<Graphics::ManagedSurface> gfx = _metaEngine->getCachedSaveThumbnail(_target.c_str(), saveSlot, g_gui.getScaleFactor());
+			curButton.button->setGfx(gfx);
 		} else {
 			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
 		}
@@ -150,4 +150,35 @@ public:
 
 		delete converter;
 	}
+
+	/**
+	 * After a reset, a converter which was used for another stream produces
+	 * the same output for a new stream as a newly created converter.
+	 */
+	void test_reset() {
+		static const int rates[4][2] = { { 22050, 22050 }, { 44100, 22050 }, { 11025, 44100 }, { 11025, 48000 } };
+
+		for (int i = 0; i < 4; ++i) {
+			for (int stereo = 0; stereo < 2; ++stereo) {
+				Audio::RateConverter *used = Audio::makeRateConverter(rates[i][0], rates[i][1], stereo, true, false);
+				Audio::RateConverter *fresh = Audio::makeRateConverter(rates[i][0], rates[i][1], stereo, true, false);
+
+				int16 warmup[1001 * 2] = {}, expected[777 * 2] = {}, out[777 * 2] = {};
+				CountingAudioStream first(rates[i][0], stereo), second(rates[i][0], stereo), third(rates[i][0], stereo);
+				used->convert(first, (byte *)warmup, sizeof(int16), 1001,
+					Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume, Audio::MIX_ADD);
+
+				used->reset();
+				used->convert(second, (byte *)out, sizeof(int16), 777,
+					Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume, Audio::MIX_ADD);
+				fresh->convert(third, (byte *)expected, sizeof(int16), 777,
+					Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume, Audio::MIX_ADD);
+
+				TS_ASSERT_SAME_DATA(out, expected, sizeof(out));
+
+				delete used;
+				delete fresh;
+			}
+		}
+	}
 };
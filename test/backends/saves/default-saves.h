@@ -0,0 +1,283 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "backends/saves/default/default-saves.h"
+#include "common/array.h"
+#include "common/callback.h"
+#include "common/compression/deflate.h"
+#include "common/ptr.h"
+
+#include "../../system/null_osystem.h"
+
+class DefaultSaveFileManagerTestSuite : public CxxTest::TestSuite {
+	DefaultSaveFileManager *_saveFileMan;
+	Common::Array<Common::AsyncSaveResult> _results;
+
+	void saveWritten(const Common::AsyncSaveResult &result) {
+		_results.push_back(result);
+	}
+
+	void enableAsyncSaving() {
+		_saveFileMan->setAsyncSaving(true, new Common::Callback<DefaultSaveFileManagerTestSuite, const Common::AsyncSaveResult &>(this, &DefaultSaveFileManagerTestSuite::saveWritten));
+	}
+
+	static void fillData(Common::Array<byte> &data, uint32 size, uint32 seed) {
+		data.resize(size);
+		for (uint32 i = 0; i < size; i++) {
+			seed = seed * 1103515245 + 12345;
+			data[i] = seed >> 16;
+		}
+	}
+
+	bool writeSave(const Common::String &filename, const Common::Array<byte> &data) {
+		Common::ScopedPtr<Common::OutSaveFile> file(_saveFileMan->openForSaving(filename));
+		if (!file)
+			return false;
+
+		file->write(data.data(), data.size());
+		file->finalize();
+		return true;
+	}
+
+	static bool readStream(Common::SeekableReadStream *stream, const Common::Array<byte> &expected) {
+		Common::ScopedPtr<Common::SeekableReadStream> file(stream);
+		if (!file || file->size() != (int64)expected.size())
+			return false;
+
+		Common::Array<byte> data(expected.size());
+		return file->read(data.data(), data.size()) == data.size() && data == expected;
+	}
+
+	bool readSave(const Common::String &filename, const Common::Array<byte> &expected) {
+		return readStream(_saveFileMan->openForLoading(filename), expected);
+	}
+
+public:
+	void setUp() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+#endif
+		_saveFileMan = new DefaultSaveFileManager(Common::Path("test/savegames"));
+		_results.clear();
+	}
+
+	void tearDown() {
+		_saveFileMan->setAsyncSaving(false);
+		Common::StringArray files = _saveFileMan->listSavefiles("*");
+		for (uint i = 0; i < files.size(); i++)
+			_saveFileMan->removeSavefile(files[i]);
+
+		delete _saveFileMan;
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_queue() {
+		Common::Array<byte> data;
+		fillData(data, 200000, 1);
+
+		enableAsyncSaving();
+		Common::ScopedPtr<Common::OutSaveFile> file(_saveFileMan->openForSaving("queue.sav"));
+		TS_ASSERT(file);
+		TS_ASSERT_EQUALS(file->write(data.data(), data.size()), data.size());
+		file->finalize();
+
+		// The data was handed over, so later writes must fail
+		TS_ASSERT(!file->err());
+		TS_ASSERT_EQUALS(file->write(data.data(), 1), 0u);
+		TS_ASSERT(file->err());
+		TS_ASSERT_EQUALS(file->pos(), (int64)data.size());
+		file.reset();
+
+		// Writing is spread over several polls
+		uint polls = 0;
+		while (_results.empty() && polls < 100) {
+			_saveFileMan->pollAsyncSaves();
+			polls++;
+		}
+
+		TS_ASSERT_LESS_THAN(1u, polls);
+		TS_ASSERT_EQUALS(_results.size(), 1u);
+		TS_ASSERT_EQUALS(_results[0].name, "queue.sav");
+		TS_ASSERT(_results[0].success);
+		TS_ASSERT_EQUALS(_results[0].size, data.size());
+
+		TS_ASSERT(readSave("queue.sav", data));
+	}
+
+	void test_replace() {
+		Common::Array<byte> first, second;
+		fillData(first, 1000, 1);
+		fillData(second, 200000, 2);
+		TS_ASSERT(writeSave("replace.sav", first));
+
+		enableAsyncSaving();
+		TS_ASSERT(writeSave("replace.sav", second));
+		_saveFileMan->pollAsyncSaves();
+		TS_ASSERT(_results.empty());
+
+		// The previous file stays in place until the new one is complete
+		const Common::FSNode node(Common::Path("test/savegames/replace.sav"));
+		TS_ASSERT(readStream(Common::wrapCompressedReadStream(node.createReadStream()), first));
+
+		_saveFileMan->waitForAsyncSaves();
+		TS_ASSERT(readStream(Common::wrapCompressedReadStream(node.createReadStream()), second));
+		TS_ASSERT(!Common::FSNode(Common::Path("test/savegames/replace.sav.tmp")).exists());
+	}
+
+	void test_wait() {
+		Common::Array<byte> first, second, other;
+		fillData(first, 100000, 1);
+		fillData(second, 150000, 2);
+		fillData(other, 1000, 3);
+
+		enableAsyncSaving();
+		TS_ASSERT(writeSave("wait.sav", first));
+		TS_ASSERT(writeSave("other.sav", other));
+		TS_ASSERT(writeSave("wait.sav", second));
+
+		// Reopening the file for saving wrote everything queued before
+		TS_ASSERT_EQUALS(_results.size(), 2u);
+
+		_saveFileMan->waitForAsyncSaves();
+		TS_ASSERT_EQUALS(_results.size(), 3u);
+		if (_results.size() == 3) {
+			TS_ASSERT_EQUALS(_results[0].name, "wait.sav");
+			TS_ASSERT_EQUALS(_results[1].name, "other.sav");
+			TS_ASSERT_EQUALS(_results[2].name, "wait.sav");
+			TS_ASSERT_EQUALS(_results[2].size, second.size());
+		}
+
+		TS_ASSERT(readSave("wait.sav", second));
+		TS_ASSERT(readSave("other.sav", other));
+
+		// Loading a pending save waits for it
+		TS_ASSERT(writeSave("other.sav", first));
+		TS_ASSERT(readSave("other.sav", first));
+		TS_ASSERT_EQUALS(_results.size(), 4u);
+	}
+
+	void test_revision() {
+		// Information read from the save files, like the save/load dialogs
+		// cache, must be dropped after each save
+		Common::Array<byte> data;
+		fillData(data, 1000, 1);
+
+		uint32 revision = _saveFileMan->getSavefilesRevision();
+		TS_ASSERT(writeSave("revision.sav", data));
+		TS_ASSERT_DIFFERS(_saveFileMan->getSavefilesRevision(), revision);
+
+		revision = _saveFileMan->getSavefilesRevision();
+		TS_ASSERT(readSave("revision.sav", data));
+		TS_ASSERT_EQUALS(_saveFileMan->listSavefiles("revision.sav*").size(), 1u);
+		TS_ASSERT_EQUALS(_saveFileMan->getSavefilesRevision(), revision);
+
+		// Saves written in the background change it again once on disk
+		enableAsyncSaving();
+		TS_ASSERT(writeSave("revision.sav", data));
+		revision = _saveFileMan->getSavefilesRevision();
+		_saveFileMan->waitForAsyncSaves();
+		TS_ASSERT_DIFFERS(_saveFileMan->getSavefilesRevision(), revision);
+
+		revision = _saveFileMan->getSavefilesRevision();
+		TS_ASSERT(_saveFileMan->removeSavefile("revision.sav"));
+		TS_ASSERT_DIFFERS(_saveFileMan->getSavefilesRevision(), revision);
+	}
+
+	void test_file_revision() {
+		// Writing a save only drops what was read from that save
+		Common::Array<byte> data;
+		fillData(data, 1000, 1);
+		TS_ASSERT(writeSave("first.sav", data));
+		TS_ASSERT(writeSave("second.sav", data));
+
+		const uint32 first = _saveFileMan->getSavefileRevision("first.sav");
+		const uint32 second = _saveFileMan->getSavefileRevision("second.sav");
+		TS_ASSERT_DIFFERS(first, 0u);
+		TS_ASSERT_DIFFERS(second, 0u);
+
+		TS_ASSERT(readSave("first.sav", data));
+		TS_ASSERT_EQUALS(_saveFileMan->getSavefileRevision("first.sav"), first);
+
+		TS_ASSERT(writeSave("first.sav", data));
+		TS_ASSERT_DIFFERS(_saveFileMan->getSavefileRevision("first.sav"), first);
+		TS_ASSERT_EQUALS(_saveFileMan->getSavefileRevision("second.sav"), second);
+
+		TS_ASSERT(_saveFileMan->removeSavefile("second.sav"));
+		TS_ASSERT_DIFFERS(_saveFileMan->getSavefileRevision("second.sav"), second);
+		TS_ASSERT(_saveFileMan->removeSavefile("first.sav"));
+	}
+
+	void test_delta() {
+		Common::Array<byte> base, latest, other, last;
+		fillData(base, 50000, 1);
+		latest = base;
+		latest[100] ^= 0xFF;
+		fillData(other, 50000, 2);
+		last = base;
+		last[200] ^= 0xFF;
+
+		const Common::FSNode baseNode(Common::Path("test/savegames/delta.sav"));
+
+		enableAsyncSaving();
+		_saveFileMan->setDeltaSaving(true);
+		TS_ASSERT(writeSave("delta.sav", base));
+		_saveFileMan->waitForAsyncSaves();
+		Common::ScopedPtr<Common::InSaveFile> raw(_saveFileMan->openRawFile("delta.sav"));
+		const int64 fullSize = raw ? raw->size() : 0;
+		TS_ASSERT(writeSave("delta.sav", latest));
+		_saveFileMan->waitForAsyncSaves();
+
+		// The delta is stored along with its base, in the one file which
+		// is listed and synced
+		TS_ASSERT_EQUALS(_saveFileMan->listSavefiles("delta.sav*").size(), 1u);
+		raw.reset(_saveFileMan->openRawFile("delta.sav"));
+		TS_ASSERT(raw);
+		if (raw) {
+			TS_ASSERT_EQUALS(raw->readUint32BE(), MKTAG('S', 'D', 'L', 'T'));
+			TS_ASSERT_LESS_THAN(fullSize, raw->size());
+		}
+		raw.reset();
+		TS_ASSERT(readSave("delta.sav", latest));
+
+		// Another manager, as on another device, reads the same state
+		{
+			DefaultSaveFileManager device(Common::Path("test/savegames"));
+			TS_ASSERT(readStream(device.openForLoading("delta.sav"), latest));
+		}
+
+		// Replace the base behind the manager's back, as a cloud download does
+		Common::ScopedPtr<Common::WriteStream> file(Common::wrapCompressedWriteStream(baseNode.createWriteStream()));
+		file->write(other.data(), other.size());
+		file->finalize();
+		file.reset();
+
+		// The next save must not be a delta to the stale base
+		TS_ASSERT(writeSave("delta.sav", last));
+		_saveFileMan->waitForAsyncSaves();
+		_saveFileMan->setDeltaSaving(false);
+		TS_ASSERT(readSave("delta.sav", last));
+		TS_ASSERT(readStream(Common::wrapCompressedReadStream(_saveFileMan->openRawFile("delta.sav")), last));
+	}
+};
@@ -0,0 +1,238 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "common/compression/dcl.h"
+#include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "../../system/null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+/**
+ * Tests for the PKWARE DCL decompressor. The compressed data is built at
+ * runtime from a few codes of the fixed Huffman trees, which are spelled
+ * out in the order the decompressor reads their bits.
+ */
+class DCLTestSuite : public CxxTest::TestSuite {
+	class Encoder {
+	public:
+		Encoder(byte mode, byte dictionaryType) : _bits(0), _bitCount(0), _dictionaryType(dictionaryType) {
+			writeBits(mode, 8);
+			writeBits(dictionaryType, 8);
+		}
+
+		void literal(byte b) {
+			writeBits(0, 1);
+			writeBits(b, 8);
+			_expected.push_back(b);
+		}
+
+		void asciiLiteral(char c) {
+			writeBits(0, 1);
+			switch (c) {
+			case 'a': writeCode("11100"); break;
+			case 'b': writeCode("011001"); break;
+			case 'e': writeCode("11011"); break;
+			default: writeCode("1111"); break;
+			}
+			_expected.push_back(c);
+		}
+
+		// Copies 3 or 518 bytes, from at most 1 << dictionaryType bytes back,
+		// or from 514 bytes back with a 1 KB dictionary
+		void copy(uint length, uint offset) {
+			writeBits(1, 1);
+			if (length == 3) {
+				writeCode("11");
+			} else {
+				writeCode("0000000");
+				writeBits(length - 264, 8);
+			}
+
+			if (offset <= 16u << (_dictionaryType - 4)) {
+				writeCode("11");
+				writeBits(offset - 1, _dictionaryType);
+			} else {
+				writeCode("0010111");
+				writeBits((offset - 1) & ((1 << _dictionaryType) - 1), _dictionaryType);
+			}
+
+			for (uint i = 0; i < length; i++)
+				_expected.push_back(_expected[_expected.size() - offset]);
+		}
+
+		void end() {
+			writeBits(1, 1);
+			writeCode("0000000");
+			writeBits(255, 8);
+		}
+
+		const Common::Array<byte> &finish() {
+			if (_bitCount)
+				writeBits(0, 8 - _bitCount);
+			return _data;
+		}
+
+		const Common::Array<byte> &expected() const { return _expected; }
+
+	private:
+		void writeBits(uint32 value, int count) {
+			for (int i = 0; i < count; i++) {
+				_bits |= ((value >> i) & 1) << _bitCount;
+				if (++_bitCount == 8) {
+					_data.push_back(_bits);
+					_bits = 0;
+					_bitCount = 0;
+				}
+			}
+		}
+
+		void writeCode(const char *code) {
+			for (; *code; code++)
+				writeBits(*code == '1', 1);
+		}
+
+		Common::Array<byte> _data, _expected;
+		byte _bits;
+		int _bitCount;
+		byte _dictionaryType;
+	};
+
+	static bool checkStream(Common::SeekableReadStream *stream, const Common::Array<byte> &expected) {
+		Common::ScopedPtr<Common::SeekableReadStream> owned(stream);
+		if (!stream || stream->size() != (int64)expected.size())
+			return false;
+
+		Common::Array<byte> data(expected.size());
+		stream->read(data.data(), data.size());
+		return data == expected;
+	}
+
+	// Decompresses with all the entry points
+	static void checkAll(Encoder &encoder) {
+		const Common::Array<byte> &packed = encoder.finish();
+		const Common::Array<byte> &expected = encoder.expected();
+
+		Common::Array<byte> unpacked(expected.size());
+		Common::MemoryReadStream src1(packed.data(), packed.size());
+		TS_ASSERT(Common::decompressDCL(&src1, unpacked.data(), packed.size(), unpacked.size()));
+		TS_ASSERT(unpacked == expected);
+
+		Common::MemoryReadStream src2(packed.data(), packed.size());
+		TS_ASSERT(checkStream(Common::decompressDCL(&src2, packed.size(), expected.size()), expected));
+
+		Common::MemoryReadStream src3(packed.data(), packed.size());
+		TS_ASSERT(checkStream(Common::decompressDCL(&src3), expected));
+	}
+
+public:
+	void setUp() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+#if BENCHMARK_TIME
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_binary() {
+		Encoder encoder(0, 6);
+		for (int i = 0; i < 20; i++)
+			encoder.literal(i * 37);
+		encoder.copy(3, 16);
+		encoder.copy(518, 3);
+		encoder.literal(0xFF);
+		encoder.end();
+		checkAll(encoder);
+	}
+
+	void test_ascii() {
+		Encoder encoder(1, 5);
+		encoder.asciiLiteral('a');
+		encoder.asciiLiteral('b');
+		encoder.asciiLiteral(' ');
+		encoder.copy(3, 3);
+		encoder.asciiLiteral('e');
+		encoder.copy(518, 1);
+		encoder.end();
+		checkAll(encoder);
+	}
+
+	void test_overlapping_copy_wrapping_dictionary() {
+		// With a 1 KB dictionary, this copy overwrites the dictionary bytes it reads
+		Encoder encoder(0, 4);
+		for (int i = 0; i < 600; i++)
+			encoder.literal(i * 7 + (i >> 4));
+		encoder.copy(518, 514);
+		encoder.end();
+		checkAll(encoder);
+	}
+
+	void test_missing_end_marker() {
+		Encoder encoder(0, 6);
+		encoder.literal('x');
+		const Common::Array<byte> &packed = encoder.finish();
+
+		// Without a known size, running out of data is an error
+		Common::MemoryReadStream src(packed.data(), packed.size());
+		TS_ASSERT(!Common::decompressDCL(&src));
+	}
+
+	void test_speed() {
+#if BENCHMARK_TIME
+		const uint32 kDataSize = 4 * 1024 * 1024;
+		Encoder encoder(0, 6);
+		uint32 seed = 1;
+		while (encoder.expected().size() < kDataSize) {
+			seed = seed * 1103515245 + 12345;
+			if (encoder.expected().size() < 16 || (seed >> 16) % 3 == 0)
+				encoder.literal(seed >> 24);
+			else
+				encoder.copy(3, 1 + (seed >> 28));
+		}
+		encoder.end();
+
+		const Common::Array<byte> &packed = encoder.finish();
+		Common::Array<byte> unpacked(encoder.expected().size());
+		Common::MemoryReadStream src(packed.data(), packed.size());
+
+		uint32 start = g_system->getMillis();
+		TS_ASSERT(Common::decompressDCL(&src, unpacked.data(), packed.size(), unpacked.size()));
+		uint32 time = MAX<uint32>(g_system->getMillis() - start, 1);
+
+		TS_ASSERT(unpacked == encoder.expected());
+		debug("DCL: %u KB in %u ms, %.1f MB/s\n", unpacked.size() / 1024, time, unpacked.size() / 1024.0 / 1024.0 * 1000.0 / time);
+#endif
+	}
+};
@@ -0,0 +1,141 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/compression/deflate.h"
+#include "common/memstream.h"
+#include "common/substream.h"
+#include "common/ptr.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "../../system/null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+class DeflateSeekTestSuite : public CxxTest::TestSuite {
+	static const uint32 kDataSize = 4 * 1024 * 1024;
+
+	byte *_data;
+	Common::SeekableReadStream *_compressed;
+
+	// Fairly compressible data which still spans many deflate blocks
+	void generateData() {
+		uint32 seed = 1;
+		for (uint32 i = 0; i < kDataSize; i++) {
+			seed = seed * 1103515245 + 12345;
+			_data[i] = "abcdefghijklmnop"[(seed >> 16) & 15] + ((i >> 12) & 7);
+		}
+	}
+
+	Common::SeekableReadStream *createReadStream() {
+		_compressed->seek(0);
+		return Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(_compressed, 0, _compressed->size()), DisposeAfterUse::YES, kDataSize);
+	}
+
+	bool checkRead(Common::SeekableReadStream *stream, uint32 offset, uint32 len) {
+		byte buf[4096];
+		if (!stream->seek(offset))
+			return false;
+		if (stream->read(buf, len) != len)
+			return false;
+		return memcmp(buf, _data + offset, len) == 0;
+	}
+
+public:
+	void setUp() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+#endif
+		_data = new byte[kDataSize];
+		generateData();
+
+		Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *gz = Common::wrapCompressedWriteStream(mem);
+		gz->write(_data, kDataSize);
+		gz->finalize();
+		byte *compressed = mem->getData();
+		uint32 compressedSize = mem->size();
+		// This also deletes mem, but not its data
+		delete gz;
+
+		_compressed = new Common::MemoryReadStream(compressed, compressedSize, DisposeAfterUse::YES);
+	}
+
+	void tearDown() {
+		delete _compressed;
+		delete[] _data;
+#if BENCHMARK_TIME
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_sequential_read() {
+		Common::ScopedPtr<Common::SeekableReadStream> stream(createReadStream());
+		TS_ASSERT(stream);
+
+		for (uint32 offset = 0; offset < kDataSize; offset += 4096)
+			TS_ASSERT(checkRead(stream.get(), offset, 4096));
+	}
+
+	void test_random_seeks() {
+		Common::ScopedPtr<Common::SeekableReadStream> stream(createReadStream());
+		TS_ASSERT(stream);
+
+		// Read backwards first, then jump around
+		for (int i = 15; i >= 0; i--)
+			TS_ASSERT(checkRead(stream.get(), i * (kDataSize / 16) + 123, 3000));
+
+		uint32 seed = 7;
+		for (int i = 0; i < 200; i++) {
+			seed = seed * 1103515245 + 12345;
+			uint32 offset = seed % (kDataSize - 4096);
+			TS_ASSERT(checkRead(stream.get(), offset, 1 + (seed >> 20)));
+		}
+
+		// Reading up to the end still works after restoring a checkpoint
+		TS_ASSERT(checkRead(stream.get(), kDataSize - 1000, 1000));
+		byte b;
+		TS_ASSERT_EQUALS(stream->read(&b, 1), 0u);
+		TS_ASSERT(stream->eos());
+		TS_ASSERT(!stream->err());
+	}
+
+	void test_random_seek_speed() {
+#if BENCHMARK_TIME
+		Common::ScopedPtr<Common::SeekableReadStream> stream(createReadStream());
+		uint32 seed = 11;
+		uint32 start = g_system->getMillis();
+
+		for (int i = 0; i < 100; i++) {
+			seed = seed * 1103515245 + 12345;
+			checkRead(stream.get(), seed % (kDataSize - 4096), 4096);
+		}
+
+		debug("100 random 4K reads in a %u KB deflate stream: %u ms\n", kDataSize / 1024, g_system->getMillis() - start);
+#endif
+	}
+};
@@ -0,0 +1,82 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/compression/delta.h"
+#include "common/memstream.h"
+
+class DeltaTestSuite : public CxxTest::TestSuite {
+	uint32 _seed;
+
+	byte nextByte() {
+		_seed = _seed * 1103515245 + 12345;
+		return _seed >> 16;
+	}
+
+	// Encodes data against base, and checks it is rebuilt identically
+	uint32 roundTrip(const byte *base, uint32 baseSize, const byte *data, uint32 size) {
+		Common::MemoryWriteStreamDynamic delta(DisposeAfterUse::YES);
+		const uint32 deltaSize = Common::createDelta(base, baseSize, data, size, delta);
+		TS_ASSERT_EQUALS(deltaSize, delta.size());
+
+		Common::MemoryReadStream in(delta.getData(), delta.size());
+		byte *out = new byte[size + 1];
+		TS_ASSERT(Common::applyDelta(base, baseSize, in, out, size));
+		TS_ASSERT_SAME_DATA(out, data, size);
+		delete[] out;
+
+		return deltaSize;
+	}
+
+public:
+	DeltaTestSuite() : _seed(1) {}
+
+	void test_small_changes() {
+		byte base[10000], data[10000];
+		for (int i = 0; i < ARRAYSIZE(base); i++)
+			base[i] = nextByte();
+		memcpy(data, base, sizeof(data));
+
+		// Identical data only needs a single record
+		TS_ASSERT_LESS_THAN(roundTrip(base, sizeof(base), data, sizeof(data)), 5u);
+
+		for (int i = 0; i < 20; i++)
+			data[(nextByte() << 5) % sizeof(data)] ^= 0x55;
+		TS_ASSERT_LESS_THAN(roundTrip(base, sizeof(base), data, sizeof(data)), 200u);
+	}
+
+	void test_size_changes() {
+		byte base[1000], data[1500];
+		for (int i = 0; i < ARRAYSIZE(data); i++)
+			data[i] = nextByte();
+		memcpy(base, data, sizeof(base));
+
+		// Growing, shrinking, and against or to nothing
+		roundTrip(base, sizeof(base), data, sizeof(data));
+		roundTrip(data, sizeof(data), base, sizeof(base));
+		roundTrip(base, 0, data, sizeof(data));
+		roundTrip(base, sizeof(base), data, 0);
+		roundTrip(base, 3, data, 5);
+	}
+
+	void test_corrupt_delta() {
+		byte base[100], data[100], out[100];
+		memset(base, 1, sizeof(base));
+		memset(data, 1, sizeof(data));
+		data[50] = 2;
+
+		Common::MemoryWriteStreamDynamic delta(DisposeAfterUse::YES);
+		Common::createDelta(base, sizeof(base), data, sizeof(data), delta);
+
+		// Truncated
+		Common::MemoryReadStream truncated(delta.getData(), delta.size() - 1);
+		TS_ASSERT(!Common::applyDelta(base, sizeof(base), truncated, out, sizeof(out)));
+
+		// Base too small for the copies
+		Common::MemoryReadStream shortBase(delta.getData(), delta.size());
+		TS_ASSERT(!Common::applyDelta(base, 10, shortBase, out, sizeof(out)));
+
+		// Trailing data
+		delta.writeByte(0);
+		Common::MemoryReadStream trailing(delta.getData(), delta.size());
+		TS_ASSERT(!Common::applyDelta(base, sizeof(base), trailing, out, sizeof(out)));
+	}
+};
@@ -0,0 +1,339 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/array.h"
+#include "common/compression/installshield_cab.h"
+#include "common/hashmap.h"
+#include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/str.h"
+
+/**
+ * Tests for reading InstallShield cabinet members in place: files split
+ * across volumes, and files compressed in independent chunks. The cabinets
+ * are built in memory, in the version 5 format.
+ */
+class InstallShieldCabTestSuite : public CxxTest::TestSuite {
+	class MemoryArchive : public Common::Archive {
+	public:
+		void addFile(const Common::Path &path, Common::MemoryWriteStreamDynamic &data) {
+			_files[path] = Common::Array<byte>(data.getData(), data.size());
+		}
+
+		bool hasFile(const Common::Path &path) const override { return _files.contains(path); }
+
+		int listMembers(Common::ArchiveMemberList &list) const override {
+			for (const auto &file : _files)
+				list.push_back(getMember(file._key));
+			return _files.size();
+		}
+
+		const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+			return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(path, *this));
+		}
+
+		Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override {
+			if (!_files.contains(path))
+				return nullptr;
+			const Common::Array<byte> &data = _files[path];
+			return new Common::MemoryReadStream(data.data(), data.size());
+		}
+
+	private:
+		typedef Common::HashMap<Common::Path, Common::Array<byte>, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> FileMap;
+		FileMap _files;
+	};
+
+	enum {
+		kHeaderSize = 60,
+		kEntrySize = 42,
+		kCompressed = 4
+	};
+
+	struct File {
+		const char *name;
+		uint16 flags;
+		uint32 uncompressedSize;
+		Common::Array<byte> data; ///< Data in the first volume
+	};
+
+	static byte dataAt(uint32 pos) {
+		return (byte)(pos * 7 + (pos >> 8));
+	}
+
+	static void writeVolumeHeader(Common::WriteStream &out, uint32 descriptorOffset, uint32 firstIndex, uint32 lastIndex,
+			uint32 firstOffset, uint32 firstSize, uint32 lastOffset, uint32 lastSize) {
+		out.writeUint32LE(0x28635349);
+		out.writeUint32LE(500); // version 5
+		out.writeUint32LE(0);
+		out.writeUint32LE(descriptorOffset);
+		out.writeUint32LE(0);
+		out.writeUint32LE(kHeaderSize);
+		out.writeUint32LE(0);
+		out.writeUint32LE(firstIndex);
+		out.writeUint32LE(lastIndex);
+		out.writeUint32LE(firstOffset);
+		out.writeUint32LE(firstSize);
+		out.writeUint32LE(firstSize);
+		out.writeUint32LE(lastOffset);
+		out.writeUint32LE(lastSize);
+		out.writeUint32LE(lastSize);
+	}
+
+	/**
+	 * Builds the volumes of a cabinet holding @p files. The data of the last
+	 * file continues in one more volume for each entry of @p splitParts.
+	 */
+	static void addCabinet(MemoryArchive &archive, const Common::Array<File> &files, const Common::Array<Common::Array<byte> > &splitParts) {
+		const uint32 count = files.size();
+		const uint32 tableSize = count * 4 + count * kEntrySize;
+		uint32 namesSize = 0;
+		for (uint32 i = 0; i < count; i++)
+			namesSize += strlen(files[i].name) + 1;
+
+		const uint32 descriptorSize = 44;
+		uint32 dataOffset = kHeaderSize + descriptorSize + tableSize + namesSize;
+
+		Common::Array<uint32> offsets;
+		for (uint32 i = 0; i < count; i++) {
+			offsets.push_back(dataOffset);
+			dataOffset += files[i].data.size();
+		}
+
+		uint32 totalSplit = 0;
+		for (uint32 i = 0; i < splitParts.size(); i++)
+			totalSplit += splitParts[i].size();
+
+		Common::MemoryWriteStreamDynamic volume(DisposeAfterUse::YES);
+		writeVolumeHeader(volume, kHeaderSize, 0, count - 1, offsets[0], files[0].data.size(),
+			offsets[count - 1], files[count - 1].data.size());
+
+		// Cabinet descriptor
+		for (int i = 0; i < 3; i++)
+			volume.writeUint32LE(0);
+		volume.writeUint32LE(descriptorSize); // file table offset
+		volume.writeUint32LE(0);
+		volume.writeUint32LE(tableSize + namesSize);
+		volume.writeUint32LE(tableSize + namesSize);
+		volume.writeUint32LE(0); // directories
+		volume.writeUint32LE(0);
+		volume.writeUint32LE(0);
+		volume.writeUint32LE(count);
+
+		// File table, relative to its start
+		for (uint32 i = 0; i < count; i++)
+			volume.writeUint32LE(count * 4 + i * kEntrySize);
+
+		uint32 nameOffset = tableSize;
+		for (uint32 i = 0; i < count; i++) {
+			const bool last = i == count - 1;
+			const uint32 size = files[i].data.size() + (last ? totalSplit : 0);
+
+			volume.writeUint32LE(nameOffset);
+			volume.writeUint32LE(0);
+			volume.writeUint16LE(files[i].flags);
+			volume.writeUint32LE(files[i].uncompressedSize);
+			volume.writeUint32LE(size);
+			for (int j = 0; j < 5; j++)
+				volume.writeUint32LE(0);
+			volume.writeUint32LE(offsets[i]);
+			nameOffset += strlen(files[i].name) + 1;
+		}
+
+		for (uint32 i = 0; i < count; i++)
+			volume.write(files[i].name, strlen(files[i].name) + 1);
+
+		for (uint32 i = 0; i < count; i++)
+			volume.write(files[i].data.data(), files[i].data.size());
+
+		archive.addFile(Common::Path("data1.cab"), volume);
+
+		for (uint32 i = 0; i < splitParts.size(); i++) {
+			Common::MemoryWriteStreamDynamic part(DisposeAfterUse::YES);
+			const uint32 size = splitParts[i].size();
+			writeVolumeHeader(part, 0, count - 1, count - 1, kHeaderSize, size, kHeaderSize, size);
+			part.write(splitParts[i].data(), size);
+			archive.addFile(Common::Path(Common::String::format("data%d.cab", i + 2)), part);
+		}
+	}
+
+	static Common::Array<byte> createData(uint32 start, uint32 size) {
+		Common::Array<byte> data(size);
+		for (uint32 i = 0; i < size; i++)
+			data[i] = dataAt(start + i);
+		return data;
+	}
+
+	// Builds chunks of stored deflate blocks, each one a complete stream
+	static Common::Array<byte> createChunks(const uint32 *sizes, int count, uint32 &total) {
+		Common::MemoryWriteStreamDynamic out(DisposeAfterUse::YES);
+		total = 0;
+		for (int i = 0; i < count; i++) {
+			out.writeUint16LE(5 + sizes[i]);
+			out.writeByte(1); // final stored block
+			out.writeUint16LE(sizes[i]);
+			out.writeUint16LE(~sizes[i]);
+			for (uint32 j = 0; j < sizes[i]; j++)
+				out.writeByte(dataAt(total + j));
+			total += sizes[i];
+		}
+
+		return Common::Array<byte>(out.getData(), out.size());
+	}
+
+	static bool checkRead(Common::SeekableReadStream &stream, uint32 pos, uint32 len) {
+		Common::Array<byte> buf(len);
+		if (!stream.seek(pos) || stream.read(buf.data(), len) != len || stream.pos() != (int64)(pos + len))
+			return false;
+
+		for (uint32 i = 0; i < len; i++) {
+			if (buf[i] != dataAt(pos + i))
+				return false;
+		}
+		return true;
+	}
+
+	static void checkStream(Common::SeekableReadStream &stream, uint32 size, const uint32 *boundaries, int count, uint32 step) {
+		TS_ASSERT_EQUALS(stream.size(), (int64)size);
+
+		// Everything at once, then in small pieces
+		TS_ASSERT(checkRead(stream, 0, size));
+		for (uint32 pos = 0; pos + 5 <= size; pos += step)
+			TS_ASSERT(checkRead(stream, pos, 5));
+
+		// Backwards across every boundary
+		for (int i = count - 1; i >= 0; i--) {
+			if (boundaries[i] >= 3 && boundaries[i] + 3 <= size)
+				TS_ASSERT(checkRead(stream, boundaries[i] - 3, 6));
+		}
+
+		// Relative seeks
+		TS_ASSERT(stream.seek(-10, SEEK_END));
+		TS_ASSERT_EQUALS(stream.pos(), (int64)size - 10);
+		TS_ASSERT(stream.seek(-20, SEEK_CUR));
+		TS_ASSERT_EQUALS(stream.pos(), (int64)size - 30);
+		TS_ASSERT(!stream.seek(size + 1));
+		TS_ASSERT(!stream.seek(-1));
+
+		// Reading past the end
+		byte buf[16];
+		TS_ASSERT(stream.seek(size - 4));
+		TS_ASSERT_EQUALS(stream.read(buf, sizeof(buf)), 4u);
+		TS_ASSERT(stream.eos());
+		TS_ASSERT(!stream.err());
+		TS_ASSERT(stream.seek(0));
+		TS_ASSERT(!stream.eos());
+	}
+
+public:
+	void test_split_file() {
+		static const uint32 sizes[] = { 7, 0, 4097, 13 };
+		uint32 boundaries[ARRAYSIZE(sizes)];
+		uint32 total = 0;
+
+		Common::Array<File> files(1);
+		Common::Array<Common::Array<byte> > parts;
+		for (int i = 0; i < ARRAYSIZE(sizes); i++) {
+			if (i == 0)
+				files[0].data = createData(total, sizes[i]);
+			else
+				parts.push_back(createData(total, sizes[i]));
+			total += sizes[i];
+			boundaries[i] = total;
+		}
+		files[0].name = "split.bin";
+		files[0].flags = 0;
+		files[0].uncompressedSize = total;
+
+		MemoryArchive archive;
+		addCabinet(archive, files, parts);
+		Common::ScopedPtr<Common::Archive> cab(Common::makeInstallShieldArchive(Common::Path("data"), archive));
+		TS_ASSERT(cab);
+		if (!cab)
+			return;
+
+		Common::ScopedPtr<Common::SeekableReadStream> stream(cab->createReadStreamForMember(Common::Path("split.bin")));
+		TS_ASSERT(stream);
+		if (stream)
+			checkStream(*stream, total, boundaries, ARRAYSIZE(boundaries), 5);
+	}
+
+	void test_chunked() {
+		// Only files larger than 1 MB are decompressed on demand
+		Common::Array<uint32> sizes;
+		for (int i = 0; i < 20; i++)
+			sizes.push_back(60000 + i * 11);
+		sizes.push_back(1);
+		sizes.push_back(500);
+
+		Common::Array<uint32> boundaries;
+		uint32 total = 0;
+		for (uint i = 0; i < sizes.size(); i++) {
+			total += sizes[i];
+			boundaries.push_back(total);
+		}
+
+		const Common::Array<uint32> truncatedSizes(20, 60000);
+		uint32 truncatedTotal;
+
+		Common::Array<File> files(2);
+		files[0].name = "chunked.bin";
+		files[0].flags = kCompressed;
+		files[0].data = createChunks(sizes.data(), sizes.size(), total);
+		files[0].uncompressedSize = total;
+		files[1].name = "truncated.bin";
+		files[1].flags = kCompressed;
+		files[1].data = createChunks(truncatedSizes.data(), truncatedSizes.size(), truncatedTotal);
+		files[1].uncompressedSize = truncatedTotal + 50;
+
+		MemoryArchive archive;
+		addCabinet(archive, files, Common::Array<Common::Array<byte> >());
+		Common::ScopedPtr<Common::Archive> cab(Common::makeInstallShieldArchive(Common::Path("data"), archive));
+		TS_ASSERT(cab);
+		if (!cab)
+			return;
+
+		// Seeking straight to the end before any chunk was read
+		Common::ScopedPtr<Common::SeekableReadStream> stream(cab->createReadStreamForMember(Common::Path("chunked.bin")));
+		TS_ASSERT(stream);
+		if (stream) {
+			TS_ASSERT(checkRead(*stream, total - 100, 100));
+			checkStream(*stream, total, boundaries.data(), boundaries.size(), 4999);
+		}
+
+		// Missing data is an error, but the chunks before it can still be read
+		stream.reset(cab->createReadStreamForMember(Common::Path("truncated.bin")));
+		TS_ASSERT(stream);
+		if (!stream)
+			return;
+
+		Common::Array<byte> buf(truncatedTotal + 50);
+		TS_ASSERT_EQUALS(stream->read(buf.data(), buf.size()), truncatedTotal);
+		TS_ASSERT(stream->err());
+
+		stream->clearErr();
+		TS_ASSERT(checkRead(*stream, 599950, 100));
+		TS_ASSERT(!stream->err());
+	}
+};
@@ -0,0 +1,156 @@
+#include <cxxtest/TestSuite.h>
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/archive.h"
+#include "common/crc.h"
+#include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/compression/deflate.h"
+#include "common/compression/unzip.h"
+
+class ZipArchiveTestSuite : public CxxTest::TestSuite {
+	struct Entry {
+		Common::String name;
+		uint16 method;
+		uint32 crc, size, offset;
+		Common::Array<byte> data;
+	};
+
+	static void fill(Common::Array<byte> &data, uint32 size) {
+		data.resize(size);
+		uint32 seed = 3;
+		for (uint32 i = 0; i < size; i++) {
+			seed = seed * 1103515245 + 12345;
+			data[i] = "zip archive"[(seed >> 16) % 11];
+		}
+	}
+
+	static void addEntry(Common::Array<Entry> &entries, const char *name, const Common::Array<byte> &contents, bool compress) {
+		Entry entry;
+		entry.name = name;
+		entry.method = 0;
+		entry.size = contents.size();
+		entry.crc = Common::CRC32().crcFast(contents.data(), contents.size());
+		entry.offset = 0;
+		entry.data = contents;
+
+#ifdef USE_ZLIB
+		if (compress) {
+			// Strip the gzip header and trailer to get raw deflate data
+			Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES);
+			Common::WriteStream *gz = Common::wrapCompressedWriteStream(mem);
+			gz->write(contents.data(), contents.size());
+			gz->finalize();
+			entry.data = Common::Array<byte>(mem->getData() + 10, mem->size() - 18);
+			entry.method = 8;
+			delete gz;
+		}
+#endif
+
+		entries.push_back(entry);
+	}
+
+	static Common::SeekableReadStream *buildZip(Common::Array<Entry> &entries) {
+		Common::MemoryWriteStreamDynamic out(DisposeAfterUse::NO);
+
+		for (auto &entry : entries) {
+			entry.offset = out.pos();
+			out.writeUint32LE(0x04034b50);
+			out.writeUint16LE(20);
+			out.writeUint16LE(0);
+			out.writeUint16LE(entry.method);
+			out.writeUint32LE(0);
+			out.writeUint32LE(entry.crc);
+			out.writeUint32LE(entry.data.size());
+			out.writeUint32LE(entry.size);
+			out.writeUint16LE(entry.name.size());
+			out.writeUint16LE(0);
+			out.writeString(entry.name);
+			out.write(entry.data.data(), entry.data.size());
+		}
+
+		uint32 centralDir = out.pos();
+		for (auto &entry : entries) {
+			out.writeUint32LE(0x02014b50);
+			out.writeUint16LE(20);
+			out.writeUint16LE(20);
+			out.writeUint16LE(0);
+			out.writeUint16LE(entry.method);
+			out.writeUint32LE(0);
+			out.writeUint32LE(entry.crc);
+			out.writeUint32LE(entry.data.size());
+			out.writeUint32LE(entry.size);
+			out.writeUint16LE(entry.name.size());
+			out.writeUint16LE(0);
+			out.writeUint16LE(0);
+			out.writeUint16LE(0);
+			out.writeUint16LE(0);
+			out.writeUint32LE(0);
+			out.writeUint32LE(entry.offset);
+			out.writeString(entry.name);
+		}
+		uint32 centralDirSize = out.pos() - centralDir;
+
+		out.writeUint32LE(0x06054b50);
+		out.writeUint16LE(0);
+		out.writeUint16LE(0);
+		out.writeUint16LE(entries.size());
+		out.writeUint16LE(entries.size());
+		out.writeUint32LE(centralDirSize);
+		out.writeUint32LE(centralDir);
+		out.writeUint16LE(0);
+
+		return new Common::MemoryReadStream(out.getData(), out.size(), DisposeAfterUse::YES);
+	}
+
+	static bool checkMember(Common::SeekableReadStream *stream, const Common::Array<byte> &contents) {
+		if (!stream || stream->size() != (int64)contents.size())
+			return false;
+
+		// Read the second half first to exercise seeking
+		Common::Array<byte> buf(contents.size());
+		uint32 half = contents.size() / 2;
+		stream->seek(half);
+		if (stream->read(buf.data() + half, contents.size() - half) != contents.size() - half)
+			return false;
+		stream->seek(0);
+		if (stream->read(buf.data(), half) != half)
+			return false;
+		return memcmp(buf.data(), contents.data(), contents.size()) == 0;
+	}
+
+public:
+	void test_members() {
+		Common::Array<byte> small, large, huge;
+		fill(small, 1000);
+		fill(large, 200 * 1024);
+		fill(huge, 3 * 1024 * 1024);
+
+		Common::Array<Entry> entries;
+		addEntry(entries, "small.bin", small, false);
+		addEntry(entries, "stored.bin", large, false);
+		addEntry(entries, "deflated-small.bin", small, true);
+		addEntry(entries, "deflated.bin", huge, true);
+
+		Common::ScopedPtr<Common::Archive> zip(Common::makeZipArchive(buildZip(entries)));
+		TS_ASSERT(zip);
+
+		Common::ScopedPtr<Common::SeekableReadStream> stream(zip->createReadStreamForMember("small.bin"));
+		TS_ASSERT(checkMember(stream.get(), small));
+		stream.reset(zip->createReadStreamForMember("deflated-small.bin"));
+		TS_ASSERT(checkMember(stream.get(), small));
+		stream.reset(zip->createReadStreamForMember("deflated.bin"));
+		TS_ASSERT(checkMember(stream.get(), huge));
+
+		// Large members remain readable after the archive is closed
+		Common::ScopedPtr<Common::SeekableReadStream> stored(zip->createReadStreamForMember("stored.bin"));
+		Common::ScopedPtr<Common::SeekableReadStream> other(zip->createReadStreamForMember("stored.bin"));
+		zip.reset();
+
+		TS_ASSERT(checkMember(stored.get(), large));
+		TS_ASSERT(checkMember(other.get(), large));
+	}
+};
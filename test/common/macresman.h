@@ -0,0 +1,237 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/macresman.h"
+#include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/substream.h"
+
+#include "../system/null_osystem.h"
+
+class MacResManagerTestSuite : public CxxTest::TestSuite {
+	// Archive serving a raw resource fork as "test.rsrc"
+	class ForkArchive : public Common::Archive {
+	public:
+		ForkArchive(Common::SeekableReadStream *fork) : _fork(fork) {}
+
+		void setFork(Common::SeekableReadStream *fork) { _fork.reset(fork); }
+
+		bool hasFile(const Common::Path &path) const override {
+			return path.equalsIgnoreCase(Common::Path("test.rsrc"));
+		}
+
+		int listMembers(Common::ArchiveMemberList &list) const override {
+			list.push_back(getMember(Common::Path("test.rsrc")));
+			return 1;
+		}
+
+		const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+			if (!hasFile(path))
+				return Common::ArchiveMemberPtr();
+			return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(path, *this));
+		}
+
+		Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override {
+			if (!hasFile(path))
+				return nullptr;
+			return new Common::SeekableSubReadStream(_fork.get(), 0, _fork->size());
+		}
+
+	private:
+		Common::ScopedPtr<Common::SeekableReadStream> _fork;
+	};
+
+	struct TestResource {
+		uint32 type;
+		uint16 id;
+		const char *name;
+		const char *data;
+	};
+
+	// Builds a raw resource fork holding the given resources, sorted by type
+	static Common::SeekableReadStream *createFork(const TestResource *resources, int count) {
+		Common::MemoryWriteStreamDynamic data(DisposeAfterUse::YES);
+		Common::MemoryWriteStreamDynamic refs(DisposeAfterUse::YES);
+		Common::MemoryWriteStreamDynamic names(DisposeAfterUse::YES);
+		Common::Array<uint32> types;
+		Common::Array<uint16> typeCounts;
+
+		for (int i = 0; i < count; i++) {
+			if (types.empty() || types.back() != resources[i].type) {
+				types.push_back(resources[i].type);
+				typeCounts.push_back(0);
+			}
+			typeCounts.back()++;
+		}
+
+		const uint32 typeListSize = 2 + types.size() * 8;
+		for (int i = 0; i < count; i++) {
+			refs.writeUint16BE(resources[i].id);
+			if (resources[i].name) {
+				refs.writeUint16BE(names.pos());
+				names.writeByte(strlen(resources[i].name));
+				names.writeString(resources[i].name);
+			} else {
+				refs.writeUint16BE(0xFFFF);
+			}
+			refs.writeUint32BE(data.pos());
+			refs.writeUint32BE(0);
+
+			data.writeUint32BE(strlen(resources[i].data));
+			data.writeString(resources[i].data);
+		}
+
+		Common::MemoryWriteStreamDynamic map(DisposeAfterUse::YES);
+		map.writeMultipleBE(uint32(0), uint32(0), uint32(0), uint32(0), uint32(0), uint16(0));
+		map.writeUint16BE(0); // attributes
+		map.writeUint16BE(28);
+		map.writeUint16BE(28 + typeListSize + refs.size());
+		map.writeUint16BE(types.size() - 1);
+		uint32 refOffset = typeListSize;
+		for (uint i = 0; i < types.size(); i++) {
+			map.writeUint32BE(types[i]);
+			map.writeUint16BE(typeCounts[i] - 1);
+			map.writeUint16BE(refOffset);
+			refOffset += typeCounts[i] * 12;
+		}
+		map.write(refs.getData(), refs.size());
+		map.write(names.getData(), names.size());
+
+		Common::MemoryWriteStreamDynamic fork(DisposeAfterUse::NO);
+		fork.writeUint32BE(16);
+		fork.writeUint32BE(16 + data.size());
+		fork.writeUint32BE(data.size());
+		fork.writeUint32BE(map.size());
+		fork.write(data.getData(), data.size());
+		fork.write(map.getData(), map.size());
+
+		return new Common::MemoryReadStream(fork.getData(), fork.size(), DisposeAfterUse::YES);
+	}
+
+	static Common::String readString(Common::SeekableReadStream *stream) {
+		Common::ScopedPtr<Common::SeekableReadStream> owned(stream);
+		if (!stream)
+			return "<null>";
+		return stream->readString(0, stream->size());
+	}
+
+public:
+	void setUp() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+		Common::MacResMapCache::destroy();
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_lookups() {
+		static const TestResource resources[] = {
+			{ MKTAG('P', 'I', 'C', 'T'), 128, "Title", "title picture" },
+			{ MKTAG('P', 'I', 'C', 'T'), 129, nullptr, "second picture" },
+			{ MKTAG('P', 'I', 'C', 'T'), 128, "Duplicate", "shadowed" },
+			{ MKTAG('S', 'T', 'R', ' '), 128, "title", "a string" },
+			{ MKTAG('s', 'n', 'd', ' '), 5, "Boom", "" }
+		};
+
+		ForkArchive archive(createFork(resources, ARRAYSIZE(resources)));
+		Common::MacResManager resMan;
+		TS_ASSERT(resMan.open(Common::Path("test"), archive));
+		TS_ASSERT(resMan.hasResFork());
+
+		TS_ASSERT_EQUALS(resMan.getResTagArray().size(), 3u);
+		TS_ASSERT_EQUALS(resMan.getResIDArray(MKTAG('P', 'I', 'C', 'T')).size(), 3u);
+		TS_ASSERT_EQUALS(resMan.getResIDArray(MKTAG('N', 'O', 'N', 'E')).size(), 0u);
+
+		// The first resource with a given id or name wins
+		TS_ASSERT_EQUALS(readString(resMan.getResource(MKTAG('P', 'I', 'C', 'T'), 128)), "title picture");
+		TS_ASSERT_EQUALS(readString(resMan.getResource(MKTAG('P', 'I', 'C', 'T'), 129)), "second picture");
+		TS_ASSERT_EQUALS(readString(resMan.getResource("TITLE")), "title picture");
+		TS_ASSERT_EQUALS(readString(resMan.getResource(MKTAG('S', 'T', 'R', ' '), "Title")), "a string");
+		TS_ASSERT_EQUALS(readString(resMan.getResource(MKTAG('P', 'I', 'C', 'T'), 130)), "<null>");
+
+		// Empty resources are ignored
+		TS_ASSERT_EQUALS(readString(resMan.getResource(MKTAG('s', 'n', 'd', ' '), 5)), "<null>");
+		TS_ASSERT_EQUALS(resMan.getResLength(MKTAG('s', 'n', 'd', ' '), 5), 0u);
+
+		TS_ASSERT_EQUALS(resMan.getResLength(MKTAG('S', 'T', 'R', ' '), 128), 8u);
+		TS_ASSERT_EQUALS(resMan.getResName(MKTAG('P', 'I', 'C', 'T'), 128), "Title");
+		TS_ASSERT_EQUALS(resMan.getResName(MKTAG('P', 'I', 'C', 'T'), 129), "");
+		TS_ASSERT_EQUALS(resMan.getResID(MKTAG('s', 'n', 'd', ' '), "boom"), 5);
+		TS_ASSERT_EQUALS(resMan.getResID(MKTAG('s', 'n', 'd', ' '), "Title"), 0);
+	}
+
+	void test_reopen() {
+		static const TestResource resources[] = {
+			{ MKTAG('T', 'E', 'X', 'T'), 1, "One", "first" },
+			{ MKTAG('T', 'E', 'X', 'T'), 2, "Two", "second" }
+		};
+
+		// Reopening a file shares its map, which survives the other managers being closed
+		ForkArchive archive(createFork(resources, ARRAYSIZE(resources)));
+		Common::MacResManager first, second;
+		TS_ASSERT(first.open(Common::Path("test"), archive));
+		TS_ASSERT(second.open(Common::Path("test"), archive));
+		TS_ASSERT_EQUALS(Common::MacResMapCache::instance().size(), 1u);
+		first.close();
+
+		TS_ASSERT_EQUALS(readString(second.getResource("two")), "second");
+		TS_ASSERT_EQUALS(readString(second.getResource(MKTAG('T', 'E', 'X', 'T'), 1)), "first");
+		TS_ASSERT_EQUALS(first.getResIDArray(MKTAG('T', 'E', 'X', 'T')).size(), 0u);
+		TS_ASSERT_EQUALS(readString(first.getResource("two")), "<null>");
+
+		// Identical forks in other archives are distinct files
+		ForkArchive other(createFork(resources, ARRAYSIZE(resources)));
+		TS_ASSERT(first.open(Common::Path("test"), other));
+		TS_ASSERT_EQUALS(Common::MacResMapCache::instance().size(), 2u);
+		TS_ASSERT_EQUALS(readString(first.getResource("one")), "first");
+	}
+
+	void test_changed_file() {
+		static const TestResource before[] = {
+			{ MKTAG('T', 'E', 'X', 'T'), 1, "One", "first" }
+		};
+		static const TestResource after[] = {
+			{ MKTAG('T', 'E', 'X', 'T'), 1, "One", "first" },
+			{ MKTAG('T', 'E', 'X', 'T'), 2, "Two", "second" }
+		};
+
+		// A file replaced under the same name must not reuse the stale map
+		ForkArchive archive(createFork(before, ARRAYSIZE(before)));
+		Common::MacResManager resMan;
+		TS_ASSERT(resMan.open(Common::Path("test"), archive));
+		TS_ASSERT_EQUALS(resMan.getResIDArray(MKTAG('T', 'E', 'X', 'T')).size(), 1u);
+
+		resMan.close();
+		archive.setFork(createFork(after, ARRAYSIZE(after)));
+		TS_ASSERT(resMan.open(Common::Path("test"), archive));
+		TS_ASSERT_EQUALS(resMan.getResIDArray(MKTAG('T', 'E', 'X', 'T')).size(), 2u);
+		TS_ASSERT_EQUALS(readString(resMan.getResource("two")), "second");
+	}
+
+	void test_same_layout() {
+		static const TestResource before[] = {
+			{ MKTAG('T', 'E', 'X', 'T'), 1, "One", "first" }
+		};
+		static const TestResource after[] = {
+			{ MKTAG('T', 'E', 'X', 'T'), 2, "Two", "other" }
+		};
+
+		// A different file with the same fork layout, as a new archive at the
+		// address of a deleted one would have
+		ForkArchive archive(createFork(before, ARRAYSIZE(before)));
+		Common::MacResManager resMan;
+		TS_ASSERT(resMan.open(Common::Path("test"), archive));
+		TS_ASSERT(resMan.getResName(MKTAG('T', 'E', 'X', 'T'), 1) == "One");
+
+		resMan.close();
+		archive.setFork(createFork(after, ARRAYSIZE(after)));
+		TS_ASSERT(resMan.open(Common::Path("test"), archive));
+		TS_ASSERT(resMan.getResName(MKTAG('T', 'E', 'X', 'T'), 1).empty());
+		TS_ASSERT_EQUALS(readString(resMan.getResource("Two")), "other");
+	}
+};
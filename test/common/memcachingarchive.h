@@ -0,0 +1,96 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/ptr.h"
+#include "common/stream.h"
+
+class MemcachingArchiveTestSuite : public CxxTest::TestSuite {
+	// Archive with files "0" to "9", file n being (n + 1) * 100 bytes long
+	class TestArchive : public Common::MemcachingCaseInsensitiveArchive {
+	public:
+		TestArchive() : Common::MemcachingCaseInsensitiveArchive(512, 1000), reads(0) {}
+
+		bool hasFile(const Common::Path &path) const override {
+			Common::String name = path.toString();
+			return name.size() == 1 && Common::isDigit(name[0]);
+		}
+
+		int listMembers(Common::ArchiveMemberList &list) const override { return 0; }
+
+		const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+			return Common::ArchiveMemberPtr();
+		}
+
+		Common::SharedArchiveContents readContentsForPath(const Common::Path &path) const override {
+			if (!hasFile(path))
+				return Common::SharedArchiveContents();
+
+			reads++;
+			uint32 size = (path.toString()[0] - '0' + 1) * 100;
+			byte *data = new byte[size];
+			memset(data, path.toString()[0], size);
+			return Common::SharedArchiveContents(data, size);
+		}
+
+		mutable int reads;
+	};
+
+	static bool open(TestArchive &archive, const char *name) {
+		Common::ScopedPtr<Common::SeekableReadStream> stream(archive.createReadStreamForMember(name));
+		return stream && stream->readByte() == name[0];
+	}
+
+public:
+	void test_lru() {
+		TestArchive archive;
+
+		// 100 + 200 + 300 + 400 bytes are kept within the budget
+		for (int i = 0; i < 2; i++) {
+			TS_ASSERT(open(archive, "0"));
+			TS_ASSERT(open(archive, "1"));
+			TS_ASSERT(open(archive, "2"));
+			TS_ASSERT(open(archive, "3"));
+		}
+		TS_ASSERT_EQUALS(archive.reads, 4);
+
+		Common::MemcachingCaseInsensitiveArchive::CacheStats stats = archive.getCacheStats();
+		TS_ASSERT_EQUALS(stats.hits, 4u);
+		TS_ASSERT_EQUALS(stats.misses, 4u);
+		TS_ASSERT_EQUALS(stats.cachedBytes, 1000u);
+		TS_ASSERT_EQUALS(stats.evictedBytes, 0u);
+
+		// Use file 0 again, so that files 1 and 2 are the least recently used
+		TS_ASSERT(open(archive, "0"));
+		TS_ASSERT(open(archive, "4"));
+		stats = archive.getCacheStats();
+		TS_ASSERT_EQUALS(stats.cachedBytes, 1000u);
+		TS_ASSERT_EQUALS(stats.evictedBytes, 500u);
+
+		archive.reads = 0;
+		TS_ASSERT(open(archive, "0"));
+		TS_ASSERT(open(archive, "3"));
+		TS_ASSERT(open(archive, "4"));
+		TS_ASSERT_EQUALS(archive.reads, 0);
+		TS_ASSERT(open(archive, "1"));
+		TS_ASSERT_EQUALS(archive.reads, 1);
+
+		// Contents over the size limit are not kept...
+		archive.reads = 0;
+		TS_ASSERT(open(archive, "9"));
+		TS_ASSERT(open(archive, "9"));
+		TS_ASSERT_EQUALS(archive.reads, 2);
+
+		// ...unless they are still in use
+		Common::ScopedPtr<Common::SeekableReadStream> stream(archive.createReadStreamForMember("8"));
+		TS_ASSERT(open(archive, "8"));
+		TS_ASSERT_EQUALS(archive.reads, 3);
+
+		// Missing files are cached as well
+		TS_ASSERT(!open(archive, "missing"));
+		TS_ASSERT(!open(archive, "missing"));
+
+		archive.setCacheBudget(0);
+		stats = archive.getCacheStats();
+		TS_ASSERT_EQUALS(stats.cachedBytes, 0u);
+	}
+};
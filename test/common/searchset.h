@@ -0,0 +1,179 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+class SearchSetTestSuite : public CxxTest::TestSuite {
+	// Minimal archive holding a set of one byte files
+	class TestArchive : public Common::Archive {
+	public:
+		TestArchive(byte id) : _id(id) {}
+
+		void addFile(const char *name) { _files.push_back(Common::Path(name)); }
+		void addUnlistedFile(const char *name) { _unlistedFiles.push_back(Common::Path(name)); }
+
+		bool hasFile(const Common::Path &path) const override {
+			for (const auto &file : _files) {
+				if (file.equalsIgnoreCase(path))
+					return true;
+			}
+			return false;
+		}
+
+		int listMembers(Common::ArchiveMemberList &list) const override {
+			for (const auto &file : _files)
+				list.push_back(Common::ArchiveMemberPtr(new Common::GenericArchiveMember(file, *this)));
+			return _files.size();
+		}
+
+		const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+			if (!hasFile(path))
+				return Common::ArchiveMemberPtr();
+			return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(path, *this));
+		}
+
+		Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override {
+			if (hasFile(path))
+				return new Common::MemoryReadStream(&_id, 1);
+			for (const auto &file : _unlistedFiles) {
+				if (file.equalsIgnoreCase(path))
+					return new Common::MemoryReadStream(&_id, 1);
+			}
+			return nullptr;
+		}
+
+	private:
+		byte _id;
+		Common::Array<Common::Path> _files;
+		// Files which can be opened, but which hasFile() doesn't report
+		Common::Array<Common::Path> _unlistedFiles;
+	};
+
+	static int readId(Common::SeekableReadStream *stream) {
+		if (!stream)
+			return -1;
+		int id = stream->readByte();
+		delete stream;
+		return id;
+	}
+
+public:
+	void test_priority_lookup() {
+		Common::SearchSet set;
+		TestArchive *low = new TestArchive(1);
+		TestArchive *high = new TestArchive(2);
+		low->addFile("a.dat");
+		low->addFile("b.dat");
+		high->addFile("b.dat");
+
+		set.add("low", low, 0);
+		set.add("high", high, 10);
+
+		// Lookups are answered the same way with or without cached entries
+		for (int i = 0; i < 2; i++) {
+			TS_ASSERT(set.hasFile("a.dat"));
+			TS_ASSERT(set.hasFile("B.DAT"));
+			TS_ASSERT(!set.hasFile("c.dat"));
+			TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 1);
+			TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("b.dat")), 2);
+			TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("c.dat")), -1);
+		}
+
+		uint entries, hits, misses;
+		set.getPathIndexStats(entries, hits, misses);
+		// Missing files are looked up in the archives every time
+		TS_ASSERT_EQUALS(entries, 3u);
+		TS_ASSERT_EQUALS(misses, 7u);
+		TS_ASSERT_EQUALS(hits, 5u);
+
+		Common::Archive *container = nullptr;
+		TS_ASSERT(set.getMember("b.dat", &container));
+		TS_ASSERT_EQUALS(container, high);
+	}
+
+	void test_invalidation() {
+		Common::SearchSet set;
+		TestArchive *first = new TestArchive(1);
+		first->addFile("a.dat");
+		set.add("first", first, 0);
+
+		TS_ASSERT(!set.hasFile("c.dat"));
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 1);
+
+		// Adding an archive with higher priority changes the result
+		TestArchive *second = new TestArchive(2);
+		second->addFile("a.dat");
+		second->addFile("c.dat");
+		set.add("second", second, 5);
+		TS_ASSERT(set.hasFile("c.dat"));
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 2);
+
+		set.setPriority("second", -5);
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 1);
+
+		set.remove("first");
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 2);
+
+		// Changes to a nested search set are picked up as well
+		Common::SearchSet outer;
+		Common::SearchSet *inner = new Common::SearchSet();
+		outer.add("inner", inner);
+		TS_ASSERT(!outer.hasFile("d.dat"));
+		TestArchive *third = new TestArchive(3);
+		third->addFile("d.dat");
+		inner->add("third", third);
+		TS_ASSERT(outer.hasFile("d.dat"));
+
+		// Files added to an archive after a failed lookup are found
+		TS_ASSERT(!outer.hasFile("e.dat"));
+		third->addFile("e.dat");
+		TS_ASSERT(outer.hasFile("e.dat"));
+
+		// Shadowing a file which was already found needs an explicit invalidation
+		TestArchive *fourth = new TestArchive(4);
+		inner->add("fourth", fourth, 10);
+		TS_ASSERT_EQUALS(readId(outer.createReadStreamForMember("e.dat")), 3);
+		fourth->addFile("e.dat");
+		TS_ASSERT_EQUALS(readId(outer.createReadStreamForMember("e.dat")), 3);
+		inner->invalidatePathIndex();
+		TS_ASSERT_EQUALS(readId(outer.createReadStreamForMember("e.dat")), 4);
+	}
+
+	void test_independent_sets() {
+		Common::SearchSet first, second;
+		TestArchive *archive = new TestArchive(1);
+		archive->addFile("a.dat");
+		first.add("archive", archive);
+		TS_ASSERT(first.hasFile("a.dat"));
+
+		// Modifying another search set keeps the cached lookups
+		second.add("other", new TestArchive(2));
+		second.invalidatePathIndex();
+
+		uint entries, hits, misses;
+		first.getPathIndexStats(entries, hits, misses);
+		TS_ASSERT_EQUALS(entries, 1u);
+		TS_ASSERT(first.hasFile("a.dat"));
+		first.getPathIndexStats(entries, hits, misses);
+		TS_ASSERT_EQUALS(hits, 1u);
+		TS_ASSERT_EQUALS(misses, 1u);
+	}
+
+	void test_unlisted_files() {
+		Common::SearchSet set;
+		TestArchive *low = new TestArchive(1);
+		TestArchive *high = new TestArchive(2);
+		low->addFile("a.dat");
+		high->addUnlistedFile("a.dat");
+		high->addUnlistedFile("b.dat");
+		set.add("low", low, 0);
+		set.add("high", high, 10);
+
+		// Files missing from the lookup are still opened by their archive
+		TS_ASSERT(!set.hasFile("b.dat"));
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("b.dat")), 2);
+
+		// Files found by the lookup come from the archive reporting them
+		TS_ASSERT_EQUALS(readId(set.createReadStreamForMember("a.dat")), 1);
+	}
+};
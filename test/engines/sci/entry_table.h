@@ -0,0 +1,94 @@
+#include <cxxtest/TestSuite.h>
+
+#include "engines/sci/engine/entry_table.h"
+
+/**
+ * Test suite for the table of the clone, list, node, hunk, array and bitmap
+ * segments in engines/sci/engine/entry_table.h
+ */
+class SciEntryTableTestSuite : public CxxTest::TestSuite {
+	typedef Sci::EntryTable<int> IntTable;
+
+	void checkInvariants(const IntTable &table) {
+		int used = 0;
+		for (uint i = 0; i < table.size(); i++) {
+			if (table.isValidEntry(i)) {
+				TS_ASSERT(table._table[i].data != nullptr);
+				used++;
+			}
+		}
+		TS_ASSERT_EQUALS(table.entries_used, used);
+
+		// Every free entry is on the free list exactly once
+		uint freeCount = 0;
+		for (int idx = table.first_free; idx != IntTable::HEAPENTRY_INVALID; idx = table._table[idx].next_free) {
+			TS_ASSERT(idx >= 0 && (uint)idx < table.size());
+			TS_ASSERT(!table.isValidEntry(idx));
+			TS_ASSERT(table._table[idx].data == nullptr);
+			if (++freeCount > table.size())
+				break;
+		}
+		TS_ASSERT_EQUALS(freeCount + used, table.size());
+	}
+
+public:
+	void test_reuse_freed_entries() {
+		IntTable table;
+		const int first = table.allocEntry();
+		const int second = table.allocEntry();
+		const int third = table.allocEntry();
+		TS_ASSERT_EQUALS(table.size(), 3U);
+
+		table.freeEntry(second);
+		table.freeEntry(first);
+		TS_ASSERT(!table.isValidEntry(first));
+		TS_ASSERT(table.isValidEntry(third));
+		checkInvariants(table);
+
+		// The slot freed last is reused first
+		TS_ASSERT_EQUALS(table.allocEntry(), first);
+		TS_ASSERT_EQUALS(table.allocEntry(), second);
+		TS_ASSERT_EQUALS(table.allocEntry(), 3);
+		TS_ASSERT_EQUALS(table.size(), 4U);
+		checkInvariants(table);
+	}
+
+	void test_entry_data() {
+		IntTable table;
+		const int idx = table.allocEntry();
+		table[idx] = 42;
+		TS_ASSERT_EQUALS(table.at(idx), 42);
+
+		table.freeEntry(idx);
+		TS_ASSERT_EQUALS(table.allocEntry(), idx);
+		TS_ASSERT(table._table[idx].data != nullptr);
+		checkInvariants(table);
+	}
+
+	void test_allocated_since_gc() {
+		IntTable table;
+		TS_ASSERT(!table.allocated_since_gc);
+
+		const int idx = table.allocEntry();
+		TS_ASSERT(table.allocated_since_gc);
+		table.allocated_since_gc = false;
+
+		// Freeing doesn't allocate anything
+		table.freeEntry(idx);
+		TS_ASSERT(!table.allocated_since_gc);
+
+		// Reusing a free slot does
+		table.allocEntry();
+		TS_ASSERT(table.allocated_since_gc);
+	}
+
+	void test_invalid_entries() {
+		IntTable table;
+		TS_ASSERT(!table.isValidEntry(-1));
+		TS_ASSERT(!table.isValidEntry(0));
+
+		table.allocEntry();
+		TS_ASSERT(table.isValidEntry(0));
+		TS_ASSERT(!table.isValidEntry(1));
+	}
+};
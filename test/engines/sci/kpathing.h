@@ -0,0 +1,320 @@
+#include <cxxtest/TestSuite.h>
+
+#include "engines/sci/engine/kpathing.h"
+
+/**
+ * Test suite for the pathfinding in engines/sci/engine/kpathing_search.cpp.
+ * Paths found with the cached visibility graphs must match the ones of the
+ * original implementation, which is kept here.
+ */
+class SciPathfindingTestSuite : public CxxTest::TestSuite {
+	enum {
+		kBarredAccess = 2,
+		kContainedAccess = 3,
+		kWidth = 320,
+		kHeight = 190
+	};
+
+	uint32 _seed;
+
+	int nextRandom(int max) {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) % max;
+	}
+
+	static void addPolygon(Common::Array<int16> &polygons, int type, const int16 *points, int count) {
+		polygons.push_back(type);
+		polygons.push_back(count);
+		for (int i = 0; i < count * 2; i++)
+			polygons.push_back(points[i]);
+	}
+
+	static void addRect(Common::Array<int16> &polygons, int16 left, int16 top, int16 right, int16 bottom) {
+		const int16 points[] = { left, top, right, top, right, bottom, left, bottom };
+		addPolygon(polygons, kBarredAccess, points, 4);
+	}
+
+	// The original implementation of AStar(), which computes the visible
+	// vertices as it goes and keeps its sets in lists
+	static void AStarReference(Sci::PathfindingState *s, bool borderPenalty) {
+		// Vertices of which the shortest path is known
+		Sci::VertexList closedSet;
+
+		// The remaining vertices
+		Sci::VertexList openSet;
+
+		openSet.push_front(s->vertex_start);
+		s->vertex_start->costG = 0;
+		s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+
+		while (!openSet.empty()) {
+			// Find vertex in open set with lowest F cost
+			Sci::VertexList::iterator vertex_min_it = openSet.end();
+			Sci::Vertex *vertex_min = nullptr;
+			uint32 min = HUGE_DISTANCE;
+
+			for (Sci::VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
+				Sci::Vertex *vertex = *it;
+				if (vertex->costF < min) {
+					vertex_min_it = it;
+					vertex_min = *vertex_min_it;
+					min = vertex->costF;
+				}
+			}
+
+			assert(vertex_min != nullptr);	// the vertex cost should never be bigger than HUGE_DISTANCE
+
+			// Check if we are done
+			if (vertex_min == s->vertex_end)
+				break;
+
+			// Move vertex from set open to set closed
+			closedSet.push_front(vertex_min);
+			openSet.erase(vertex_min_it);
+
+			Sci::VertexList *visVerts = Sci::visible_vertices(s, vertex_min);
+
+			for (Sci::VertexList::iterator it = visVerts->begin(); it != visVerts->end(); ++it) {
+				uint32 new_dist;
+				Sci::Vertex *vertex = *it;
+
+				if (closedSet.contains(vertex))
+					continue;
+
+				if (!openSet.contains(vertex))
+					openSet.push_front(vertex);
+
+				new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
+
+				if (borderPenalty && s->pointOnScreenBorder(vertex->v))
+					new_dist += 10000;
+
+				if (new_dist < vertex->costG) {
+					vertex->costG = new_dist;
+					vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
+					vertex->path_prev = vertex_min;
+				}
+			}
+
+			delete visVerts;
+		}
+	}
+
+	// Finds the path with the given search, from the end point back to the
+	// start point
+	static void findPath(Sci::PathfindingState *s, bool reference, Common::Array<Common::Point> &path) {
+		for (int i = 0; i < s->vertices; i++) {
+			Sci::Vertex *vertex = s->vertex_index[i];
+			vertex->costG = HUGE_DISTANCE;
+			vertex->path_prev = nullptr;
+			vertex->openOrder = 0;
+			vertex->closed = false;
+		}
+
+		if (reference)
+			AStarReference(s, true);
+		else
+			Sci::AStar(s, true);
+
+		path.clear();
+		for (Sci::Vertex *vertex = s->vertex_end; vertex; vertex = vertex->path_prev)
+			path.push_back(vertex->v);
+	}
+
+	// Prepares the polygons and points like kAvoidPath. Each polygon is given
+	// as its type, its vertex count and the coordinates of its vertices.
+	// Returns nullptr if the start or end point couldn't be fixed up.
+	static Sci::PathfindingState *preparePolygons(Sci::PathfindingCache &cache, const Common::Array<int16> &polygons, Common::Point start, Common::Point end, int opt) {
+		Sci::PathfindingState *p = new Sci::PathfindingState(kWidth, kHeight);
+		int count = 0;
+
+		for (uint i = 0; i + 1 < polygons.size(); ) {
+			Sci::Polygon *polygon = new Sci::Polygon(polygons[i++]);
+			const int size = polygons[i++];
+
+			for (int j = 0; j < size && i + 1 < polygons.size(); j++, i += 2) {
+				polygon->vertices.insertHead(new Sci::Vertex(Common::Point(polygons[i], polygons[i + 1])));
+				count++;
+			}
+
+			Sci::fix_vertex_order(polygon);
+			p->polygons.push_back(polygon);
+		}
+
+		return Sci::prepare_polygon_set(cache, p, count, start, end, opt, false, false);
+	}
+
+	// Finds the path with both implementations. Returns false if the start or
+	// end point couldn't be fixed up.
+	static bool findPaths(Sci::PathfindingCache &cache, const Common::Array<int16> &polygons, Common::Point start, Common::Point end, int opt, Common::Array<Common::Point> &path, Common::Array<Common::Point> &reference) {
+		Sci::PathfindingState *p = preparePolygons(cache, polygons, start, end, opt);
+		if (!p)
+			return false;
+
+		findPath(p, true, reference);
+		findPath(p, false, path);
+		delete p;
+		return true;
+	}
+
+	// Returns whether both implementations found the same path
+	bool checkPath(Sci::PathfindingCache &cache, const Common::Array<int16> &polygons, Common::Point start, Common::Point end, int opt = 1) {
+		Common::Array<Common::Point> path, reference;
+		if (!findPaths(cache, polygons, start, end, opt, path, reference))
+			return true;
+
+		TS_ASSERT(!path.empty());
+		return path == reference;
+	}
+
+public:
+	void setUp() {
+		_seed = 1;
+	}
+
+	void test_obstacle() {
+		Sci::PathfindingCache cache;
+		Common::Array<int16> polygons;
+		addRect(polygons, 100, 50, 200, 150);
+
+		Common::Array<Common::Point> path, reference;
+		TS_ASSERT(findPaths(cache, polygons, Common::Point(50, 100), Common::Point(250, 100), 1, path, reference));
+		TS_ASSERT_EQUALS(path.size(), 4U);
+		TS_ASSERT(path == reference);
+		TS_ASSERT(path.front() == Common::Point(250, 100));
+		TS_ASSERT(path.back() == Common::Point(50, 100));
+	}
+
+	void test_cached_queries() {
+		Sci::PathfindingCache cache;
+		Common::Array<int16> polygons;
+		addRect(polygons, 40, 40, 90, 120);
+		addRect(polygons, 130, 20, 170, 100);
+		addRect(polygons, 200, 60, 260, 170);
+		const int16 triangle[] = { 100, 130, 180, 180, 60, 170 };
+		addPolygon(polygons, kBarredAccess, triangle, 3);
+
+		// The same polygons with different start and end points, including
+		// points on the edges, which split them when merged
+		const Common::Point points[] = {
+			Common::Point(10, 10), Common::Point(300, 180), Common::Point(90, 80),
+			Common::Point(150, 100), Common::Point(110, 10), Common::Point(280, 20),
+			Common::Point(230, 60), Common::Point(20, 160), Common::Point(120, 120)
+		};
+		const int count = ARRAYSIZE(points);
+
+		for (int i = 0; i < count; i++) {
+			for (int j = 0; j < count; j++) {
+				if (i != j)
+					TS_ASSERT(checkPath(cache, polygons, points[i], points[j]));
+			}
+		}
+
+		TS_ASSERT_EQUALS(cache.entries.size(), 1U);
+		TS_ASSERT_EQUALS(cache.hits, cache.queries - 1);
+	}
+
+	void test_lazy_graph() {
+		Sci::PathfindingCache cache;
+		Common::Array<int16> polygons;
+		addRect(polygons, 40, 40, 90, 120);
+		addRect(polygons, 130, 20, 170, 100);
+		addRect(polygons, 200, 60, 260, 170);
+
+		// Points away from the edges, so that no edge is split
+		TS_ASSERT(checkPath(cache, polygons, Common::Point(10, 10), Common::Point(300, 180)));
+		TS_ASSERT(checkPath(cache, polygons, Common::Point(100, 150), Common::Point(180, 30)));
+		TS_ASSERT_EQUALS(cache.entries.size(), 1U);
+
+		// Only the pairs the searches got to are checked, and they match the
+		// visibility of the polygons
+		Sci::PathfindingCache fresh;
+		Sci::PathfindingState *p = preparePolygons(fresh, polygons, Common::Point(10, 10), Common::Point(300, 180), 1);
+		TS_ASSERT(p);
+		const Common::Array<byte> &visibility = cache.entries[0].visibility;
+		const int n = p->baseVertices;
+		TS_ASSERT_EQUALS(visibility.size(), (uint)(n * n));
+
+		int unknown = 0;
+		for (int i = 0; i < p->vertices; i++) {
+			Sci::Vertex *vertex = p->vertex_index[i];
+			if (vertex->baseIndex < 0)
+				continue;
+
+			Sci::VertexList *visVerts = Sci::visible_vertices(p, vertex);
+			for (int j = 0; j < p->vertices; j++) {
+				Sci::Vertex *other = p->vertex_index[j];
+				if (other->baseIndex < 0 || other == vertex)
+					continue;
+
+				const byte visible = visibility[vertex->baseIndex * n + other->baseIndex];
+				if (visible == VISIBILITY_UNKNOWN)
+					unknown++;
+				else
+					TS_ASSERT_EQUALS(visible, visVerts->contains(other) ? 1 : 0);
+			}
+			delete visVerts;
+		}
+		delete p;
+
+		TS_ASSERT(unknown > 0);
+		TS_ASSERT(unknown < n * (n - 1));
+	}
+
+	void test_random_rooms() {
+		Sci::PathfindingCache cache;
+
+		for (int room = 0; room < 20; room++) {
+			Common::Array<int16> polygons;
+
+			// Walkable area, with obstacles on a grid so that they don't overlap
+			const int16 border[] = { 5, 5, 315, 5, 315, 185, 5, 185 };
+			addPolygon(polygons, kContainedAccess, border, 4);
+
+			for (int x = 0; x < 5; x++) {
+				for (int y = 0; y < 3; y++) {
+					if (nextRandom(3) == 0)
+						continue;
+					const int16 left = 20 + x * 60 + nextRandom(15);
+					const int16 top = 15 + y * 55 + nextRandom(15);
+					addRect(polygons, left, top, left + 10 + nextRandom(30), top + 10 + nextRandom(25));
+				}
+			}
+
+			for (int query = 0; query < 10; query++) {
+				const Common::Point start(10 + nextRandom(300), 10 + nextRandom(170));
+				const Common::Point end(10 + nextRandom(300), 10 + nextRandom(170));
+				TS_ASSERT(checkPath(cache, polygons, start, end));
+				TS_ASSERT(checkPath(cache, polygons, start, end, 0));
+			}
+		}
+
+		TS_ASSERT(cache.hits > 0);
+	}
+
+	void test_aligned_rooms() {
+		Sci::PathfindingCache cache;
+
+		for (int room = 0; room < 50; room++) {
+			Common::Array<int16> polygons;
+
+			// Obstacles with aligned edges, so that lines between vertices
+			// run along edges and through the points which split them
+			for (int x = 0; x < 4; x++) {
+				for (int y = 0; y < 3; y++) {
+					if (nextRandom(3) == 0)
+						continue;
+					const int16 left = 20 + x * 80 + nextRandom(2) * 20;
+					const int16 top = 20 + y * 60;
+					addRect(polygons, left, top, left + 20 + nextRandom(2) * 20, top + 20 + nextRandom(2) * 20);
+				}
+			}
+
+			for (int query = 0; query < 20; query++) {
+				const Common::Point start(10 + nextRandom(30) * 10, 10 + nextRandom(17) * 10);
+				const Common::Point end(10 + nextRandom(30) * 10, 10 + nextRandom(17) * 10);
+				TS_ASSERT(checkPath(cache, polygons, start, end));
+			}
+		}
+	}
+};
@@ -0,0 +1,183 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/fs.h"
+#include "common/ptr.h"
+#include "common/ustr.h"
+
+#include "graphics/font.h"
+#include "graphics/fonts/ttf.h"
+#include "graphics/managed_surface.h"
+
+#include "../system/null_osystem.h"
+
+/**
+ * Checks that the glyph atlas and the text run caches of TTF fonts give
+ * the same results as doing all the work again with a fresh font.
+ */
+class TTFFontTestSuite : public CxxTest::TestSuite {
+	static Graphics::Font *loadFont(const char *name, int size) {
+		Common::FSNode node(Common::Path("dists/engine-data/fonts/fonts").appendComponent(name));
+		if (!node.exists())
+			return nullptr;
+
+		return Graphics::loadTTFFont(node.createReadStream(), DisposeAfterUse::YES, size);
+	}
+
+	// Draws the characters one by one, the way drawString does without a run
+	static void drawChars(const Graphics::Font &font, Graphics::ManagedSurface &dst, const Common::U32String &str, int x, int y, uint32 color) {
+		uint32 last = 0;
+		for (uint i = 0; i < str.size(); ++i) {
+			x += font.getKerningOffset(last, str[i]);
+			last = str[i];
+			font.drawChar(&dst, str[i], x, y, color);
+			x += font.getCharWidth(str[i]);
+		}
+	}
+
+	static bool sameSurfaces(const Graphics::ManagedSurface &a, const Graphics::ManagedSurface &b) {
+		for (int y = 0; y < a.h; ++y) {
+			if (memcmp(a.getBasePtr(0, y), b.getBasePtr(0, y), a.w * a.format.bytesPerPixel))
+				return false;
+		}
+		return true;
+	}
+
+public:
+	void setUp() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_atlas() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		// Enough large glyphs to fill several atlas pages, packed in a
+		// different order by each font
+		Common::ScopedPtr<Graphics::Font> forward(loadFont("LiberationSans-Regular.ttf", 60));
+		Common::ScopedPtr<Graphics::Font> backward(loadFont("LiberationSans-Regular.ttf", 60));
+		if (!forward || !backward)
+			return;
+
+		const uint32 first = 0x21, last = 0x24F;
+		const int size = forward->getFontHeight() * 2;
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		Common::Array<Graphics::ManagedSurface *> glyphs;
+
+		for (uint32 chr = first; chr <= last; ++chr) {
+			Graphics::ManagedSurface *surface = new Graphics::ManagedSurface(size, size, format);
+			surface->clear(0x204080FF);
+			forward->drawChar(surface, chr, size / 4, size / 4, 0xF0E0D0FF);
+			glyphs.push_back(surface);
+		}
+
+		Graphics::ManagedSurface surface(size, size, format);
+		for (uint32 chr = last; chr >= first; --chr) {
+			surface.clear(0x204080FF);
+			backward->drawChar(&surface, chr, size / 4, size / 4, 0xF0E0D0FF);
+			TS_ASSERT(sameSurfaces(surface, *glyphs[chr - first]));
+		}
+
+		for (uint i = 0; i < glyphs.size(); ++i)
+			delete glyphs[i];
+#endif
+	}
+
+	void test_run_cache() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		static const char *const fonts[] = { "LiberationSans-Regular.ttf", "LiberationSerif-Italic.ttf" };
+		// Kerning and italics make some of these glyphs overlap
+		static const char *const texts[] = { "Hello, World!", "AAX A/ *w", "(V (Y #v #w", "fjord", "." };
+		const Graphics::PixelFormat formats[] = {
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0),
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0)
+		};
+
+		for (int f = 0; f < ARRAYSIZE(fonts); ++f) {
+			Common::ScopedPtr<Graphics::Font> font(loadFont(fonts[f], 32));
+			if (!font)
+				return;
+
+			for (int p = 0; p < ARRAYSIZE(formats); ++p) {
+				const uint32 background = formats[p].RGBToColor(32, 64, 128);
+				const uint32 color = formats[p].RGBToColor(240, 224, 208);
+
+				for (int transparent = 0; transparent < 2; ++transparent) {
+					for (int s = 0; s < ARRAYSIZE(texts); ++s) {
+						const Common::U32String str(texts[s]);
+						const int w = font->getStringWidth(str) + 40, h = font->getFontHeight() * 2;
+
+						Graphics::ManagedSurface expected(w, h, formats[p]);
+						if (transparent)
+							expected.setTransparentColor(background);
+						expected.clear(background);
+						drawChars(*font, expected, str, 10, 10, color);
+
+						// The first call fills the cache, the second one uses it
+						for (int pass = 0; pass < 2; ++pass) {
+							Graphics::ManagedSurface actual(w, h, formats[p]);
+							if (transparent)
+								actual.setTransparentColor(background);
+							actual.clear(background);
+							font->drawString(&actual, str, 10, 10, w, color);
+							TS_ASSERT(sameSurfaces(expected, actual));
+						}
+					}
+				}
+			}
+		}
+#endif
+	}
+
+	void test_wrap_cache() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::ScopedPtr<Graphics::Font> cached(loadFont("LiberationSans-Regular.ttf", 16));
+		if (!cached)
+			return;
+
+		const Common::U32String text("The quick brown fox jumps over the lazy dog.\nPack my box with five dozen liquor jugs, then wrap it all up again.");
+		static const int widths[] = { 80, 200, 80, 120, 200 };
+		static const uint32 modes[] = { Graphics::kWordWrapOnExplicitNewLines, Graphics::kWordWrapDefault, Graphics::kWordWrapEvenWidthLines };
+
+		for (int m = 0; m < ARRAYSIZE(modes); ++m) {
+			for (int i = 0; i < ARRAYSIZE(widths); ++i) {
+				Common::ScopedPtr<Graphics::Font> fresh(loadFont("LiberationSans-Regular.ttf", 16));
+
+				Common::Array<Common::U32String> cachedLines, freshLines;
+				const int cachedWidth = cached->wordWrapText(text, widths[i], cachedLines, i, modes[m]);
+				const int freshWidth = fresh->wordWrapText(text, widths[i], freshLines, i, modes[m]);
+				TS_ASSERT_EQUALS(cachedWidth, freshWidth);
+				TS_ASSERT(cachedLines == freshLines);
+
+				TS_ASSERT_EQUALS(cached->getStringWidth(text), fresh->getStringWidth(text));
+			}
+		}
+#endif
+	}
+};
@@ -0,0 +1,205 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "graphics/managed_surface.h"
+#include "graphics/VectorRendererSpec.h"
+
+#include "../system/null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define BENCHMARK_TIME 1
+#else
+#define BENCHMARK_TIME 0
+#endif
+
+class VectorRendererSpansTestSuite : public CxxTest::TestSuite {
+	uint32 _seed;
+
+	uint32 nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) | (_seed << 16);
+	}
+
+	void fillRandom(uint32 *buf, int count) {
+		for (int i = 0; i < count; i++)
+			buf[i] = nextRandom();
+	}
+
+	void fillRandom(uint16 *buf, int count) {
+		for (int i = 0; i < count; i++)
+			buf[i] = (uint16)nextRandom();
+	}
+
+	// Draws a few widgets the way the default theme does
+	template<typename PixelType>
+	double drawTheme(Graphics::ManagedSurface &surface, bool generic) {
+		Graphics::VectorRendererSpec<PixelType> renderer(surface.format);
+		renderer.setSurface(&surface);
+
+		Graphics::VectorRendererSpans::blend32 = Graphics::VectorRendererSpans::blend32Generic;
+		Graphics::VectorRendererSpans::shade16 = Graphics::VectorRendererSpans::shade16Generic;
+		Graphics::VectorRendererSpans::shade32 = Graphics::VectorRendererSpans::shade32Generic;
+#ifdef SCUMMVM_SSE2
+		if (!generic && instrset_detect() >= 2) {
+			Graphics::VectorRendererSpans::blend32 = Graphics::VectorRendererSpans::blend32SSE2;
+			Graphics::VectorRendererSpans::shade16 = Graphics::VectorRendererSpans::shade16SSE2;
+			Graphics::VectorRendererSpans::shade32 = Graphics::VectorRendererSpans::shade32SSE2;
+		}
+#endif
+
+		uint32 start = g_system->getMillis();
+
+		renderer.setGradientColors(206, 121, 99, 173, 40, 8);
+		renderer.setFillMode(Graphics::VectorRenderer::kFillGradient);
+		renderer.fillSurface();
+
+		renderer.setFgColor(251, 241, 206);
+		renderer.setBgColor(255, 255, 255);
+		renderer.setBevelColor(120, 120, 120);
+		renderer.setStrokeWidth(1);
+		renderer.setShadowOffset(4);
+		renderer.setShadowIntensity(1 << 16);
+
+		const int widgetW = surface.w / 5, widgetH = surface.h / 12;
+		for (int y = 0; y + widgetH + 8 < surface.h; y += widgetH + 8) {
+			for (int x = 0; x + widgetW + 8 < surface.w; x += widgetW + 8) {
+				renderer.setFillMode(Graphics::VectorRenderer::kFillGradient);
+				renderer.drawRoundedSquare(x, y, 6, widgetW, widgetH);
+				renderer.setFillMode(Graphics::VectorRenderer::kFillForeground);
+				renderer.drawSquare(x + 4, y + 4, widgetW / 2, widgetH / 2);
+				renderer.drawBeveledSquare(x + widgetW / 2, y + 4, widgetW / 3, widgetH / 2);
+			}
+		}
+
+		renderer.applyScreenShading(GUI::ThemeEngine::kShadingDim);
+
+		return g_system->getMillis() - start;
+	}
+
+public:
+	void setUp() {
+#if BENCHMARK_TIME
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+#if BENCHMARK_TIME
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	VectorRendererSpansTestSuite() : _seed(1) {}
+
+	void test_blend32_generic() {
+		uint32 buf[33], ref[33];
+		fillRandom(buf, ARRAYSIZE(buf));
+
+		const uint32 color = 0x80C040FF;
+		for (int alpha = 0; alpha < 255; alpha += 17) {
+			for (int i = 0; i < ARRAYSIZE(buf); i++) {
+				// Same computation as VectorRendererSpec::blendPixelPtr
+				ref[i] = 0;
+				for (int shift = 0; shift < 32; shift += 8) {
+					byte d = (buf[i] >> shift) & 0xFF;
+					byte s = (color >> shift) & 0xFF;
+					d += ((s - d) * alpha) >> 8;
+					ref[i] |= (uint32)d << shift;
+				}
+			}
+
+			Graphics::VectorRendererSpans::blend32Generic(buf, buf + ARRAYSIZE(buf), color, alpha, 0xFFFFFFFF);
+			for (int i = 0; i < ARRAYSIZE(buf); i++)
+				TS_ASSERT_EQUALS(buf[i], ref[i]);
+		}
+	}
+
+	void test_spans_simd() {
+#ifdef SCUMMVM_SSE2
+		if (instrset_detect() < 2)
+			return;
+
+		for (int count = 0; count < 40; count++) {
+			uint32 a32[40], b32[40];
+			uint16 a16[40], b16[40];
+
+			fillRandom(a32, count);
+			memcpy(b32, a32, sizeof(a32));
+			Graphics::VectorRendererSpans::blend32Generic(a32, a32 + count, 0x12F0A0FF, count * 6, 0xFFFFFF00);
+			Graphics::VectorRendererSpans::blend32SSE2(b32, b32 + count, 0x12F0A0FF, count * 6, 0xFFFFFF00);
+			TS_ASSERT_SAME_DATA(a32, b32, count * sizeof(uint32));
+
+			fillRandom(a32, count);
+			memcpy(b32, a32, sizeof(a32));
+			Graphics::VectorRendererSpans::shade32Generic(a32, a32 + count, 0xFCFCFC00, 2, 0, 0xC0);
+			Graphics::VectorRendererSpans::shade32SSE2(b32, b32 + count, 0xFCFCFC00, 2, 0, 0xC0);
+			TS_ASSERT_SAME_DATA(a32, b32, count * sizeof(uint32));
+
+			fillRandom(a16, count);
+			memcpy(b16, a16, sizeof(a16));
+			Graphics::VectorRendererSpans::shade16Generic(a16, a16 + count, 0xF7DE, 1, 0x8000, 0);
+			Graphics::VectorRendererSpans::shade16SSE2(b16, b16 + count, 0xF7DE, 1, 0x8000, 0);
+			TS_ASSERT_SAME_DATA(a16, b16, count * sizeof(uint16));
+		}
+#endif
+	}
+
+	void test_render_speed() {
+#if BENCHMARK_TIME
+		static const int sizes[][2] = { { 320, 200 }, { 640, 480 }, { 1280, 960 }, { 1920, 1080 } };
+		const Graphics::PixelFormat formats[] = {
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0)
+		};
+
+		for (int f = 0; f < ARRAYSIZE(formats); f++) {
+			for (int s = 0; s < ARRAYSIZE(sizes); s++) {
+				Graphics::ManagedSurface generic(sizes[s][0], sizes[s][1], formats[f]);
+				Graphics::ManagedSurface selected(sizes[s][0], sizes[s][1], formats[f]);
+				double genericTime, selectedTime;
+
+				if (formats[f].bytesPerPixel == 2) {
+					genericTime = drawTheme<uint16>(generic, true);
+					selectedTime = drawTheme<uint16>(selected, false);
+				} else {
+					genericTime = drawTheme<uint32>(generic, true);
+					selectedTime = drawTheme<uint32>(selected, false);
+				}
+
+				TS_ASSERT_SAME_DATA(generic.getPixels(), selected.getPixels(), generic.pitch * generic.h);
+
+				debug("VectorRendererSpec %dx%d %dbpp: generic %f ms, selected %f ms\n",
+				      sizes[s][0], sizes[s][1], formats[f].bytesPerPixel * 8, genericTime, selectedTime);
+			}
+		}
+#endif
+	}
+};
@@ -0,0 +1,166 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/config-manager.h"
+
+#include "gui/ThemeCache.h"
+
+class ThemeCacheTestSuite : public CxxTest::TestSuite {
+	// Logs the calls of a replayed theme
+	class LogTarget : public GUI::ThemeCache::Target {
+	public:
+		Common::String log;
+
+		bool storeFontNames(GUI::TextData, const Common::String &, const Common::String &, const Common::String &, int) override { return false; }
+		bool addFont(GUI::TextData, const Common::String &, const Common::String &, const Common::String &, int) override { return false; }
+		bool addTextColor(GUI::TextColor, int, int, int) override { return false; }
+		bool createCursor(const Common::String &, int, int, GUI::ThemeEngine::CursorType) override { return false; }
+		bool addBitmap(const Common::String &, const Common::String &, int, int) override { return false; }
+		bool addTextData(const Common::String &, GUI::TextData, GUI::TextColor, Graphics::TextAlign, GUI::ThemeEngine::TextAlignVertical) override { return false; }
+		bool addDrawData(const Common::String &, bool) override { return false; }
+		bool addDrawStep(const Common::String &, const Common::String &, const Common::String &, Graphics::DrawStep &) override { return false; }
+
+		bool setVar(const Common::String &name, int val) override {
+			log += Common::String::format("var %s=%d;", name.c_str(), val);
+			return true;
+		}
+		bool addDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset) override {
+			log += Common::String::format("dialog %s %s %d %d %d;", name.c_str(), overlays.c_str(), maxWidth, maxHeight, inset);
+			return true;
+		}
+		bool addLayout(GUI::ThemeLayout::LayoutType, int, GUI::ThemeLayout::ItemAlign) override { return false; }
+		bool addWidget(const Common::String &, const Common::String &, int, int, Graphics::TextAlign, bool) override { return false; }
+		bool addImportedLayout(const Common::String &) override { return false; }
+		bool addSpace(int) override { return false; }
+		bool addPadding(int16, int16, int16, int16) override { return false; }
+		bool closeLayout() override { return false; }
+		bool closeDialog() override {
+			log += "close;";
+			return true;
+		}
+	};
+
+	// Records a small compiled theme under the given key
+	static void compile(GUI::ThemeCache &cache, const Common::String &key, int value) {
+		cache.beginRecording();
+		cache.recordSetVar("Globals.Line.Height", value);
+		cache.recordAddDialog("GlobalOptions", "screen", -1, -1, 16);
+		cache.recordCloseDialog();
+		cache.commitRecording(key);
+	}
+
+	static Common::String key(int index) {
+		return GUI::ThemeCache::makeKey("scummremastered", "digest", 320 + index, 200, 1.0f);
+	}
+
+public:
+	void setUp() {
+		// Only test the compiled themes held in memory
+		ConfMan.set("themecachepath", "");
+	}
+
+	void tearDown() {
+		ConfMan.removeKey("themecachepath", Common::ConfigManager::kApplicationDomain);
+	}
+
+	void test_hit() {
+		GUI::ThemeCache cache;
+		const Common::String key1 = key(0);
+		TS_ASSERT(!cache.lookup(key1));
+
+		compile(cache, key1, 16);
+		const Common::Array<byte> *data = cache.lookup(key1);
+		TS_ASSERT(data);
+		TS_ASSERT(data && !data->empty() && data->back() == 0);
+		TS_ASSERT_EQUALS(cache.size(), 1u);
+
+		// A failed parse leaves nothing behind
+		cache.beginRecording();
+		cache.recordSetVar("Globals.Line.Height", 1);
+		cache.abortRecording();
+		TS_ASSERT(!cache.isRecording());
+		TS_ASSERT(!cache.lookup(key(1)));
+
+		// Nothing is recorded outside of a parser run
+		cache.recordSetVar("Globals.Line.Height", 1);
+		TS_ASSERT(cache.lookup(key1) == data);
+		TS_ASSERT_EQUALS(cache.size(), 1u);
+	}
+
+	void test_invalidation() {
+		GUI::ThemeCache cache;
+		compile(cache, GUI::ThemeCache::makeKey("scummremastered", "digest", 320, 200, 1.0f), 16);
+
+		// Another theme, changed STX data, resolution or scale all miss
+		TS_ASSERT(cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "digest", 320, 200, 1.0f)));
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummmodern", "digest", 320, 200, 1.0f)));
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "changed", 320, 200, 1.0f)));
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "digest", 640, 200, 1.0f)));
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "digest", 320, 400, 1.0f)));
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "digest", 320, 200, 1.5f)));
+
+		cache.clear();
+		TS_ASSERT_EQUALS(cache.size(), 0u);
+		TS_ASSERT(!cache.lookup(GUI::ThemeCache::makeKey("scummremastered", "digest", 320, 200, 1.0f)));
+	}
+
+	void test_eviction() {
+		GUI::ThemeCache cache;
+		const int count = GUI::ThemeCache::kMaxEntries;
+		for (int i = 0; i < count; i++)
+			compile(cache, key(i), i);
+		TS_ASSERT_EQUALS(cache.size(), GUI::ThemeCache::kMaxEntries);
+
+		// Using the oldest theme keeps it, the next oldest one goes instead
+		TS_ASSERT(cache.lookup(key(0)));
+		compile(cache, key(count), count);
+		TS_ASSERT_EQUALS(cache.size(), GUI::ThemeCache::kMaxEntries);
+		TS_ASSERT(cache.lookup(key(0)));
+		TS_ASSERT(!cache.lookup(key(1)));
+		for (int i = 2; i <= count; i++)
+			TS_ASSERT(cache.lookup(key(i)));
+
+		// Recompiling a theme in memory does not evict another one
+		compile(cache, key(count), count);
+		TS_ASSERT_EQUALS(cache.size(), GUI::ThemeCache::kMaxEntries);
+		TS_ASSERT(cache.lookup(key(0)));
+	}
+
+	void test_replay() {
+		GUI::ThemeCache cache;
+		compile(cache, key(0), 16);
+
+		LogTarget target;
+		TS_ASSERT(cache.replay(key(0), target));
+		TS_ASSERT_EQUALS(target.log, "var Globals.Line.Height=16;dialog GlobalOptions screen -1 -1 16;close;");
+
+		// A target refusing a call aborts the replay and drops the compiled theme
+		cache.beginRecording();
+		cache.recordAddSpace(4);
+		cache.commitRecording(key(1));
+		TS_ASSERT(!cache.replay(key(1), target));
+		TS_ASSERT(!cache.lookup(key(1)));
+
+		TS_ASSERT(!cache.replay(key(2), target));
+	}
+};
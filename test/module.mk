@@ -10,11 +10,16 @@ TESTS        := $(srcdir)/test/common/*.h \
 	$(srcdir)/test/common/formats/*.h \
 	$(srcdir)/test/audio/*.h \
 	$(srcdir)/test/math/*.h \
-	$(srcdir)/test/image/*.h
+	$(srcdir)/test/image/*.h \
+	$(srcdir)/test/gui/*.h \
+	$(srcdir)/test/graphics/vectorrenderer.h
 TEST_LIBS    :=
 
 ifdef POSIX
+TESTS += $(srcdir)/test/backends/saves/*.h
 TEST_LIBS += test/system/null_osystem.o \
+	backends/saves/savefile.o \
+	backends/saves/default/default-saves.o \
 	backends/fs/posix/posix-fs-factory.o \
 	backends/fs/posix/posix-fs.o \
 	backends/fs/posix/posix-iostream.o \
@@ -24,7 +29,10 @@ TEST_LIBS += test/system/null_osystem.o \
 endif
 
 ifdef WIN32
+TESTS += $(srcdir)/test/backends/saves/*.h
 TEST_LIBS += test/system/null_osystem.o \
+	backends/saves/savefile.o \
+	backends/saves/default/default-saves.o \
 	backends/fs/windows/windows-fs-factory.o \
 	backends/fs/windows/windows-fs.o \
 	backends/fs/abstract-fs.o \
@@ -33,12 +41,25 @@ TEST_LIBS += test/system/null_osystem.o \
 	backends/platform/sdl/win32/win32_wrapper.o
 endif
 
+ifdef USE_CLOUD
+# The save manager syncs the saves through the cloud manager
+TEST_LIBS += backends/libbackends.a
+endif
+
 ifdef USE_TINYGL
 TESTS += $(srcdir)/test/graphics/tinygl*.h
 endif
 
+ifdef USE_FREETYPE2
+TESTS += $(srcdir)/test/graphics/ttf.h
+endif
+
+# The compiled theme store, which replays themes through an interface
+TEST_LIBS += gui/ThemeCache.o base/version.o
+
 # libcommon needs libformats and libformats needs libcommon: so libcommon is put twice
-TEST_LIBS +=	audio/libaudio.a math/libmath.a common/libcommon.a common/formats/libformats.a common/compression/libcompression.a common/libcommon.a image/libimage.a graphics/libgraphics.a
+# libgraphics needs libcommon as well, so it is put once more after it
+TEST_LIBS +=	audio/libaudio.a math/libmath.a common/libcommon.a common/formats/libformats.a common/compression/libcompression.a common/libcommon.a image/libimage.a graphics/libgraphics.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -52,6 +73,11 @@ endif
 	TEST_LIBS += engines/ultima/libultima.a
 endif
 
+ifeq ($(ENABLE_SCI), STATIC_PLUGIN)
+	TESTS += $(srcdir)/test/engines/sci/*.h
+	TEST_LIBS += engines/sci/engine/kpathing_search.o
+endif
+
 ifeq ($(ENABLE_TWINE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/twine/*.h
 	TEST_LIBS += engines/twine/libtwine.a
@@ -94,6 +120,7 @@ test/runner.cpp: $(TESTS) $(srcdir)/test/module.mk
 clean: clean-test
 clean-test:
 	-$(RM) test/runner.cpp test/runner test/engine-data/encoding.dat test/system/null_osystem.o
+	-$(RM_REC) test/savegames
 	-rmdir test/engine-data
 
 test/engine-data/encoding.dat: $(srcdir)/dists/engine-data/encoding.dat
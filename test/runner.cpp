@@ -0,0 +1,3202 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/StdioPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::StdioPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::StdioPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_AlgorithmTestSuite_init = false;
+#include "common/algorithm.h"
+
+static AlgorithmTestSuite suite_AlgorithmTestSuite;
+
+static CxxTest::List Tests_AlgorithmTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AlgorithmTestSuite( "test/common/algorithm.h", 10, "AlgorithmTestSuite", suite_AlgorithmTestSuite, Tests_AlgorithmTestSuite );
+
+static class TestDescription_suite_AlgorithmTestSuite_test_check_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_check_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 67, "test_check_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_check_sort(); }
+} testDescription_suite_AlgorithmTestSuite_test_check_sort;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_pod_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_pod_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 78, "test_pod_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_pod_sort(); }
+} testDescription_suite_AlgorithmTestSuite_test_pod_sort;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_container_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_container_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 116, "test_container_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_sort(); }
+} testDescription_suite_AlgorithmTestSuite_test_container_sort;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_string_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_string_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 131, "test_string_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_string_replace(); }
+} testDescription_suite_AlgorithmTestSuite_test_string_replace;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_container_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_container_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 141, "test_container_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_replace(); }
+} testDescription_suite_AlgorithmTestSuite_test_container_replace;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_container_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_container_remove() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 159, "test_container_remove" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_remove(); }
+} testDescription_suite_AlgorithmTestSuite_test_container_remove;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_lower_bound_equal_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_lower_bound_equal_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 186, "test_lower_bound_equal_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_equal_found(); }
+} testDescription_suite_AlgorithmTestSuite_test_lower_bound_equal_found;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_lower_bound_greater_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_lower_bound_greater_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 200, "test_lower_bound_greater_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_greater_found(); }
+} testDescription_suite_AlgorithmTestSuite_test_lower_bound_greater_found;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_lower_bound_element_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_lower_bound_element_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 214, "test_lower_bound_element_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_element_nothing_found(); }
+} testDescription_suite_AlgorithmTestSuite_test_lower_bound_element_nothing_found;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_lower_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_lower_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 221, "test_lower_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_empty_input(); }
+} testDescription_suite_AlgorithmTestSuite_test_lower_bound_empty_input;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_upper_bound_element_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_upper_bound_element_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 234, "test_upper_bound_element_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_element_found(); }
+} testDescription_suite_AlgorithmTestSuite_test_upper_bound_element_found;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_upper_bound_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_upper_bound_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 248, "test_upper_bound_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_nothing_found(); }
+} testDescription_suite_AlgorithmTestSuite_test_upper_bound_nothing_found;
+
+static class TestDescription_suite_AlgorithmTestSuite_test_upper_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AlgorithmTestSuite_test_upper_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 261, "test_upper_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_empty_input(); }
+} testDescription_suite_AlgorithmTestSuite_test_upper_bound_empty_input;
+
+#include "common/array.h"
+
+static ArrayTestSuite suite_ArrayTestSuite;
+
+static CxxTest::List Tests_ArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ArrayTestSuite( "test/common/array.h", 41, "ArrayTestSuite", suite_ArrayTestSuite, Tests_ArrayTestSuite );
+
+static class TestDescription_suite_ArrayTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 44, "test_empty_clear" ) {}
+ void runTest() { suite_ArrayTestSuite.test_empty_clear(); }
+} testDescription_suite_ArrayTestSuite_test_empty_clear;
+
+static class TestDescription_suite_ArrayTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 54, "test_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_iterator(); }
+} testDescription_suite_ArrayTestSuite_test_iterator;
+
+static class TestDescription_suite_ArrayTestSuite_test_erase_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_erase_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 82, "test_erase_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator(); }
+} testDescription_suite_ArrayTestSuite_test_erase_iterator;
+
+static class TestDescription_suite_ArrayTestSuite_test_erase_iterator_range : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_erase_iterator_range() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 102, "test_erase_iterator_range" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator_range(); }
+} testDescription_suite_ArrayTestSuite_test_erase_iterator_range;
+
+static class TestDescription_suite_ArrayTestSuite_test_insert_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_insert_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 127, "test_insert_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_iterator(); }
+} testDescription_suite_ArrayTestSuite_test_insert_iterator;
+
+static class TestDescription_suite_ArrayTestSuite_test_direct_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_direct_access() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 149, "test_direct_access" ) {}
+ void runTest() { suite_ArrayTestSuite.test_direct_access(); }
+} testDescription_suite_ArrayTestSuite_test_direct_access;
+
+static class TestDescription_suite_ArrayTestSuite_test_insert_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_insert_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 162, "test_insert_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at(); }
+} testDescription_suite_ArrayTestSuite_test_insert_at;
+
+static class TestDescription_suite_ArrayTestSuite_test_insert_at_array : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_insert_at_array() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 183, "test_insert_at_array" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at_array(); }
+} testDescription_suite_ArrayTestSuite_test_insert_at_array;
+
+static class TestDescription_suite_ArrayTestSuite_test_self_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_self_insert() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 212, "test_self_insert" ) {}
+ void runTest() { suite_ArrayTestSuite.test_self_insert(); }
+} testDescription_suite_ArrayTestSuite_test_self_insert;
+
+static class TestDescription_suite_ArrayTestSuite_test_remove_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_remove_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 241, "test_remove_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_remove_at(); }
+} testDescription_suite_ArrayTestSuite_test_remove_at;
+
+static class TestDescription_suite_ArrayTestSuite_test_push_back : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_push_back() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 262, "test_push_back" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back(); }
+} testDescription_suite_ArrayTestSuite_test_push_back;
+
+static class TestDescription_suite_ArrayTestSuite_test_push_back_ex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_push_back_ex() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 297, "test_push_back_ex" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back_ex(); }
+} testDescription_suite_ArrayTestSuite_test_push_back_ex;
+
+static class TestDescription_suite_ArrayTestSuite_test_copy_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_copy_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 310, "test_copy_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_copy_constructor(); }
+} testDescription_suite_ArrayTestSuite_test_copy_constructor;
+
+static class TestDescription_suite_ArrayTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 332, "test_equals" ) {}
+ void runTest() { suite_ArrayTestSuite.test_equals(); }
+} testDescription_suite_ArrayTestSuite_test_equals;
+
+static class TestDescription_suite_ArrayTestSuite_test_array_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_array_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 349, "test_array_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor(); }
+} testDescription_suite_ArrayTestSuite_test_array_constructor;
+
+static class TestDescription_suite_ArrayTestSuite_test_array_constructor_count : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_array_constructor_count() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 373, "test_array_constructor_count" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count(); }
+} testDescription_suite_ArrayTestSuite_test_array_constructor_count;
+
+static class TestDescription_suite_ArrayTestSuite_test_array_constructor_list : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_array_constructor_list() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 384, "test_array_constructor_list" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_list(); }
+} testDescription_suite_ArrayTestSuite_test_array_constructor_list;
+
+static class TestDescription_suite_ArrayTestSuite_test_array_constructor_count_copy_value : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_array_constructor_count_copy_value() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 392, "test_array_constructor_count_copy_value" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count_copy_value(); }
+} testDescription_suite_ArrayTestSuite_test_array_constructor_count_copy_value;
+
+static class TestDescription_suite_ArrayTestSuite_test_array_constructor_str : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_array_constructor_str() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 416, "test_array_constructor_str" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_str(); }
+} testDescription_suite_ArrayTestSuite_test_array_constructor_str;
+
+static class TestDescription_suite_ArrayTestSuite_test_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_data() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 428, "test_data" ) {}
+ void runTest() { suite_ArrayTestSuite.test_data(); }
+} testDescription_suite_ArrayTestSuite_test_data;
+
+static class TestDescription_suite_ArrayTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 437, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ArrayTestSuite.test_front_back_push_pop(); }
+} testDescription_suite_ArrayTestSuite_test_front_back_push_pop;
+
+static class TestDescription_suite_ArrayTestSuite_test_resize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_resize() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 456, "test_resize" ) {}
+ void runTest() { suite_ArrayTestSuite.test_resize(); }
+} testDescription_suite_ArrayTestSuite_test_resize;
+
+static class TestDescription_suite_ArrayTestSuite_test_swap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ArrayTestSuite_test_swap() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 492, "test_swap" ) {}
+ void runTest() { suite_ArrayTestSuite.test_swap(); }
+} testDescription_suite_ArrayTestSuite_test_swap;
+
+static SortedArrayTestSuite suite_SortedArrayTestSuite;
+
+static CxxTest::List Tests_SortedArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SortedArrayTestSuite( "test/common/array.h", 533, "SortedArrayTestSuite", suite_SortedArrayTestSuite, Tests_SortedArrayTestSuite );
+
+static class TestDescription_suite_SortedArrayTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SortedArrayTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 535, "test_insert" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_insert(); }
+} testDescription_suite_SortedArrayTestSuite_test_insert;
+
+static class TestDescription_suite_SortedArrayTestSuite_test_stability : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SortedArrayTestSuite_test_stability() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 566, "test_stability" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_stability(); }
+} testDescription_suite_SortedArrayTestSuite_test_stability;
+
+static class TestDescription_suite_SortedArrayTestSuite_test_emplace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SortedArrayTestSuite_test_emplace() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 597, "test_emplace" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_emplace(); }
+} testDescription_suite_SortedArrayTestSuite_test_emplace;
+
+static class TestDescription_suite_SortedArrayTestSuite_test_push_back_move : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SortedArrayTestSuite_test_push_back_move() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 607, "test_push_back_move" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_push_back_move(); }
+} testDescription_suite_SortedArrayTestSuite_test_push_back_move;
+
+#include "common/base64.h"
+
+static Base64TestSuite suite_Base64TestSuite;
+
+static CxxTest::List Tests_Base64TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Base64TestSuite( "test/common/base64.h", 45, "Base64TestSuite", suite_Base64TestSuite, Tests_Base64TestSuite );
+
+static class TestDescription_suite_Base64TestSuite_test_b64Validate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64Validate() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 47, "test_b64Validate" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64Validate(); }
+} testDescription_suite_Base64TestSuite_test_b64Validate;
+
+static class TestDescription_suite_Base64TestSuite_test_b64EncodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64EncodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 61, "test_b64EncodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeString(); }
+} testDescription_suite_Base64TestSuite_test_b64EncodeString;
+
+static class TestDescription_suite_Base64TestSuite_test_b64EncodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64EncodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 69, "test_b64EncodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeStream(); }
+} testDescription_suite_Base64TestSuite_test_b64EncodeStream;
+
+static class TestDescription_suite_Base64TestSuite_test_b64EncodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64EncodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 77, "test_b64EncodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeData(); }
+} testDescription_suite_Base64TestSuite_test_b64EncodeData;
+
+static class TestDescription_suite_Base64TestSuite_test_b64DecodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64DecodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 90, "test_b64DecodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeString(); }
+} testDescription_suite_Base64TestSuite_test_b64DecodeString;
+
+static class TestDescription_suite_Base64TestSuite_test_b64DecodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64DecodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 98, "test_b64DecodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeStream(); }
+} testDescription_suite_Base64TestSuite_test_b64DecodeStream;
+
+static class TestDescription_suite_Base64TestSuite_test_b64DecodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Base64TestSuite_test_b64DecodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 114, "test_b64DecodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeData(); }
+} testDescription_suite_Base64TestSuite_test_b64DecodeData;
+
+#include "common/bitstream.h"
+
+static BitStreamTestSuite suite_BitStreamTestSuite;
+
+static CxxTest::List Tests_BitStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BitStreamTestSuite( "test/common/bitstream.h", 6, "BitStreamTestSuite", suite_BitStreamTestSuite, Tests_BitStreamTestSuite );
+
+static class TestDescription_suite_BitStreamTestSuite_test_get_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_get_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 24, "test_get_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bit(); }
+} testDescription_suite_BitStreamTestSuite_test_get_bit;
+
+static class TestDescription_suite_BitStreamTestSuite_test_get_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_get_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 45, "test_get_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits(); }
+} testDescription_suite_BitStreamTestSuite_test_get_bits;
+
+static class TestDescription_suite_BitStreamTestSuite_test_skip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_skip() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 69, "test_skip" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_skip(); }
+} testDescription_suite_BitStreamTestSuite_test_skip;
+
+static class TestDescription_suite_BitStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 93, "test_rewind" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_rewind(); }
+} testDescription_suite_BitStreamTestSuite_test_rewind;
+
+static class TestDescription_suite_BitStreamTestSuite_test_peek_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_peek_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 116, "test_peek_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bit(); }
+} testDescription_suite_BitStreamTestSuite_test_peek_bit;
+
+static class TestDescription_suite_BitStreamTestSuite_test_peek_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_peek_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 142, "test_peek_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits(); }
+} testDescription_suite_BitStreamTestSuite_test_peek_bits;
+
+static class TestDescription_suite_BitStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 165, "test_eos" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_eos(); }
+} testDescription_suite_BitStreamTestSuite_test_eos;
+
+static class TestDescription_suite_BitStreamTestSuite_test_get_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_get_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 186, "test_get_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits_lsb(); }
+} testDescription_suite_BitStreamTestSuite_test_get_bits_lsb;
+
+static class TestDescription_suite_BitStreamTestSuite_test_peek_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_peek_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 212, "test_peek_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits_lsb(); }
+} testDescription_suite_BitStreamTestSuite_test_peek_bits_lsb;
+
+static class TestDescription_suite_BitStreamTestSuite_test_align : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_align() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 233, "test_align" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align(); }
+} testDescription_suite_BitStreamTestSuite_test_align;
+
+static class TestDescription_suite_BitStreamTestSuite_test_align_16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BitStreamTestSuite_test_align_16() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 254, "test_align_16" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align_16(); }
+} testDescription_suite_BitStreamTestSuite_test_align_16;
+
+#include "/root/repo/test/common/bufferedreadstream.h"
+
+static BufferedReadStreamTestSuite suite_BufferedReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedReadStreamTestSuite( "test/common/bufferedreadstream.h", 6, "BufferedReadStreamTestSuite", suite_BufferedReadStreamTestSuite, Tests_BufferedReadStreamTestSuite );
+
+static class TestDescription_suite_BufferedReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BufferedReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse(); }
+} testDescription_suite_BufferedReadStreamTestSuite_test_traverse;
+
+static class TestDescription_suite_BufferedReadStreamTestSuite_test_traverse2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BufferedReadStreamTestSuite_test_traverse2() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 34, "test_traverse2" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse2(); }
+} testDescription_suite_BufferedReadStreamTestSuite_test_traverse2;
+
+#include "/root/repo/test/common/bufferedseekablereadstream.h"
+
+static BufferedSeekableReadStreamTestSuite suite_BufferedSeekableReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedSeekableReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedSeekableReadStreamTestSuite( "test/common/bufferedseekablereadstream.h", 6, "BufferedSeekableReadStreamTestSuite", suite_BufferedSeekableReadStreamTestSuite, Tests_BufferedSeekableReadStreamTestSuite );
+
+static class TestDescription_suite_BufferedSeekableReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BufferedSeekableReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_traverse(); }
+} testDescription_suite_BufferedSeekableReadStreamTestSuite_test_traverse;
+
+static class TestDescription_suite_BufferedSeekableReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BufferedSeekableReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 33, "test_seek" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_seek(); }
+} testDescription_suite_BufferedSeekableReadStreamTestSuite_test_seek;
+
+#include "common/crc.h"
+
+static CrcTestSuite suite_CrcTestSuite;
+
+static CxxTest::List Tests_CrcTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CrcTestSuite( "test/common/crc.h", 11, "CrcTestSuite", suite_CrcTestSuite, Tests_CrcTestSuite );
+
+static class TestDescription_suite_CrcTestSuite_test_crc32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc32() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 14, "test_crc32" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32(); }
+} testDescription_suite_CrcTestSuite_test_crc32;
+
+static class TestDescription_suite_CrcTestSuite_test_crc16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc16() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 24, "test_crc16" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16(); }
+} testDescription_suite_CrcTestSuite_test_crc16;
+
+static class TestDescription_suite_CrcTestSuite_test_crc_ccitt : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc_ccitt() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 34, "test_crc_ccitt" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt(); }
+} testDescription_suite_CrcTestSuite_test_crc_ccitt;
+
+static class TestDescription_suite_CrcTestSuite_test_crc_binhex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc_binhex() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 44, "test_crc_binhex" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex(); }
+} testDescription_suite_CrcTestSuite_test_crc_binhex;
+
+static class TestDescription_suite_CrcTestSuite_test_crc32_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc32_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 54, "test_crc32_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32_slow(); }
+} testDescription_suite_CrcTestSuite_test_crc32_slow;
+
+static class TestDescription_suite_CrcTestSuite_test_crc16_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc16_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 59, "test_crc16_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16_slow(); }
+} testDescription_suite_CrcTestSuite_test_crc16_slow;
+
+static class TestDescription_suite_CrcTestSuite_test_crc_ccitt_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc_ccitt_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 64, "test_crc_ccitt_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt_slow(); }
+} testDescription_suite_CrcTestSuite_test_crc_ccitt_slow;
+
+static class TestDescription_suite_CrcTestSuite_test_crc_binhex_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CrcTestSuite_test_crc_binhex_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 69, "test_crc_binhex_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex_slow(); }
+} testDescription_suite_CrcTestSuite_test_crc_binhex_slow;
+
+#include "/root/repo/test/common/encoding.h"
+
+static EncodingTestSuite suite_EncodingTestSuite;
+
+static CxxTest::List Tests_EncodingTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EncodingTestSuite( "test/common/encoding.h", 15, "EncodingTestSuite", suite_EncodingTestSuite, Tests_EncodingTestSuite );
+
+static class TestDescription_suite_EncodingTestSuite_test_korean : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_korean() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 30, "test_korean" ) {}
+ void runTest() { suite_EncodingTestSuite.test_korean(); }
+} testDescription_suite_EncodingTestSuite_test_korean;
+
+static class TestDescription_suite_EncodingTestSuite_test_chinese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_chinese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 70, "test_chinese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_chinese(); }
+} testDescription_suite_EncodingTestSuite_test_chinese;
+
+static class TestDescription_suite_EncodingTestSuite_test_japanese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_japanese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 105, "test_japanese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_japanese(); }
+} testDescription_suite_EncodingTestSuite_test_japanese;
+
+static class TestDescription_suite_EncodingTestSuite_test_conversion_unicode_machine_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_conversion_unicode_machine_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 149, "test_conversion_unicode_machine_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_machine_endian(); }
+} testDescription_suite_EncodingTestSuite_test_conversion_unicode_machine_endian;
+
+static class TestDescription_suite_EncodingTestSuite_test_conversion_unicode_big_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_conversion_unicode_big_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 203, "test_conversion_unicode_big_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_big_endian(); }
+} testDescription_suite_EncodingTestSuite_test_conversion_unicode_big_endian;
+
+static class TestDescription_suite_EncodingTestSuite_test_conversion_unicode_little_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_conversion_unicode_little_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 223, "test_conversion_unicode_little_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_little_endian(); }
+} testDescription_suite_EncodingTestSuite_test_conversion_unicode_little_endian;
+
+static class TestDescription_suite_EncodingTestSuite_test_cyrillic_transliteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_cyrillic_transliteration() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 242, "test_cyrillic_transliteration" ) {}
+ void runTest() { suite_EncodingTestSuite.test_cyrillic_transliteration(); }
+} testDescription_suite_EncodingTestSuite_test_cyrillic_transliteration;
+
+static class TestDescription_suite_EncodingTestSuite_test_other_conversions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EncodingTestSuite_test_other_conversions() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 264, "test_other_conversions" ) {}
+ void runTest() { suite_EncodingTestSuite.test_other_conversions(); }
+} testDescription_suite_EncodingTestSuite_test_other_conversions;
+
+#include "common/endian.h"
+
+static EndianTestSuite suite_EndianTestSuite;
+
+static CxxTest::List Tests_EndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EndianTestSuite( "test/common/endian.h", 4, "EndianTestSuite", suite_EndianTestSuite, Tests_EndianTestSuite );
+
+static class TestDescription_suite_EndianTestSuite_test_MKTAG : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_MKTAG() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 7, "test_MKTAG" ) {}
+ void runTest() { suite_EndianTestSuite.test_MKTAG(); }
+} testDescription_suite_EndianTestSuite_test_MKTAG;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_BE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_BE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 13, "test_READ_BE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT64(); }
+} testDescription_suite_EndianTestSuite_test_READ_BE_UINT64;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_LE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_LE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 19, "test_READ_LE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT64(); }
+} testDescription_suite_EndianTestSuite_test_READ_LE_UINT64;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_BE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_BE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 25, "test_READ_BE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT32(); }
+} testDescription_suite_EndianTestSuite_test_READ_BE_UINT32;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_LE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_LE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 31, "test_READ_LE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT32(); }
+} testDescription_suite_EndianTestSuite_test_READ_LE_UINT32;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_BE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_BE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 37, "test_READ_BE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT16(); }
+} testDescription_suite_EndianTestSuite_test_READ_BE_UINT16;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_LE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_LE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 43, "test_READ_LE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT16(); }
+} testDescription_suite_EndianTestSuite_test_READ_LE_UINT16;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 49, "test_READ_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT32(); }
+} testDescription_suite_EndianTestSuite_test_READ_BE_FLOAT32;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 55, "test_READ_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT32(); }
+} testDescription_suite_EndianTestSuite_test_READ_LE_FLOAT32;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 61, "test_READ_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_READ_BE_FLOAT64;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 67, "test_READ_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_READ_LE_FLOAT64;
+
+static class TestDescription_suite_EndianTestSuite_test_READ_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_READ_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 73, "test_READ_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_FPA_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_READ_FPA_FLOAT64;
+
+static class TestDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 79, "test_WRITE_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT32(); }
+} testDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT32;
+
+static class TestDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 86, "test_WRITE_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT32(); }
+} testDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT32;
+
+static class TestDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 93, "test_WRITE_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_WRITE_BE_FLOAT64;
+
+static class TestDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 100, "test_WRITE_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_WRITE_LE_FLOAT64;
+
+static class TestDescription_suite_EndianTestSuite_test_WRITE_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EndianTestSuite_test_WRITE_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 107, "test_WRITE_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_FPA_FLOAT64(); }
+} testDescription_suite_EndianTestSuite_test_WRITE_FPA_FLOAT64;
+
+#include "common/events.h"
+
+static EventsTestSuite suite_EventsTestSuite;
+
+static CxxTest::List Tests_EventsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EventsTestSuite( "test/common/events.h", 25, "EventsTestSuite", suite_EventsTestSuite, Tests_EventsTestSuite );
+
+static class TestDescription_suite_EventsTestSuite_test_hotspots_show_event : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventsTestSuite_test_hotspots_show_event() : CxxTest::RealTestDescription( Tests_EventsTestSuite, suiteDescription_EventsTestSuite, 27, "test_hotspots_show_event" ) {}
+ void runTest() { suite_EventsTestSuite.test_hotspots_show_event(); }
+} testDescription_suite_EventsTestSuite_test_hotspots_show_event;
+
+static class TestDescription_suite_EventsTestSuite_test_hotspots_hide_event : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventsTestSuite_test_hotspots_hide_event() : CxxTest::RealTestDescription( Tests_EventsTestSuite, suiteDescription_EventsTestSuite, 34, "test_hotspots_hide_event" ) {}
+ void runTest() { suite_EventsTestSuite.test_hotspots_hide_event(); }
+} testDescription_suite_EventsTestSuite_test_hotspots_hide_event;
+
+#include "/root/repo/test/common/fixedstack.h"
+
+static FixedStackTestSuite suite_FixedStackTestSuite;
+
+static CxxTest::List Tests_FixedStackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedStackTestSuite( "test/common/fixedstack.h", 5, "FixedStackTestSuite", suite_FixedStackTestSuite, Tests_FixedStackTestSuite );
+
+static class TestDescription_suite_FixedStackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedStackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_empty_clear(); }
+} testDescription_suite_FixedStackTestSuite_test_empty_clear;
+
+static class TestDescription_suite_FixedStackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedStackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_size(); }
+} testDescription_suite_FixedStackTestSuite_test_size;
+
+static class TestDescription_suite_FixedStackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedStackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_top_pop(); }
+} testDescription_suite_FixedStackTestSuite_test_top_pop;
+
+static class TestDescription_suite_FixedStackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedStackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_assign(); }
+} testDescription_suite_FixedStackTestSuite_test_assign;
+
+#include "common/func.h"
+
+static FuncTestSuite suite_FuncTestSuite;
+
+static CxxTest::List Tests_FuncTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FuncTestSuite( "test/common/func.h", 8, "FuncTestSuite", suite_FuncTestSuite, Tests_FuncTestSuite );
+
+static class TestDescription_suite_FuncTestSuite_test_bind1st : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FuncTestSuite_test_bind1st() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 11, "test_bind1st" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind1st(); }
+} testDescription_suite_FuncTestSuite_test_bind1st;
+
+static class TestDescription_suite_FuncTestSuite_test_bind2nd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FuncTestSuite_test_bind2nd() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 17, "test_bind2nd" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind2nd(); }
+} testDescription_suite_FuncTestSuite_test_bind2nd;
+
+static class TestDescription_suite_FuncTestSuite_test_mem_fun_ref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FuncTestSuite_test_mem_fun_ref() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 33, "test_mem_fun_ref" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun_ref(); }
+} testDescription_suite_FuncTestSuite_test_mem_fun_ref;
+
+static class TestDescription_suite_FuncTestSuite_test_mem_fun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FuncTestSuite_test_mem_fun() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 44, "test_mem_fun" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun(); }
+} testDescription_suite_FuncTestSuite_test_mem_fun;
+
+#include "common/hash-str.h"
+
+static HashStrTestSuite suite_HashStrTestSuite;
+
+static CxxTest::List Tests_HashStrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashStrTestSuite( "test/common/hash-str.h", 10, "HashStrTestSuite", suite_HashStrTestSuite, Tests_HashStrTestSuite );
+
+static class TestDescription_suite_HashStrTestSuite_test_case_sensitive_string_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_case_sensitive_string_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 13, "test_case_sensitive_string_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_equal_to(); }
+} testDescription_suite_HashStrTestSuite_test_case_sensitive_string_equal_to;
+
+static class TestDescription_suite_HashStrTestSuite_test_ignore_case_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_ignore_case_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 45, "test_ignore_case_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_equal_to(); }
+} testDescription_suite_HashStrTestSuite_test_ignore_case_equal_to;
+
+static class TestDescription_suite_HashStrTestSuite_test_case_sensitive_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_case_sensitive_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 76, "test_case_sensitive_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_hash(); }
+} testDescription_suite_HashStrTestSuite_test_case_sensitive_string_hash;
+
+static class TestDescription_suite_HashStrTestSuite_test_ignore_case_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_ignore_case_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 98, "test_ignore_case_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_hash(); }
+} testDescription_suite_HashStrTestSuite_test_ignore_case_hash;
+
+static class TestDescription_suite_HashStrTestSuite_test_cpp_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_cpp_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 116, "test_cpp_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_cpp_string_hash(); }
+} testDescription_suite_HashStrTestSuite_test_cpp_string_hash;
+
+static class TestDescription_suite_HashStrTestSuite_test_c_style_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashStrTestSuite_test_c_style_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 138, "test_c_style_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_c_style_string_hash(); }
+} testDescription_suite_HashStrTestSuite_test_c_style_string_hash;
+
+#include "common/hashmap.h"
+
+static HashMapTestSuite suite_HashMapTestSuite;
+
+static CxxTest::List Tests_HashMapTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashMapTestSuite( "test/common/hashmap.h", 6, "HashMapTestSuite", suite_HashMapTestSuite, Tests_HashMapTestSuite );
+
+static class TestDescription_suite_HashMapTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 9, "test_empty_clear" ) {}
+ void runTest() { suite_HashMapTestSuite.test_empty_clear(); }
+} testDescription_suite_HashMapTestSuite_test_empty_clear;
+
+static class TestDescription_suite_HashMapTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 27, "test_contains" ) {}
+ void runTest() { suite_HashMapTestSuite.test_contains(); }
+} testDescription_suite_HashMapTestSuite_test_contains;
+
+static class TestDescription_suite_HashMapTestSuite_test_add_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_add_remove() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 45, "test_add_remove" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove(); }
+} testDescription_suite_HashMapTestSuite_test_add_remove;
+
+static class TestDescription_suite_HashMapTestSuite_test_add_remove_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_add_remove_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 74, "test_add_remove_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove_iterator(); }
+} testDescription_suite_HashMapTestSuite_test_add_remove_iterator;
+
+static class TestDescription_suite_HashMapTestSuite_test_lookup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_lookup() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 103, "test_lookup" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup(); }
+} testDescription_suite_HashMapTestSuite_test_lookup;
+
+static class TestDescription_suite_HashMapTestSuite_test_lookup_with_default : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_lookup_with_default() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 118, "test_lookup_with_default" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup_with_default(); }
+} testDescription_suite_HashMapTestSuite_test_lookup_with_default;
+
+static class TestDescription_suite_HashMapTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 136, "test_iterator_begin_end" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator_begin_end(); }
+} testDescription_suite_HashMapTestSuite_test_iterator_begin_end;
+
+static class TestDescription_suite_HashMapTestSuite_test_hash_map_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_hash_map_copy() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 151, "test_hash_map_copy" ) {}
+ void runTest() { suite_HashMapTestSuite.test_hash_map_copy(); }
+} testDescription_suite_HashMapTestSuite_test_hash_map_copy;
+
+static class TestDescription_suite_HashMapTestSuite_test_collision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_collision() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 158, "test_collision" ) {}
+ void runTest() { suite_HashMapTestSuite.test_collision(); }
+} testDescription_suite_HashMapTestSuite_test_collision;
+
+static class TestDescription_suite_HashMapTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HashMapTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 200, "test_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator(); }
+} testDescription_suite_HashMapTestSuite_test_iterator;
+
+#include "/root/repo/test/common/ini-file.h"
+
+static IniFileTestSuite suite_IniFileTestSuite;
+
+static CxxTest::List Tests_IniFileTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IniFileTestSuite( "test/common/ini-file.h", 7, "IniFileTestSuite", suite_IniFileTestSuite, Tests_IniFileTestSuite );
+
+static class TestDescription_suite_IniFileTestSuite_test_blank_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_blank_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 9, "test_blank_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_blank_ini_file(); }
+} testDescription_suite_IniFileTestSuite_test_blank_ini_file;
+
+static class TestDescription_suite_IniFileTestSuite_test_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 18, "test_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_simple_ini_file(); }
+} testDescription_suite_IniFileTestSuite_test_simple_ini_file;
+
+static class TestDescription_suite_IniFileTestSuite_test_multisection_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_multisection_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 41, "test_multisection_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_multisection_ini_file(); }
+} testDescription_suite_IniFileTestSuite_test_multisection_ini_file;
+
+static class TestDescription_suite_IniFileTestSuite_test_modify_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_modify_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 69, "test_modify_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_modify_ini_file(); }
+} testDescription_suite_IniFileTestSuite_test_modify_ini_file;
+
+static class TestDescription_suite_IniFileTestSuite_test_name_validity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_name_validity() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 93, "test_name_validity" ) {}
+ void runTest() { suite_IniFileTestSuite.test_name_validity(); }
+} testDescription_suite_IniFileTestSuite_test_name_validity;
+
+static class TestDescription_suite_IniFileTestSuite_test_write_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IniFileTestSuite_test_write_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 126, "test_write_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_write_simple_ini_file(); }
+} testDescription_suite_IniFileTestSuite_test_write_simple_ini_file;
+
+#include "common/intrinsics.h"
+
+static IntrinsicsTestSuite suite_IntrinsicsTestSuite;
+
+static CxxTest::List Tests_IntrinsicsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IntrinsicsTestSuite( "test/common/intrinsics.h", 5, "IntrinsicsTestSuite", suite_IntrinsicsTestSuite, Tests_IntrinsicsTestSuite );
+
+static class TestDescription_suite_IntrinsicsTestSuite_test_intLog2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IntrinsicsTestSuite_test_intLog2() : CxxTest::RealTestDescription( Tests_IntrinsicsTestSuite, suiteDescription_IntrinsicsTestSuite, 8, "test_intLog2" ) {}
+ void runTest() { suite_IntrinsicsTestSuite.test_intLog2(); }
+} testDescription_suite_IntrinsicsTestSuite_test_intLog2;
+
+#include "common/list.h"
+
+static ListTestSuite suite_ListTestSuite;
+
+static CxxTest::List Tests_ListTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ListTestSuite( "test/common/list.h", 5, "ListTestSuite", suite_ListTestSuite, Tests_ListTestSuite );
+
+static class TestDescription_suite_ListTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 8, "test_empty_clear" ) {}
+ void runTest() { suite_ListTestSuite.test_empty_clear(); }
+} testDescription_suite_ListTestSuite_test_empty_clear;
+
+static class TestDescription_suite_ListTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_size() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 19, "test_size" ) {}
+ void runTest() { suite_ListTestSuite.test_size(); }
+} testDescription_suite_ListTestSuite_test_size;
+
+static class TestDescription_suite_ListTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 30, "test_iterator_begin_end" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator_begin_end(); }
+} testDescription_suite_ListTestSuite_test_iterator_begin_end;
+
+static class TestDescription_suite_ListTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 45, "test_iterator" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator(); }
+} testDescription_suite_ListTestSuite_test_iterator;
+
+static class TestDescription_suite_ListTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 89, "test_insert" ) {}
+ void runTest() { suite_ListTestSuite.test_insert(); }
+} testDescription_suite_ListTestSuite_test_insert;
+
+static class TestDescription_suite_ListTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 141, "test_erase" ) {}
+ void runTest() { suite_ListTestSuite.test_erase(); }
+} testDescription_suite_ListTestSuite_test_erase;
+
+static class TestDescription_suite_ListTestSuite_test_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_remove() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 181, "test_remove" ) {}
+ void runTest() { suite_ListTestSuite.test_remove(); }
+} testDescription_suite_ListTestSuite_test_remove;
+
+static class TestDescription_suite_ListTestSuite_test_reverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_reverse() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 217, "test_reverse" ) {}
+ void runTest() { suite_ListTestSuite.test_reverse(); }
+} testDescription_suite_ListTestSuite_test_reverse;
+
+static class TestDescription_suite_ListTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ListTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 259, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ListTestSuite.test_front_back_push_pop(); }
+} testDescription_suite_ListTestSuite_test_front_back_push_pop;
+
+#include "common/macresman.h"
+
+static MacResManagerTestSuite suite_MacResManagerTestSuite;
+
+static CxxTest::List Tests_MacResManagerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MacResManagerTestSuite( "test/common/macresman.h", 11, "MacResManagerTestSuite", suite_MacResManagerTestSuite, Tests_MacResManagerTestSuite );
+
+static class TestDescription_suite_MacResManagerTestSuite_test_lookups : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MacResManagerTestSuite_test_lookups() : CxxTest::RealTestDescription( Tests_MacResManagerTestSuite, suiteDescription_MacResManagerTestSuite, 132, "test_lookups" ) {}
+ void runTest() { suite_MacResManagerTestSuite.test_lookups(); }
+} testDescription_suite_MacResManagerTestSuite_test_lookups;
+
+static class TestDescription_suite_MacResManagerTestSuite_test_reopen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MacResManagerTestSuite_test_reopen() : CxxTest::RealTestDescription( Tests_MacResManagerTestSuite, suiteDescription_MacResManagerTestSuite, 168, "test_reopen" ) {}
+ void runTest() { suite_MacResManagerTestSuite.test_reopen(); }
+} testDescription_suite_MacResManagerTestSuite_test_reopen;
+
+static class TestDescription_suite_MacResManagerTestSuite_test_changed_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MacResManagerTestSuite_test_changed_file() : CxxTest::RealTestDescription( Tests_MacResManagerTestSuite, suiteDescription_MacResManagerTestSuite, 194, "test_changed_file" ) {}
+ void runTest() { suite_MacResManagerTestSuite.test_changed_file(); }
+} testDescription_suite_MacResManagerTestSuite_test_changed_file;
+
+static class TestDescription_suite_MacResManagerTestSuite_test_same_layout : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MacResManagerTestSuite_test_same_layout() : CxxTest::RealTestDescription( Tests_MacResManagerTestSuite, suiteDescription_MacResManagerTestSuite, 216, "test_same_layout" ) {}
+ void runTest() { suite_MacResManagerTestSuite.test_same_layout(); }
+} testDescription_suite_MacResManagerTestSuite_test_same_layout;
+
+#include "common/md5.h"
+
+static MD5TestSuite suite_MD5TestSuite;
+
+static CxxTest::List Tests_MD5TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MD5TestSuite( "test/common/md5.h", 30, "MD5TestSuite", suite_MD5TestSuite, Tests_MD5TestSuite );
+
+static class TestDescription_suite_MD5TestSuite_test_computeStreamMD5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MD5TestSuite_test_computeStreamMD5() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 32, "test_computeStreamMD5" ) {}
+ void runTest() { suite_MD5TestSuite.test_computeStreamMD5(); }
+} testDescription_suite_MD5TestSuite_test_computeStreamMD5;
+
+#include "/root/repo/test/common/memcachingarchive.h"
+
+static MemcachingArchiveTestSuite suite_MemcachingArchiveTestSuite;
+
+static CxxTest::List Tests_MemcachingArchiveTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemcachingArchiveTestSuite( "test/common/memcachingarchive.h", 7, "MemcachingArchiveTestSuite", suite_MemcachingArchiveTestSuite, Tests_MemcachingArchiveTestSuite );
+
+static class TestDescription_suite_MemcachingArchiveTestSuite_test_lru : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemcachingArchiveTestSuite_test_lru() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 44, "test_lru" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_lru(); }
+} testDescription_suite_MemcachingArchiveTestSuite_test_lru;
+
+#include "common/memory.h"
+
+static MemoryTestSuite suite_MemoryTestSuite;
+
+static CxxTest::List Tests_MemoryTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryTestSuite( "test/common/memory.h", 5, "MemoryTestSuite", suite_MemoryTestSuite, Tests_MemoryTestSuite );
+
+static class TestDescription_suite_MemoryTestSuite_test_memset16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryTestSuite_test_memset16() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 7, "test_memset16" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset16(); }
+} testDescription_suite_MemoryTestSuite_test_memset16;
+
+static class TestDescription_suite_MemoryTestSuite_test_memset32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryTestSuite_test_memset32() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 26, "test_memset32" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset32(); }
+} testDescription_suite_MemoryTestSuite_test_memset32;
+
+static class TestDescription_suite_MemoryTestSuite_test_memset64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryTestSuite_test_memset64() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 45, "test_memset64" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset64(); }
+} testDescription_suite_MemoryTestSuite_test_memset64;
+
+#include "/root/repo/test/common/memoryreadstream.h"
+
+static MemoryReadStreamTestSuite suite_MemoryReadStreamTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamTestSuite( "test/common/memoryreadstream.h", 5, "MemoryReadStreamTestSuite", suite_MemoryReadStreamTestSuite, Tests_MemoryReadStreamTestSuite );
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_set(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_seek_set;
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_cur(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_seek_cur;
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_end(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_seek_end;
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_le(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_seek_read_le;
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_be(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_seek_read_be;
+
+static class TestDescription_suite_MemoryReadStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 92, "test_eos" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_eos(); }
+} testDescription_suite_MemoryReadStreamTestSuite_test_eos;
+
+#include "/root/repo/test/common/memoryreadstreamendian.h"
+
+static MemoryReadStreamEndianTestSuite suite_MemoryReadStreamEndianTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamEndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamEndianTestSuite( "test/common/memoryreadstreamendian.h", 5, "MemoryReadStreamEndianTestSuite", suite_MemoryReadStreamEndianTestSuite, Tests_MemoryReadStreamEndianTestSuite );
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_set(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_set;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_cur(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_cur;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_end(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_end;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 92, "test_seek_read_le2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le2(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_le2;
+
+static class TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 107, "test_seek_read_be2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be2(); }
+} testDescription_suite_MemoryReadStreamEndianTestSuite_test_seek_read_be2;
+
+#include "/root/repo/test/common/memorywritestream.h"
+
+static MemoryWriteStreamTestSuite suite_MemoryWriteStreamTestSuite;
+
+static CxxTest::List Tests_MemoryWriteStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryWriteStreamTestSuite( "test/common/memorywritestream.h", 5, "MemoryWriteStreamTestSuite", suite_MemoryWriteStreamTestSuite, Tests_MemoryWriteStreamTestSuite );
+
+static class TestDescription_suite_MemoryWriteStreamTestSuite_test_err : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryWriteStreamTestSuite_test_err() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 7, "test_err" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_err(); }
+} testDescription_suite_MemoryWriteStreamTestSuite_test_err;
+
+static class TestDescription_suite_MemoryWriteStreamTestSuite_test_write : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemoryWriteStreamTestSuite_test_write() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 22, "test_write" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_write(); }
+} testDescription_suite_MemoryWriteStreamTestSuite_test_write;
+
+#include "/root/repo/test/common/pack.h"
+
+static PackTestSuite suite_PackTestSuite;
+
+static CxxTest::List Tests_PackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PackTestSuite( "test/common/pack.h", 20, "PackTestSuite", suite_PackTestSuite, Tests_PackTestSuite );
+
+static class TestDescription_suite_PackTestSuite_test_packing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PackTestSuite_test_packing() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 23, "test_packing" ) {}
+ void runTest() { suite_PackTestSuite.test_packing(); }
+} testDescription_suite_PackTestSuite_test_packing;
+
+static class TestDescription_suite_PackTestSuite_test_offsets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PackTestSuite_test_offsets() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 27, "test_offsets" ) {}
+ void runTest() { suite_PackTestSuite.test_offsets(); }
+} testDescription_suite_PackTestSuite_test_offsets;
+
+#include "common/path.h"
+
+static PathTestSuite suite_PathTestSuite;
+
+static CxxTest::List Tests_PathTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PathTestSuite( "test/common/path.h", 14, "PathTestSuite", suite_PathTestSuite, Tests_PathTestSuite );
+
+static class TestDescription_suite_PathTestSuite_test_Path : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_Path() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 17, "test_Path" ) {}
+ void runTest() { suite_PathTestSuite.test_Path(); }
+} testDescription_suite_PathTestSuite_test_Path;
+
+static class TestDescription_suite_PathTestSuite_test_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_clear() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 60, "test_clear" ) {}
+ void runTest() { suite_PathTestSuite.test_clear(); }
+} testDescription_suite_PathTestSuite_test_clear;
+
+static class TestDescription_suite_PathTestSuite_test_getLastComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_getLastComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 71, "test_getLastComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_getLastComponent(); }
+} testDescription_suite_PathTestSuite_test_getLastComponent;
+
+static class TestDescription_suite_PathTestSuite_test_baseName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_baseName() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 85, "test_baseName" ) {}
+ void runTest() { suite_PathTestSuite.test_baseName(); }
+} testDescription_suite_PathTestSuite_test_baseName;
+
+static class TestDescription_suite_PathTestSuite_test_getParent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_getParent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 102, "test_getParent" ) {}
+ void runTest() { suite_PathTestSuite.test_getParent(); }
+} testDescription_suite_PathTestSuite_test_getParent;
+
+static class TestDescription_suite_PathTestSuite_test_join : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_join() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 122, "test_join" ) {}
+ void runTest() { suite_PathTestSuite.test_join(); }
+} testDescription_suite_PathTestSuite_test_join;
+
+static class TestDescription_suite_PathTestSuite_test_joinInPlace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_joinInPlace() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 161, "test_joinInPlace" ) {}
+ void runTest() { suite_PathTestSuite.test_joinInPlace(); }
+} testDescription_suite_PathTestSuite_test_joinInPlace;
+
+static class TestDescription_suite_PathTestSuite_test_append : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_append() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 183, "test_append" ) {}
+ void runTest() { suite_PathTestSuite.test_append(); }
+} testDescription_suite_PathTestSuite_test_append;
+
+static class TestDescription_suite_PathTestSuite_test_appendComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_appendComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 205, "test_appendComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_appendComponent(); }
+} testDescription_suite_PathTestSuite_test_appendComponent;
+
+static class TestDescription_suite_PathTestSuite_test_separator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_separator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 225, "test_separator" ) {}
+ void runTest() { suite_PathTestSuite.test_separator(); }
+} testDescription_suite_PathTestSuite_test_separator;
+
+static class TestDescription_suite_PathTestSuite_test_splitComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_splitComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 236, "test_splitComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_splitComponents(); }
+} testDescription_suite_PathTestSuite_test_splitComponents;
+
+static class TestDescription_suite_PathTestSuite_test_joinComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_joinComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 271, "test_joinComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_joinComponents(); }
+} testDescription_suite_PathTestSuite_test_joinComponents;
+
+static class TestDescription_suite_PathTestSuite_test_removeTrailingSeparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_removeTrailingSeparators() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 288, "test_removeTrailingSeparators" ) {}
+ void runTest() { suite_PathTestSuite.test_removeTrailingSeparators(); }
+} testDescription_suite_PathTestSuite_test_removeTrailingSeparators;
+
+static class TestDescription_suite_PathTestSuite_test_isRelativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_isRelativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 306, "test_isRelativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_isRelativeTo(); }
+} testDescription_suite_PathTestSuite_test_isRelativeTo;
+
+static class TestDescription_suite_PathTestSuite_test_relativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_relativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 335, "test_relativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_relativeTo(); }
+} testDescription_suite_PathTestSuite_test_relativeTo;
+
+static class TestDescription_suite_PathTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 367, "test_normalize" ) {}
+ void runTest() { suite_PathTestSuite.test_normalize(); }
+} testDescription_suite_PathTestSuite_test_normalize;
+
+static class TestDescription_suite_PathTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 401, "test_punycode" ) {}
+ void runTest() { suite_PathTestSuite.test_punycode(); }
+} testDescription_suite_PathTestSuite_test_punycode;
+
+static class TestDescription_suite_PathTestSuite_test_lowerupper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_lowerupper() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 434, "test_lowerupper" ) {}
+ void runTest() { suite_PathTestSuite.test_lowerupper(); }
+} testDescription_suite_PathTestSuite_test_lowerupper;
+
+static class TestDescription_suite_PathTestSuite_test_caseinsensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_caseinsensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 454, "test_caseinsensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_caseinsensitive(); }
+} testDescription_suite_PathTestSuite_test_caseinsensitive;
+
+static class TestDescription_suite_PathTestSuite_test_casesensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_casesensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 475, "test_casesensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_casesensitive(); }
+} testDescription_suite_PathTestSuite_test_casesensitive;
+
+static class TestDescription_suite_PathTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 485, "test_matchString" ) {}
+ void runTest() { suite_PathTestSuite.test_matchString(); }
+} testDescription_suite_PathTestSuite_test_matchString;
+
+static class TestDescription_suite_PathTestSuite_test_findLastSeparator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_findLastSeparator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 526, "test_findLastSeparator" ) {}
+ void runTest() { suite_PathTestSuite.test_findLastSeparator(); }
+} testDescription_suite_PathTestSuite_test_findLastSeparator;
+
+static class TestDescription_suite_PathTestSuite_test_extract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_extract() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 534, "test_extract" ) {}
+ void runTest() { suite_PathTestSuite.test_extract(); }
+} testDescription_suite_PathTestSuite_test_extract;
+
+static class TestDescription_suite_PathTestSuite_test_canUnescape : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_canUnescape() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 543, "test_canUnescape" ) {}
+ void runTest() { suite_PathTestSuite.test_canUnescape(); }
+} testDescription_suite_PathTestSuite_test_canUnescape;
+
+static class TestDescription_suite_PathTestSuite_test_removeExtension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PathTestSuite_test_removeExtension() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 547, "test_removeExtension" ) {}
+ void runTest() { suite_PathTestSuite.test_removeExtension(); }
+} testDescription_suite_PathTestSuite_test_removeExtension;
+
+#include "common/ptr.h"
+
+static PtrTestSuite suite_PtrTestSuite;
+
+static CxxTest::List Tests_PtrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PtrTestSuite( "test/common/ptr.h", 5, "PtrTestSuite", suite_PtrTestSuite, Tests_PtrTestSuite );
+
+static class TestDescription_suite_PtrTestSuite_test_deletion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_deletion() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 25, "test_deletion" ) {}
+ void runTest() { suite_PtrTestSuite.test_deletion(); }
+} testDescription_suite_PtrTestSuite_test_deletion;
+
+static class TestDescription_suite_PtrTestSuite_test_scoped_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_scoped_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 45, "test_scoped_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deleter(); }
+} testDescription_suite_PtrTestSuite_test_scoped_deleter;
+
+static class TestDescription_suite_PtrTestSuite_test_disposable_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_disposable_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 56, "test_disposable_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deleter(); }
+} testDescription_suite_PtrTestSuite_test_disposable_deleter;
+
+static class TestDescription_suite_PtrTestSuite_test_scoped_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_scoped_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 76, "test_scoped_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deref(); }
+} testDescription_suite_PtrTestSuite_test_scoped_deref;
+
+static class TestDescription_suite_PtrTestSuite_test_disposable_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_disposable_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 84, "test_disposable_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deref(); }
+} testDescription_suite_PtrTestSuite_test_disposable_deref;
+
+static class TestDescription_suite_PtrTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 92, "test_assign" ) {}
+ void runTest() { suite_PtrTestSuite.test_assign(); }
+} testDescription_suite_PtrTestSuite_test_assign;
+
+static class TestDescription_suite_PtrTestSuite_test_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 128, "test_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_deleter(); }
+} testDescription_suite_PtrTestSuite_test_deleter;
+
+static class TestDescription_suite_PtrTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 140, "test_compare" ) {}
+ void runTest() { suite_PtrTestSuite.test_compare(); }
+} testDescription_suite_PtrTestSuite_test_compare;
+
+static class TestDescription_suite_PtrTestSuite_test_cast : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_cast() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 154, "test_cast" ) {}
+ void runTest() { suite_PtrTestSuite.test_cast(); }
+} testDescription_suite_PtrTestSuite_test_cast;
+
+static class TestDescription_suite_PtrTestSuite_test_weak_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_weak_ptr() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 160, "test_weak_ptr" ) {}
+ void runTest() { suite_PtrTestSuite.test_weak_ptr(); }
+} testDescription_suite_PtrTestSuite_test_weak_ptr;
+
+static class TestDescription_suite_PtrTestSuite_test_disposable_move_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PtrTestSuite_test_disposable_move_assign() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 178, "test_disposable_move_assign" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_move_assign(); }
+} testDescription_suite_PtrTestSuite_test_disposable_move_assign;
+
+#include "common/punycode.h"
+
+static PunycodeTestSuite suite_PunycodeTestSuite;
+
+static CxxTest::List Tests_PunycodeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PunycodeTestSuite( "test/common/punycode.h", 28, "PunycodeTestSuite", suite_PunycodeTestSuite, Tests_PunycodeTestSuite );
+
+static class TestDescription_suite_PunycodeTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PunycodeTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PunycodeTestSuite, suiteDescription_PunycodeTestSuite, 31, "test_punycode" ) {}
+ void runTest() { suite_PunycodeTestSuite.test_punycode(); }
+} testDescription_suite_PunycodeTestSuite_test_punycode;
+
+#include "common/queue.h"
+
+static QueueTestSuite suite_QueueTestSuite;
+
+static CxxTest::List Tests_QueueTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QueueTestSuite( "test/common/queue.h", 5, "QueueTestSuite", suite_QueueTestSuite, Tests_QueueTestSuite );
+
+static class TestDescription_suite_QueueTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QueueTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_QueueTestSuite.test_empty_clear(); }
+} testDescription_suite_QueueTestSuite_test_empty_clear;
+
+static class TestDescription_suite_QueueTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QueueTestSuite_test_size() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_QueueTestSuite.test_size(); }
+} testDescription_suite_QueueTestSuite_test_size;
+
+static class TestDescription_suite_QueueTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QueueTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 35, "test_front_back_push_pop" ) {}
+ void runTest() { suite_QueueTestSuite.test_front_back_push_pop(); }
+} testDescription_suite_QueueTestSuite_test_front_back_push_pop;
+
+static class TestDescription_suite_QueueTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QueueTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 54, "test_assign" ) {}
+ void runTest() { suite_QueueTestSuite.test_assign(); }
+} testDescription_suite_QueueTestSuite_test_assign;
+
+#include "common/rational.h"
+
+static RationalTestSuite suite_RationalTestSuite;
+
+static CxxTest::List Tests_RationalTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RationalTestSuite( "test/common/rational.h", 5, "RationalTestSuite", suite_RationalTestSuite, Tests_RationalTestSuite );
+
+static class TestDescription_suite_RationalTestSuite_test_operators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_operators() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 7, "test_operators" ) {}
+ void runTest() { suite_RationalTestSuite.test_operators(); }
+} testDescription_suite_RationalTestSuite_test_operators;
+
+static class TestDescription_suite_RationalTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 48, "test_assign" ) {}
+ void runTest() { suite_RationalTestSuite.test_assign(); }
+} testDescription_suite_RationalTestSuite_test_assign;
+
+static class TestDescription_suite_RationalTestSuite_test_negative : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_negative() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 60, "test_negative" ) {}
+ void runTest() { suite_RationalTestSuite.test_negative(); }
+} testDescription_suite_RationalTestSuite_test_negative;
+
+static class TestDescription_suite_RationalTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 74, "test_add_sub" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub(); }
+} testDescription_suite_RationalTestSuite_test_add_sub;
+
+static class TestDescription_suite_RationalTestSuite_test_add_sub2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_add_sub2() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 89, "test_add_sub2" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub2(); }
+} testDescription_suite_RationalTestSuite_test_add_sub2;
+
+static class TestDescription_suite_RationalTestSuite_test_mul : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_mul() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 105, "test_mul" ) {}
+ void runTest() { suite_RationalTestSuite.test_mul(); }
+} testDescription_suite_RationalTestSuite_test_mul;
+
+static class TestDescription_suite_RationalTestSuite_test_div : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_div() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 124, "test_div" ) {}
+ void runTest() { suite_RationalTestSuite.test_div(); }
+} testDescription_suite_RationalTestSuite_test_div;
+
+static class TestDescription_suite_RationalTestSuite_test_isOne : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RationalTestSuite_test_isOne() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 134, "test_isOne" ) {}
+ void runTest() { suite_RationalTestSuite.test_isOne(); }
+} testDescription_suite_RationalTestSuite_test_isOne;
+
+#include "common/rect.h"
+
+static RectTestSuite suite_RectTestSuite;
+
+static CxxTest::List Tests_RectTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RectTestSuite( "test/common/rect.h", 5, "RectTestSuite", suite_RectTestSuite, Tests_RectTestSuite );
+
+static class TestDescription_suite_RectTestSuite_test_point_sqrDist : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RectTestSuite_test_point_sqrDist() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 8, "test_point_sqrDist" ) {}
+ void runTest() { suite_RectTestSuite.test_point_sqrDist(); }
+} testDescription_suite_RectTestSuite_test_point_sqrDist;
+
+static class TestDescription_suite_RectTestSuite_test_intersects : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RectTestSuite_test_intersects() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 21, "test_intersects" ) {}
+ void runTest() { suite_RectTestSuite.test_intersects(); }
+} testDescription_suite_RectTestSuite_test_intersects;
+
+static class TestDescription_suite_RectTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RectTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 27, "test_contains" ) {}
+ void runTest() { suite_RectTestSuite.test_contains(); }
+} testDescription_suite_RectTestSuite_test_contains;
+
+static class TestDescription_suite_RectTestSuite_test_extend : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RectTestSuite_test_extend() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 44, "test_extend" ) {}
+ void runTest() { suite_RectTestSuite.test_extend(); }
+} testDescription_suite_RectTestSuite_test_extend;
+
+#include "common/rendermode.h"
+
+static RenderModeTestSuite suite_RenderModeTestSuite;
+
+static CxxTest::List Tests_RenderModeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RenderModeTestSuite( "test/common/rendermode.h", 6, "RenderModeTestSuite", suite_RenderModeTestSuite, Tests_RenderModeTestSuite );
+
+static class TestDescription_suite_RenderModeTestSuite_test_parse_render_mode_good : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RenderModeTestSuite_test_parse_render_mode_good() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 8, "test_parse_render_mode_good" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_good(); }
+} testDescription_suite_RenderModeTestSuite_test_parse_render_mode_good;
+
+static class TestDescription_suite_RenderModeTestSuite_test_parse_render_mode_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RenderModeTestSuite_test_parse_render_mode_bad() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 28, "test_parse_render_mode_bad" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_bad(); }
+} testDescription_suite_RenderModeTestSuite_test_parse_render_mode_bad;
+
+static class TestDescription_suite_RenderModeTestSuite_test_get_render_mode_code_back_and_forth : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RenderModeTestSuite_test_get_render_mode_code_back_and_forth() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 46, "test_get_render_mode_code_back_and_forth" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_get_render_mode_code_back_and_forth(); }
+} testDescription_suite_RenderModeTestSuite_test_get_render_mode_code_back_and_forth;
+
+static class TestDescription_suite_RenderModeTestSuite_test_render_2_guio : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RenderModeTestSuite_test_render_2_guio() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 64, "test_render_2_guio" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_render_2_guio(); }
+} testDescription_suite_RenderModeTestSuite_test_render_2_guio;
+
+#include "/root/repo/test/common/searchset.h"
+
+static SearchSetTestSuite suite_SearchSetTestSuite;
+
+static CxxTest::List Tests_SearchSetTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SearchSetTestSuite( "test/common/searchset.h", 6, "SearchSetTestSuite", suite_SearchSetTestSuite, Tests_SearchSetTestSuite );
+
+static class TestDescription_suite_SearchSetTestSuite_test_priority_lookup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SearchSetTestSuite_test_priority_lookup() : CxxTest::RealTestDescription( Tests_SearchSetTestSuite, suiteDescription_SearchSetTestSuite, 61, "test_priority_lookup" ) {}
+ void runTest() { suite_SearchSetTestSuite.test_priority_lookup(); }
+} testDescription_suite_SearchSetTestSuite_test_priority_lookup;
+
+static class TestDescription_suite_SearchSetTestSuite_test_invalidation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SearchSetTestSuite_test_invalidation() : CxxTest::RealTestDescription( Tests_SearchSetTestSuite, suiteDescription_SearchSetTestSuite, 94, "test_invalidation" ) {}
+ void runTest() { suite_SearchSetTestSuite.test_invalidation(); }
+} testDescription_suite_SearchSetTestSuite_test_invalidation;
+
+static class TestDescription_suite_SearchSetTestSuite_test_independent_sets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SearchSetTestSuite_test_independent_sets() : CxxTest::RealTestDescription( Tests_SearchSetTestSuite, suiteDescription_SearchSetTestSuite, 142, "test_independent_sets" ) {}
+ void runTest() { suite_SearchSetTestSuite.test_independent_sets(); }
+} testDescription_suite_SearchSetTestSuite_test_independent_sets;
+
+static class TestDescription_suite_SearchSetTestSuite_test_unlisted_files : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SearchSetTestSuite_test_unlisted_files() : CxxTest::RealTestDescription( Tests_SearchSetTestSuite, suiteDescription_SearchSetTestSuite, 162, "test_unlisted_files" ) {}
+ void runTest() { suite_SearchSetTestSuite.test_unlisted_files(); }
+} testDescription_suite_SearchSetTestSuite_test_unlisted_files;
+
+#include "/root/repo/test/common/seekablesubreadstream.h"
+
+static SeekableSubReadStreamTestSuite suite_SeekableSubReadStreamTestSuite;
+
+static CxxTest::List Tests_SeekableSubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SeekableSubReadStreamTestSuite( "test/common/seekablesubreadstream.h", 6, "SeekableSubReadStreamTestSuite", suite_SeekableSubReadStreamTestSuite, Tests_SeekableSubReadStreamTestSuite );
+
+static class TestDescription_suite_SeekableSubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SeekableSubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_traverse(); }
+} testDescription_suite_SeekableSubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_suite_SeekableSubReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SeekableSubReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 32, "test_seek" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_seek(); }
+} testDescription_suite_SeekableSubReadStreamTestSuite_test_seek;
+
+#include "common/serializer.h"
+
+static SerializerTestSuite suite_SerializerTestSuite;
+
+static CxxTest::List Tests_SerializerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SerializerTestSuite( "test/common/serializer.h", 6, "SerializerTestSuite", suite_SerializerTestSuite, Tests_SerializerTestSuite );
+
+static class TestDescription_suite_SerializerTestSuite_test_read_v1_as_v1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializerTestSuite_test_read_v1_as_v1() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 96, "test_read_v1_as_v1" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v1(); }
+} testDescription_suite_SerializerTestSuite_test_read_v1_as_v1;
+
+static class TestDescription_suite_SerializerTestSuite_test_read_v1_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializerTestSuite_test_read_v1_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 104, "test_read_v1_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v2(); }
+} testDescription_suite_SerializerTestSuite_test_read_v1_as_v2;
+
+static class TestDescription_suite_SerializerTestSuite_test_read_v2_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializerTestSuite_test_read_v2_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 108, "test_read_v2_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v2_as_v2(); }
+} testDescription_suite_SerializerTestSuite_test_read_v2_as_v2;
+
+#include "common/span.h"
+
+static SpanTestSuite suite_SpanTestSuite;
+
+static CxxTest::List Tests_SpanTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SpanTestSuite( "test/common/span.h", 8, "SpanTestSuite", suite_SpanTestSuite, Tests_SpanTestSuite );
+
+static class TestDescription_suite_SpanTestSuite_test_sibling_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_sibling_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 64, "test_sibling_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sibling_span(); }
+} testDescription_suite_SpanTestSuite_test_sibling_span;
+
+static class TestDescription_suite_SpanTestSuite_test_sub_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_sub_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 72, "test_sub_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sub_span(); }
+} testDescription_suite_SpanTestSuite_test_sub_span;
+
+static class TestDescription_suite_SpanTestSuite_test_span_iterator_const : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_iterator_const() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 82, "test_span_iterator_const" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_const(); }
+} testDescription_suite_SpanTestSuite_test_span_iterator_const;
+
+static class TestDescription_suite_SpanTestSuite_test_span_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_iterator() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 134, "test_span_iterator" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator(); }
+} testDescription_suite_SpanTestSuite_test_span_iterator;
+
+static class TestDescription_suite_SpanTestSuite_test_span_iterator_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_iterator_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 200, "test_span_iterator_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_integers(); }
+} testDescription_suite_SpanTestSuite_test_span_iterator_integers;
+
+static class TestDescription_suite_SpanTestSuite_test_span_iterator_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_iterator_ptr() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 225, "test_span_iterator_ptr" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_ptr(); }
+} testDescription_suite_SpanTestSuite_test_span_iterator_ptr;
+
+static class TestDescription_suite_SpanTestSuite_test_span_owner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_owner() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 242, "test_span_owner" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner(); }
+} testDescription_suite_SpanTestSuite_test_span_owner;
+
+static class TestDescription_suite_SpanTestSuite_test_span_owner_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_owner_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 337, "test_span_owner_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner_named_span(); }
+} testDescription_suite_SpanTestSuite_test_span_owner_named_span;
+
+static class TestDescription_suite_SpanTestSuite_test_span_allocate_from_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_allocate_from_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 412, "test_span_allocate_from_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_allocate_from_stream(); }
+} testDescription_suite_SpanTestSuite_test_span_allocate_from_stream;
+
+static class TestDescription_suite_SpanTestSuite_test_span_byte : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_byte() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 447, "test_span_byte" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_byte(); }
+} testDescription_suite_SpanTestSuite_test_span_byte;
+
+static class TestDescription_suite_SpanTestSuite_test_span_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 485, "test_span_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_integers(); }
+} testDescription_suite_SpanTestSuite_test_span_integers;
+
+static class TestDescription_suite_SpanTestSuite_test_span_string : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_string() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 511, "test_span_string" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_string(); }
+} testDescription_suite_SpanTestSuite_test_span_string;
+
+static class TestDescription_suite_SpanTestSuite_test_span_unsafe_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_unsafe_data() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 524, "test_span_unsafe_data" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_unsafe_data(); }
+} testDescription_suite_SpanTestSuite_test_span_unsafe_data;
+
+static class TestDescription_suite_SpanTestSuite_test_span_subspan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_subspan() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 540, "test_span_subspan" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_subspan(); }
+} testDescription_suite_SpanTestSuite_test_span_subspan;
+
+static class TestDescription_suite_SpanTestSuite_test_span_to_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_to_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 601, "test_span_to_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_to_stream(); }
+} testDescription_suite_SpanTestSuite_test_span_to_stream;
+
+static class TestDescription_suite_SpanTestSuite_test_span_copying : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_copying() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 630, "test_span_copying" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_copying(); }
+} testDescription_suite_SpanTestSuite_test_span_copying;
+
+static class TestDescription_suite_SpanTestSuite_test_span_validation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_validation() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 648, "test_span_validation" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation(); }
+} testDescription_suite_SpanTestSuite_test_span_validation;
+
+static class TestDescription_suite_SpanTestSuite_test_span_validation_message : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_validation_message() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 668, "test_span_validation_message" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation_message(); }
+} testDescription_suite_SpanTestSuite_test_span_validation_message;
+
+static class TestDescription_suite_SpanTestSuite_test_span_comparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_span_comparators() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 689, "test_span_comparators" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_comparators(); }
+} testDescription_suite_SpanTestSuite_test_span_comparators;
+
+static class TestDescription_suite_SpanTestSuite_test_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SpanTestSuite_test_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 716, "test_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_named_span(); }
+} testDescription_suite_SpanTestSuite_test_named_span;
+
+#include "common/stack.h"
+
+static StackTestSuite suite_StackTestSuite;
+
+static CxxTest::List Tests_StackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StackTestSuite( "test/common/stack.h", 5, "StackTestSuite", suite_StackTestSuite, Tests_StackTestSuite );
+
+static class TestDescription_suite_StackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_StackTestSuite.test_empty_clear(); }
+} testDescription_suite_StackTestSuite_test_empty_clear;
+
+static class TestDescription_suite_StackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_StackTestSuite.test_size(); }
+} testDescription_suite_StackTestSuite_test_size;
+
+static class TestDescription_suite_StackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_StackTestSuite.test_top_pop(); }
+} testDescription_suite_StackTestSuite_test_top_pop;
+
+static class TestDescription_suite_StackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_StackTestSuite.test_assign(); }
+} testDescription_suite_StackTestSuite_test_assign;
+
+#include "common/str.h"
+
+static StringTestSuite suite_StringTestSuite;
+
+static CxxTest::List Tests_StringTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StringTestSuite( "test/common/str.h", 8, "StringTestSuite", suite_StringTestSuite, Tests_StringTestSuite );
+
+static class TestDescription_suite_StringTestSuite_test_constructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_constructors() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 11, "test_constructors" ) {}
+ void runTest() { suite_StringTestSuite.test_constructors(); }
+} testDescription_suite_StringTestSuite_test_constructors;
+
+static class TestDescription_suite_StringTestSuite_test_trim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_trim() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 24, "test_trim" ) {}
+ void runTest() { suite_StringTestSuite.test_trim(); }
+} testDescription_suite_StringTestSuite_test_trim;
+
+static class TestDescription_suite_StringTestSuite_test_chop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_chop() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 32, "test_chop" ) {}
+ void runTest() { suite_StringTestSuite.test_chop(); }
+} testDescription_suite_StringTestSuite_test_chop;
+
+static class TestDescription_suite_StringTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 56, "test_empty_clear" ) {}
+ void runTest() { suite_StringTestSuite.test_empty_clear(); }
+} testDescription_suite_StringTestSuite_test_empty_clear;
+
+static class TestDescription_suite_StringTestSuite_test_lastChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_lastChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 63, "test_lastChar" ) {}
+ void runTest() { suite_StringTestSuite.test_lastChar(); }
+} testDescription_suite_StringTestSuite_test_lastChar;
+
+static class TestDescription_suite_StringTestSuite_test_firstChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_firstChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 72, "test_firstChar" ) {}
+ void runTest() { suite_StringTestSuite.test_firstChar(); }
+} testDescription_suite_StringTestSuite_test_firstChar;
+
+static class TestDescription_suite_StringTestSuite_test_assign1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_assign1() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 81, "test_assign1" ) {}
+ void runTest() { suite_StringTestSuite.test_assign1(); }
+} testDescription_suite_StringTestSuite_test_assign1;
+
+static class TestDescription_suite_StringTestSuite_test_assign2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_assign2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 87, "test_assign2" ) {}
+ void runTest() { suite_StringTestSuite.test_assign2(); }
+} testDescription_suite_StringTestSuite_test_assign2;
+
+static class TestDescription_suite_StringTestSuite_test_assign3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_assign3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 93, "test_assign3" ) {}
+ void runTest() { suite_StringTestSuite.test_assign3(); }
+} testDescription_suite_StringTestSuite_test_assign3;
+
+static class TestDescription_suite_StringTestSuite_test_concat1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_concat1() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 99, "test_concat1" ) {}
+ void runTest() { suite_StringTestSuite.test_concat1(); }
+} testDescription_suite_StringTestSuite_test_concat1;
+
+static class TestDescription_suite_StringTestSuite_test_concat2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_concat2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 107, "test_concat2" ) {}
+ void runTest() { suite_StringTestSuite.test_concat2(); }
+} testDescription_suite_StringTestSuite_test_concat2;
+
+static class TestDescription_suite_StringTestSuite_test_concat3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_concat3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 113, "test_concat3" ) {}
+ void runTest() { suite_StringTestSuite.test_concat3(); }
+} testDescription_suite_StringTestSuite_test_concat3;
+
+static class TestDescription_suite_StringTestSuite_test_concat4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_concat4() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 119, "test_concat4" ) {}
+ void runTest() { suite_StringTestSuite.test_concat4(); }
+} testDescription_suite_StringTestSuite_test_concat4;
+
+static class TestDescription_suite_StringTestSuite_test_refCount : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 125, "test_refCount" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount(); }
+} testDescription_suite_StringTestSuite_test_refCount;
+
+static class TestDescription_suite_StringTestSuite_test_refCount2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 140, "test_refCount2" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount2(); }
+} testDescription_suite_StringTestSuite_test_refCount2;
+
+static class TestDescription_suite_StringTestSuite_test_refCount3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 155, "test_refCount3" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount3(); }
+} testDescription_suite_StringTestSuite_test_refCount3;
+
+static class TestDescription_suite_StringTestSuite_test_refCount4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount4() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 169, "test_refCount4" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount4(); }
+} testDescription_suite_StringTestSuite_test_refCount4;
+
+static class TestDescription_suite_StringTestSuite_test_refCount5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount5() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 183, "test_refCount5" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount5(); }
+} testDescription_suite_StringTestSuite_test_refCount5;
+
+static class TestDescription_suite_StringTestSuite_test_refCount6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_refCount6() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 195, "test_refCount6" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount6(); }
+} testDescription_suite_StringTestSuite_test_refCount6;
+
+static class TestDescription_suite_StringTestSuite_test_self_asignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_self_asignment() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 207, "test_self_asignment" ) {}
+ void runTest() { suite_StringTestSuite.test_self_asignment(); }
+} testDescription_suite_StringTestSuite_test_self_asignment;
+
+static class TestDescription_suite_StringTestSuite_test_hasPrefix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_hasPrefix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 257, "test_hasPrefix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasPrefix(); }
+} testDescription_suite_StringTestSuite_test_hasPrefix;
+
+static class TestDescription_suite_StringTestSuite_test_hasSuffix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_hasSuffix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 265, "test_hasSuffix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasSuffix(); }
+} testDescription_suite_StringTestSuite_test_hasSuffix;
+
+static class TestDescription_suite_StringTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 273, "test_contains" ) {}
+ void runTest() { suite_StringTestSuite.test_contains(); }
+} testDescription_suite_StringTestSuite_test_contains;
+
+static class TestDescription_suite_StringTestSuite_test_toLowercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_toLowercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 284, "test_toLowercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toLowercase(); }
+} testDescription_suite_StringTestSuite_test_toLowercase;
+
+static class TestDescription_suite_StringTestSuite_test_toUppercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_toUppercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 292, "test_toUppercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toUppercase(); }
+} testDescription_suite_StringTestSuite_test_toUppercase;
+
+static class TestDescription_suite_StringTestSuite_test_deleteChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_deleteChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 300, "test_deleteChar" ) {}
+ void runTest() { suite_StringTestSuite.test_deleteChar(); }
+} testDescription_suite_StringTestSuite_test_deleteChar;
+
+static class TestDescription_suite_StringTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 308, "test_erase" ) {}
+ void runTest() { suite_StringTestSuite.test_erase(); }
+} testDescription_suite_StringTestSuite_test_erase;
+
+static class TestDescription_suite_StringTestSuite_test_sharing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_sharing() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 316, "test_sharing" ) {}
+ void runTest() { suite_StringTestSuite.test_sharing(); }
+} testDescription_suite_StringTestSuite_test_sharing;
+
+static class TestDescription_suite_StringTestSuite_test_lastPathComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_lastPathComponent() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 325, "test_lastPathComponent" ) {}
+ void runTest() { suite_StringTestSuite.test_lastPathComponent(); }
+} testDescription_suite_StringTestSuite_test_lastPathComponent;
+
+static class TestDescription_suite_StringTestSuite_test_normalizePath : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_normalizePath() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 343, "test_normalizePath" ) {}
+ void runTest() { suite_StringTestSuite.test_normalizePath(); }
+} testDescription_suite_StringTestSuite_test_normalizePath;
+
+static class TestDescription_suite_StringTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 372, "test_matchString" ) {}
+ void runTest() { suite_StringTestSuite.test_matchString(); }
+} testDescription_suite_StringTestSuite_test_matchString;
+
+static class TestDescription_suite_StringTestSuite_test_string_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_string_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 408, "test_string_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_string_printf(); }
+} testDescription_suite_StringTestSuite_test_string_printf;
+
+static class TestDescription_suite_StringTestSuite_test_ustring_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_ustring_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 419, "test_ustring_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_printf(); }
+} testDescription_suite_StringTestSuite_test_ustring_printf;
+
+static class TestDescription_suite_StringTestSuite_test_strlcpy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_strlcpy() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 436, "test_strlcpy" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcpy(); }
+} testDescription_suite_StringTestSuite_test_strlcpy;
+
+static class TestDescription_suite_StringTestSuite_test_strlcat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_strlcat() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 458, "test_strlcat" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcat(); }
+} testDescription_suite_StringTestSuite_test_strlcat;
+
+static class TestDescription_suite_StringTestSuite_test_strnlen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_strnlen() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 489, "test_strnlen" ) {}
+ void runTest() { suite_StringTestSuite.test_strnlen(); }
+} testDescription_suite_StringTestSuite_test_strnlen;
+
+static class TestDescription_suite_StringTestSuite_test_scumm_stricmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_scumm_stricmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 512, "test_scumm_stricmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_stricmp(); }
+} testDescription_suite_StringTestSuite_test_scumm_stricmp;
+
+static class TestDescription_suite_StringTestSuite_test_scumm_strnicmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_scumm_strnicmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 519, "test_scumm_strnicmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_strnicmp(); }
+} testDescription_suite_StringTestSuite_test_scumm_strnicmp;
+
+static class TestDescription_suite_StringTestSuite_test_wordWrap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_wordWrap() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 529, "test_wordWrap" ) {}
+ void runTest() { suite_StringTestSuite.test_wordWrap(); }
+} testDescription_suite_StringTestSuite_test_wordWrap;
+
+static class TestDescription_suite_StringTestSuite_test_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 551, "test_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_replace(); }
+} testDescription_suite_StringTestSuite_test_replace;
+
+static class TestDescription_suite_StringTestSuite_test_ustring_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_ustring_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 625, "test_ustring_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_replace(); }
+} testDescription_suite_StringTestSuite_test_ustring_replace;
+
+static class TestDescription_suite_StringTestSuite_test_find : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_find() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 683, "test_find" ) {}
+ void runTest() { suite_StringTestSuite.test_find(); }
+} testDescription_suite_StringTestSuite_test_find;
+
+static class TestDescription_suite_StringTestSuite_test_setChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_setChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 699, "test_setChar" ) {}
+ void runTest() { suite_StringTestSuite.test_setChar(); }
+} testDescription_suite_StringTestSuite_test_setChar;
+
+static class TestDescription_suite_StringTestSuite_test_insertChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_insertChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 707, "test_insertChar" ) {}
+ void runTest() { suite_StringTestSuite.test_insertChar(); }
+} testDescription_suite_StringTestSuite_test_insertChar;
+
+static class TestDescription_suite_StringTestSuite_test_insertString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_insertString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 717, "test_insertString" ) {}
+ void runTest() { suite_StringTestSuite.test_insertString(); }
+} testDescription_suite_StringTestSuite_test_insertString;
+
+static class TestDescription_suite_StringTestSuite_test_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 727, "test_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_comparison(); }
+} testDescription_suite_StringTestSuite_test_comparison;
+
+static class TestDescription_suite_StringTestSuite_test_ustr_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringTestSuite_test_ustr_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 750, "test_ustr_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_ustr_comparison(); }
+} testDescription_suite_StringTestSuite_test_ustr_comparison;
+
+#include "common/stream.h"
+
+static ReadLineStreamTestSuite suite_ReadLineStreamTestSuite;
+
+static CxxTest::List Tests_ReadLineStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ReadLineStreamTestSuite( "test/common/stream.h", 5, "ReadLineStreamTestSuite", suite_ReadLineStreamTestSuite, Tests_ReadLineStreamTestSuite );
+
+static class TestDescription_suite_ReadLineStreamTestSuite_test_readline : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReadLineStreamTestSuite_test_readline() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 7, "test_readline" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline(); }
+} testDescription_suite_ReadLineStreamTestSuite_test_readline;
+
+static class TestDescription_suite_ReadLineStreamTestSuite_test_readline2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReadLineStreamTestSuite_test_readline2() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 29, "test_readline2" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline2(); }
+} testDescription_suite_ReadLineStreamTestSuite_test_readline2;
+
+#include "/root/repo/test/common/subreadstream.h"
+
+static SubReadStreamTestSuite suite_SubReadStreamTestSuite;
+
+static CxxTest::List Tests_SubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SubReadStreamTestSuite( "test/common/subreadstream.h", 6, "SubReadStreamTestSuite", suite_SubReadStreamTestSuite, Tests_SubReadStreamTestSuite );
+
+static class TestDescription_suite_SubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_traverse(); }
+} testDescription_suite_SubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_suite_SubReadStreamTestSuite_test_safe_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SubReadStreamTestSuite_test_safe_eos() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 30, "test_safe_eos" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_safe_eos(); }
+} testDescription_suite_SubReadStreamTestSuite_test_safe_eos;
+
+#include "common/tokenizer.h"
+
+static TokenizerTestSuite suite_TokenizerTestSuite;
+
+static CxxTest::List Tests_TokenizerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TokenizerTestSuite( "test/common/tokenizer.h", 5, "TokenizerTestSuite", suite_TokenizerTestSuite, Tests_TokenizerTestSuite );
+
+static class TestDescription_suite_TokenizerTestSuite_test_nextToken : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TokenizerTestSuite_test_nextToken() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 7, "test_nextToken" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_nextToken(); }
+} testDescription_suite_TokenizerTestSuite_test_nextToken;
+
+static class TestDescription_suite_TokenizerTestSuite_test_resetAndEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TokenizerTestSuite_test_resetAndEmpty() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 40, "test_resetAndEmpty" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_resetAndEmpty(); }
+} testDescription_suite_TokenizerTestSuite_test_resetAndEmpty;
+
+#include "common/util.h"
+
+static UtilTestSuite suite_UtilTestSuite;
+
+static CxxTest::List Tests_UtilTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UtilTestSuite( "test/common/util.h", 7, "UtilTestSuite", suite_UtilTestSuite, Tests_UtilTestSuite );
+
+static class TestDescription_suite_UtilTestSuite_test_parsebool_yesno : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_parsebool_yesno() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 9, "test_parsebool_yesno" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_yesno(); }
+} testDescription_suite_UtilTestSuite_test_parsebool_yesno;
+
+static class TestDescription_suite_UtilTestSuite_test_parsebool_truefalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_parsebool_truefalse() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 28, "test_parsebool_truefalse" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_truefalse(); }
+} testDescription_suite_UtilTestSuite_test_parsebool_truefalse;
+
+static class TestDescription_suite_UtilTestSuite_test_parsebool_onezero : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_parsebool_onezero() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 47, "test_parsebool_onezero" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_onezero(); }
+} testDescription_suite_UtilTestSuite_test_parsebool_onezero;
+
+static class TestDescription_suite_UtilTestSuite_test_parsebool_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_parsebool_bad() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 70, "test_parsebool_bad" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_bad(); }
+} testDescription_suite_UtilTestSuite_test_parsebool_bad;
+
+static class TestDescription_suite_UtilTestSuite_test_is_al_num : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_al_num() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 107, "test_is_al_num" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_al_num(); }
+} testDescription_suite_UtilTestSuite_test_is_al_num;
+
+static class TestDescription_suite_UtilTestSuite_test_is_alpha : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_alpha() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 128, "test_is_alpha" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_alpha(); }
+} testDescription_suite_UtilTestSuite_test_is_alpha;
+
+static class TestDescription_suite_UtilTestSuite_test_is_digit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_digit() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 149, "test_is_digit" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_digit(); }
+} testDescription_suite_UtilTestSuite_test_is_digit;
+
+static class TestDescription_suite_UtilTestSuite_test_is_lower : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_lower() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 170, "test_is_lower" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_lower(); }
+} testDescription_suite_UtilTestSuite_test_is_lower;
+
+static class TestDescription_suite_UtilTestSuite_test_is_upper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_upper() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 192, "test_is_upper" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_upper(); }
+} testDescription_suite_UtilTestSuite_test_is_upper;
+
+static class TestDescription_suite_UtilTestSuite_test_is_space : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_space() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 212, "test_is_space" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_space(); }
+} testDescription_suite_UtilTestSuite_test_is_space;
+
+static class TestDescription_suite_UtilTestSuite_test_is_print : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_print() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 226, "test_is_print" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_print(); }
+} testDescription_suite_UtilTestSuite_test_is_print;
+
+static class TestDescription_suite_UtilTestSuite_test_is_punct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_is_punct() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 237, "test_is_punct" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_punct(); }
+} testDescription_suite_UtilTestSuite_test_is_punct;
+
+static class TestDescription_suite_UtilTestSuite_test_swap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UtilTestSuite_test_swap() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 314, "test_swap" ) {}
+ void runTest() { suite_UtilTestSuite.test_swap(); }
+} testDescription_suite_UtilTestSuite_test_swap;
+
+#include "common/compression/dcl.h"
+
+static DCLTestSuite suite_DCLTestSuite;
+
+static CxxTest::List Tests_DCLTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DCLTestSuite( "test/common/compression/dcl.h", 44, "DCLTestSuite", suite_DCLTestSuite, Tests_DCLTestSuite );
+
+static class TestDescription_suite_DCLTestSuite_test_binary : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DCLTestSuite_test_binary() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 169, "test_binary" ) {}
+ void runTest() { suite_DCLTestSuite.test_binary(); }
+} testDescription_suite_DCLTestSuite_test_binary;
+
+static class TestDescription_suite_DCLTestSuite_test_ascii : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DCLTestSuite_test_ascii() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 180, "test_ascii" ) {}
+ void runTest() { suite_DCLTestSuite.test_ascii(); }
+} testDescription_suite_DCLTestSuite_test_ascii;
+
+static class TestDescription_suite_DCLTestSuite_test_overlapping_copy_wrapping_dictionary : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DCLTestSuite_test_overlapping_copy_wrapping_dictionary() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 192, "test_overlapping_copy_wrapping_dictionary" ) {}
+ void runTest() { suite_DCLTestSuite.test_overlapping_copy_wrapping_dictionary(); }
+} testDescription_suite_DCLTestSuite_test_overlapping_copy_wrapping_dictionary;
+
+static class TestDescription_suite_DCLTestSuite_test_missing_end_marker : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DCLTestSuite_test_missing_end_marker() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 202, "test_missing_end_marker" ) {}
+ void runTest() { suite_DCLTestSuite.test_missing_end_marker(); }
+} testDescription_suite_DCLTestSuite_test_missing_end_marker;
+
+static class TestDescription_suite_DCLTestSuite_test_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DCLTestSuite_test_speed() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 212, "test_speed" ) {}
+ void runTest() { suite_DCLTestSuite.test_speed(); }
+} testDescription_suite_DCLTestSuite_test_speed;
+
+#include "common/compression/deflate.h"
+
+static DeflateSeekTestSuite suite_DeflateSeekTestSuite;
+
+static CxxTest::List Tests_DeflateSeekTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DeflateSeekTestSuite( "test/common/compression/deflate.h", 39, "DeflateSeekTestSuite", suite_DeflateSeekTestSuite, Tests_DeflateSeekTestSuite );
+
+static class TestDescription_suite_DeflateSeekTestSuite_test_sequential_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeflateSeekTestSuite_test_sequential_read() : CxxTest::RealTestDescription( Tests_DeflateSeekTestSuite, suiteDescription_DeflateSeekTestSuite, 96, "test_sequential_read" ) {}
+ void runTest() { suite_DeflateSeekTestSuite.test_sequential_read(); }
+} testDescription_suite_DeflateSeekTestSuite_test_sequential_read;
+
+static class TestDescription_suite_DeflateSeekTestSuite_test_random_seeks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeflateSeekTestSuite_test_random_seeks() : CxxTest::RealTestDescription( Tests_DeflateSeekTestSuite, suiteDescription_DeflateSeekTestSuite, 104, "test_random_seeks" ) {}
+ void runTest() { suite_DeflateSeekTestSuite.test_random_seeks(); }
+} testDescription_suite_DeflateSeekTestSuite_test_random_seeks;
+
+static class TestDescription_suite_DeflateSeekTestSuite_test_random_seek_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeflateSeekTestSuite_test_random_seek_speed() : CxxTest::RealTestDescription( Tests_DeflateSeekTestSuite, suiteDescription_DeflateSeekTestSuite, 127, "test_random_seek_speed" ) {}
+ void runTest() { suite_DeflateSeekTestSuite.test_random_seek_speed(); }
+} testDescription_suite_DeflateSeekTestSuite_test_random_seek_speed;
+
+#include "common/compression/delta.h"
+
+static DeltaTestSuite suite_DeltaTestSuite;
+
+static CxxTest::List Tests_DeltaTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DeltaTestSuite( "test/common/compression/delta.h", 6, "DeltaTestSuite", suite_DeltaTestSuite, Tests_DeltaTestSuite );
+
+static class TestDescription_suite_DeltaTestSuite_test_small_changes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeltaTestSuite_test_small_changes() : CxxTest::RealTestDescription( Tests_DeltaTestSuite, suiteDescription_DeltaTestSuite, 32, "test_small_changes" ) {}
+ void runTest() { suite_DeltaTestSuite.test_small_changes(); }
+} testDescription_suite_DeltaTestSuite_test_small_changes;
+
+static class TestDescription_suite_DeltaTestSuite_test_size_changes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeltaTestSuite_test_size_changes() : CxxTest::RealTestDescription( Tests_DeltaTestSuite, suiteDescription_DeltaTestSuite, 46, "test_size_changes" ) {}
+ void runTest() { suite_DeltaTestSuite.test_size_changes(); }
+} testDescription_suite_DeltaTestSuite_test_size_changes;
+
+static class TestDescription_suite_DeltaTestSuite_test_corrupt_delta : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DeltaTestSuite_test_corrupt_delta() : CxxTest::RealTestDescription( Tests_DeltaTestSuite, suiteDescription_DeltaTestSuite, 60, "test_corrupt_delta" ) {}
+ void runTest() { suite_DeltaTestSuite.test_corrupt_delta(); }
+} testDescription_suite_DeltaTestSuite_test_corrupt_delta;
+
+#include "common/compression/huffman.h"
+
+static HuffmanTestSuite suite_HuffmanTestSuite;
+
+static CxxTest::List Tests_HuffmanTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HuffmanTestSuite( "test/common/compression/huffman.h", 12, "HuffmanTestSuite", suite_HuffmanTestSuite, Tests_HuffmanTestSuite );
+
+static class TestDescription_suite_HuffmanTestSuite_test_get_with_full_symbols : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HuffmanTestSuite_test_get_with_full_symbols() : CxxTest::RealTestDescription( Tests_HuffmanTestSuite, suiteDescription_HuffmanTestSuite, 14, "test_get_with_full_symbols" ) {}
+ void runTest() { suite_HuffmanTestSuite.test_get_with_full_symbols(); }
+} testDescription_suite_HuffmanTestSuite_test_get_with_full_symbols;
+
+static class TestDescription_suite_HuffmanTestSuite_test_get_without_symbols : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HuffmanTestSuite_test_get_without_symbols() : CxxTest::RealTestDescription( Tests_HuffmanTestSuite, suiteDescription_HuffmanTestSuite, 60, "test_get_without_symbols" ) {}
+ void runTest() { suite_HuffmanTestSuite.test_get_without_symbols(); }
+} testDescription_suite_HuffmanTestSuite_test_get_without_symbols;
+
+static class TestDescription_suite_HuffmanTestSuite_test_get_with_freqs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HuffmanTestSuite_test_get_with_freqs() : CxxTest::RealTestDescription( Tests_HuffmanTestSuite, suiteDescription_HuffmanTestSuite, 98, "test_get_with_freqs" ) {}
+ void runTest() { suite_HuffmanTestSuite.test_get_with_freqs(); }
+} testDescription_suite_HuffmanTestSuite_test_get_with_freqs;
+
+#include "common/compression/installshield_cab.h"
+
+static InstallShieldCabTestSuite suite_InstallShieldCabTestSuite;
+
+static CxxTest::List Tests_InstallShieldCabTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_InstallShieldCabTestSuite( "test/common/compression/installshield_cab.h", 37, "InstallShieldCabTestSuite", suite_InstallShieldCabTestSuite, Tests_InstallShieldCabTestSuite );
+
+static class TestDescription_suite_InstallShieldCabTestSuite_test_split_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_InstallShieldCabTestSuite_test_split_file() : CxxTest::RealTestDescription( Tests_InstallShieldCabTestSuite, suiteDescription_InstallShieldCabTestSuite, 250, "test_split_file" ) {}
+ void runTest() { suite_InstallShieldCabTestSuite.test_split_file(); }
+} testDescription_suite_InstallShieldCabTestSuite_test_split_file;
+
+static class TestDescription_suite_InstallShieldCabTestSuite_test_chunked : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_InstallShieldCabTestSuite_test_chunked() : CxxTest::RealTestDescription( Tests_InstallShieldCabTestSuite, suiteDescription_InstallShieldCabTestSuite, 282, "test_chunked" ) {}
+ void runTest() { suite_InstallShieldCabTestSuite.test_chunked(); }
+} testDescription_suite_InstallShieldCabTestSuite_test_chunked;
+
+#include "/root/repo/test/common/compression/zip.h"
+
+static ZipArchiveTestSuite suite_ZipArchiveTestSuite;
+
+static CxxTest::List Tests_ZipArchiveTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ZipArchiveTestSuite( "test/common/compression/zip.h", 14, "ZipArchiveTestSuite", suite_ZipArchiveTestSuite, Tests_ZipArchiveTestSuite );
+
+static class TestDescription_suite_ZipArchiveTestSuite_test_members : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZipArchiveTestSuite_test_members() : CxxTest::RealTestDescription( Tests_ZipArchiveTestSuite, suiteDescription_ZipArchiveTestSuite, 126, "test_members" ) {}
+ void runTest() { suite_ZipArchiveTestSuite.test_members(); }
+} testDescription_suite_ZipArchiveTestSuite_test_members;
+
+#include "common/formats/quicktime.h"
+
+static QuicktimeParserTestSuite suite_QuicktimeParserTestSuite;
+
+static CxxTest::List Tests_QuicktimeParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuicktimeParserTestSuite( "test/common/formats/quicktime.h", 40, "QuicktimeParserTestSuite", suite_QuicktimeParserTestSuite, Tests_QuicktimeParserTestSuite );
+
+static class TestDescription_suite_QuicktimeParserTestSuite_test_streamAtEOS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuicktimeParserTestSuite_test_streamAtEOS() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 42, "test_streamAtEOS" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamAtEOS(); }
+} testDescription_suite_QuicktimeParserTestSuite_test_streamAtEOS;
+
+static class TestDescription_suite_QuicktimeParserTestSuite_test_streamInvalid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuicktimeParserTestSuite_test_streamInvalid() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 51, "test_streamInvalid" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamInvalid(); }
+} testDescription_suite_QuicktimeParserTestSuite_test_streamInvalid;
+
+static class TestDescription_suite_QuicktimeParserTestSuite_test_moov : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuicktimeParserTestSuite_test_moov() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 59, "test_moov" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_moov(); }
+} testDescription_suite_QuicktimeParserTestSuite_test_moov;
+
+static class TestDescription_suite_QuicktimeParserTestSuite_test_mhdr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuicktimeParserTestSuite_test_mhdr() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 66, "test_mhdr" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdr(); }
+} testDescription_suite_QuicktimeParserTestSuite_test_mhdr;
+
+static class TestDescription_suite_QuicktimeParserTestSuite_test_mhdrEarlyEOF : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuicktimeParserTestSuite_test_mhdrEarlyEOF() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 76, "test_mhdrEarlyEOF" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdrEarlyEOF(); }
+} testDescription_suite_QuicktimeParserTestSuite_test_mhdrEarlyEOF;
+
+#include "audio/audiostream.h"
+
+static AudioStreamTestSuite suite_AudioStreamTestSuite;
+
+static CxxTest::List Tests_AudioStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AudioStreamTestSuite( "test/audio/audiostream.h", 7, "AudioStreamTestSuite", suite_AudioStreamTestSuite, Tests_AudioStreamTestSuite );
+
+static class TestDescription_suite_AudioStreamTestSuite_test_convertTimeToStreamPos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_convertTimeToStreamPos() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 10, "test_convertTimeToStreamPos" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_convertTimeToStreamPos(); }
+} testDescription_suite_AudioStreamTestSuite_test_convertTimeToStreamPos;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 104, "test_looping_audio_stream_mono_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_11025_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 108, "test_looping_audio_stream_mono_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_22050_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 112, "test_looping_audio_stream_stereo_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_11025_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 116, "test_looping_audio_stream_stereo_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_22050_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 177, "test_sub_looping_audio_stream_mono_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_mid_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 181, "test_sub_looping_audio_stream_mono_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_mid_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 185, "test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 189, "test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 193, "test_sub_looping_audio_stream_mono_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_end_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 197, "test_sub_looping_audio_stream_mono_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_end_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 201, "test_sub_looping_audio_stream_stereo_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_end_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter;
+
+static class TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 205, "test_sub_looping_audio_stream_stereo_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_end_fixed_iter(); }
+} testDescription_suite_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter;
+
+#include "audio/rate.h"
+
+static RateTestSuite suite_RateTestSuite;
+
+static CxxTest::List Tests_RateTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RateTestSuite( "test/audio/rate.h", 32, "RateTestSuite", suite_RateTestSuite, Tests_RateTestSuite );
+
+static class TestDescription_suite_RateTestSuite_test_upsample_partial_group : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RateTestSuite_test_upsample_partial_group() : CxxTest::RealTestDescription( Tests_RateTestSuite, suiteDescription_RateTestSuite, 40, "test_upsample_partial_group" ) {}
+ void runTest() { suite_RateTestSuite.test_upsample_partial_group(); }
+} testDescription_suite_RateTestSuite_test_upsample_partial_group;
+
+static class TestDescription_suite_RateTestSuite_test_upsample_partial_group_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RateTestSuite_test_upsample_partial_group_mono() : CxxTest::RealTestDescription( Tests_RateTestSuite, suiteDescription_RateTestSuite, 78, "test_upsample_partial_group_mono" ) {}
+ void runTest() { suite_RateTestSuite.test_upsample_partial_group_mono(); }
+} testDescription_suite_RateTestSuite_test_upsample_partial_group_mono;
+
+static class TestDescription_suite_RateTestSuite_test_upsample_partial_group_sndio_blocks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RateTestSuite_test_upsample_partial_group_sndio_blocks() : CxxTest::RealTestDescription( Tests_RateTestSuite, suiteDescription_RateTestSuite, 103, "test_upsample_partial_group_sndio_blocks" ) {}
+ void runTest() { suite_RateTestSuite.test_upsample_partial_group_sndio_blocks(); }
+} testDescription_suite_RateTestSuite_test_upsample_partial_group_sndio_blocks;
+
+static class TestDescription_suite_RateTestSuite_test_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RateTestSuite_test_copy() : CxxTest::RealTestDescription( Tests_RateTestSuite, suiteDescription_RateTestSuite, 139, "test_copy" ) {}
+ void runTest() { suite_RateTestSuite.test_copy(); }
+} testDescription_suite_RateTestSuite_test_copy;
+
+static class TestDescription_suite_RateTestSuite_test_reset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RateTestSuite_test_reset() : CxxTest::RealTestDescription( Tests_RateTestSuite, suiteDescription_RateTestSuite, 158, "test_reset" ) {}
+ void runTest() { suite_RateTestSuite.test_reset(); }
+} testDescription_suite_RateTestSuite_test_reset;
+
+#include "/root/repo/test/audio/raw.h"
+
+static RawStreamTestSuite suite_RawStreamTestSuite;
+
+static CxxTest::List Tests_RawStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RawStreamTestSuite( "test/audio/raw.h", 8, "RawStreamTestSuite", suite_RawStreamTestSuite, Tests_RawStreamTestSuite );
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 28, "test_read_buffer_8_bit_signed_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 32, "test_read_buffer_8_bit_signed_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 36, "test_read_buffer_8_bit_unsigned_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_unsigned_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 40, "test_read_buffer_16_bit_signed_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 44, "test_read_buffer_16_bit_signed_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 48, "test_read_buffer_16_bit_unsigned_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 52, "test_read_buffer_16_bit_unsigned_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 56, "test_read_buffer_16_bit_signed_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 60, "test_read_buffer_16_bit_signed_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 64, "test_read_buffer_16_bit_unsigned_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 68, "test_read_buffer_16_bit_unsigned_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo;
+
+static class TestDescription_suite_RawStreamTestSuite_test_partial_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_partial_read() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 98, "test_partial_read" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_partial_read(); }
+} testDescription_suite_RawStreamTestSuite_test_partial_read;
+
+static class TestDescription_suite_RawStreamTestSuite_test_read_after_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_read_after_end() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 120, "test_read_after_end" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_after_end(); }
+} testDescription_suite_RawStreamTestSuite_test_read_after_end;
+
+static class TestDescription_suite_RawStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 144, "test_rewind" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_rewind(); }
+} testDescription_suite_RawStreamTestSuite_test_rewind;
+
+static class TestDescription_suite_RawStreamTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_length() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 207, "test_length" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_length(); }
+} testDescription_suite_RawStreamTestSuite_test_length;
+
+static class TestDescription_suite_RawStreamTestSuite_test_seek_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_seek_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 284, "test_seek_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_mono(); }
+} testDescription_suite_RawStreamTestSuite_test_seek_mono;
+
+static class TestDescription_suite_RawStreamTestSuite_test_seek_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RawStreamTestSuite_test_seek_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 288, "test_seek_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_stereo(); }
+} testDescription_suite_RawStreamTestSuite_test_seek_stereo;
+
+#include "audio/timestamp.h"
+
+static TimestampTestSuite suite_TimestampTestSuite;
+
+static CxxTest::List Tests_TimestampTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimestampTestSuite( "test/audio/timestamp.h", 5, "TimestampTestSuite", suite_TimestampTestSuite, Tests_TimestampTestSuite );
+
+static class TestDescription_suite_TimestampTestSuite_test_diff_add_frames : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_diff_add_frames() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 8, "test_diff_add_frames" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_frames(); }
+} testDescription_suite_TimestampTestSuite_test_diff_add_frames;
+
+static class TestDescription_suite_TimestampTestSuite_test_diff_add_msecs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_diff_add_msecs() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 26, "test_diff_add_msecs" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_msecs(); }
+} testDescription_suite_TimestampTestSuite_test_diff_add_msecs;
+
+static class TestDescription_suite_TimestampTestSuite_test_ticks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_ticks() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 58, "test_ticks" ) {}
+ void runTest() { suite_TimestampTestSuite.test_ticks(); }
+} testDescription_suite_TimestampTestSuite_test_ticks;
+
+static class TestDescription_suite_TimestampTestSuite_test_more_add_diff : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_more_add_diff() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 85, "test_more_add_diff" ) {}
+ void runTest() { suite_TimestampTestSuite.test_more_add_diff(); }
+} testDescription_suite_TimestampTestSuite_test_more_add_diff;
+
+static class TestDescription_suite_TimestampTestSuite_test_negate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_negate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 94, "test_negate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_negate(); }
+} testDescription_suite_TimestampTestSuite_test_negate;
+
+static class TestDescription_suite_TimestampTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 103, "test_add_sub" ) {}
+ void runTest() { suite_TimestampTestSuite.test_add_sub(); }
+} testDescription_suite_TimestampTestSuite_test_add_sub;
+
+static class TestDescription_suite_TimestampTestSuite_test_diff_with_conversion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_diff_with_conversion() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 127, "test_diff_with_conversion" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_with_conversion(); }
+} testDescription_suite_TimestampTestSuite_test_diff_with_conversion;
+
+static class TestDescription_suite_TimestampTestSuite_test_convert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_convert() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 146, "test_convert" ) {}
+ void runTest() { suite_TimestampTestSuite.test_convert(); }
+} testDescription_suite_TimestampTestSuite_test_convert;
+
+static class TestDescription_suite_TimestampTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 155, "test_equals" ) {}
+ void runTest() { suite_TimestampTestSuite.test_equals(); }
+} testDescription_suite_TimestampTestSuite_test_equals;
+
+static class TestDescription_suite_TimestampTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 175, "test_compare" ) {}
+ void runTest() { suite_TimestampTestSuite.test_compare(); }
+} testDescription_suite_TimestampTestSuite_test_compare;
+
+static class TestDescription_suite_TimestampTestSuite_test_framerate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_framerate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 209, "test_framerate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_framerate(); }
+} testDescription_suite_TimestampTestSuite_test_framerate;
+
+static class TestDescription_suite_TimestampTestSuite_test_direct_query : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_direct_query() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 221, "test_direct_query" ) {}
+ void runTest() { suite_TimestampTestSuite.test_direct_query(); }
+} testDescription_suite_TimestampTestSuite_test_direct_query;
+
+static class TestDescription_suite_TimestampTestSuite_test_no_overflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimestampTestSuite_test_no_overflow() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 242, "test_no_overflow" ) {}
+ void runTest() { suite_TimestampTestSuite.test_no_overflow(); }
+} testDescription_suite_TimestampTestSuite_test_no_overflow;
+
+#include "math/quat.h"
+
+static QuatTestSuite suite_QuatTestSuite;
+
+static CxxTest::List Tests_QuatTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuatTestSuite( "test/math/quat.h", 5, "QuatTestSuite", suite_QuatTestSuite, Tests_QuatTestSuite );
+
+static class TestDescription_suite_QuatTestSuite_test_Quaternion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_Quaternion() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 8, "test_Quaternion" ) {}
+ void runTest() { suite_QuatTestSuite.test_Quaternion(); }
+} testDescription_suite_QuatTestSuite_test_Quaternion;
+
+static class TestDescription_suite_QuatTestSuite_test_Normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_Normalize() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 19, "test_Normalize" ) {}
+ void runTest() { suite_QuatTestSuite.test_Normalize(); }
+} testDescription_suite_QuatTestSuite_test_Normalize;
+
+static class TestDescription_suite_QuatTestSuite_test_quatMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_quatMatrix() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 35, "test_quatMatrix" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatMatrix(); }
+} testDescription_suite_QuatTestSuite_test_quatMatrix;
+
+static class TestDescription_suite_QuatTestSuite_test_quatRotationXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_quatRotationXYZ() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 53, "test_quatRotationXYZ" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatRotationXYZ(); }
+} testDescription_suite_QuatTestSuite_test_quatRotationXYZ;
+
+static class TestDescription_suite_QuatTestSuite_test_quatAngleBetween : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_quatAngleBetween() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 80, "test_quatAngleBetween" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatAngleBetween(); }
+} testDescription_suite_QuatTestSuite_test_quatAngleBetween;
+
+static class TestDescription_suite_QuatTestSuite_test_invert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuatTestSuite_test_invert() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 91, "test_invert" ) {}
+ void runTest() { suite_QuatTestSuite.test_invert(); }
+} testDescription_suite_QuatTestSuite_test_invert;
+
+#include "math/ray.h"
+
+static RayTestSuite suite_RayTestSuite;
+
+static CxxTest::List Tests_RayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RayTestSuite( "test/math/ray.h", 5, "RayTestSuite", suite_RayTestSuite, Tests_RayTestSuite );
+
+static class TestDescription_suite_RayTestSuite_test_Ray : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RayTestSuite_test_Ray() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 8, "test_Ray" ) {}
+ void runTest() { suite_RayTestSuite.test_Ray(); }
+} testDescription_suite_RayTestSuite_test_Ray;
+
+static class TestDescription_suite_RayTestSuite_test_translate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RayTestSuite_test_translate() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 23, "test_translate" ) {}
+ void runTest() { suite_RayTestSuite.test_translate(); }
+} testDescription_suite_RayTestSuite_test_translate;
+
+static class TestDescription_suite_RayTestSuite_test_intersectTriangle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RayTestSuite_test_intersectTriangle() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 38, "test_intersectTriangle" ) {}
+ void runTest() { suite_RayTestSuite.test_intersectTriangle(); }
+} testDescription_suite_RayTestSuite_test_intersectTriangle;
+
+#include "math/rotation3d.h"
+
+static Rotation3DTestSuite suite_Rotation3DTestSuite;
+
+static CxxTest::List Tests_Rotation3DTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rotation3DTestSuite( "test/math/rotation3d.h", 5, "Rotation3DTestSuite", suite_Rotation3DTestSuite, Tests_Rotation3DTestSuite );
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerXYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerXYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 7, "test_eulerXYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYX(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerXYX;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerXYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 23, "test_eulerXYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYZ(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerXYZ;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerXZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerXZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 39, "test_eulerXZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZX(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerXZX;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerXZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerXZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 55, "test_eulerXZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZY(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerXZY;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerYXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerYXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 71, "test_eulerYXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXY(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerYXY;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerYXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerYXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 87, "test_eulerYXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXZ(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerYXZ;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerYZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerYZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 103, "test_eulerYZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZX(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerYZX;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerYZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerYZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 119, "test_eulerYZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZY(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerYZY;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerZXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerZXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 135, "test_eulerZXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXY(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerZXY;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerZXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerZXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 151, "test_eulerZXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXZ(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerZXZ;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerZYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerZYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 167, "test_eulerZYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYX(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerZYX;
+
+static class TestDescription_suite_Rotation3DTestSuite_test_eulerZYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Rotation3DTestSuite_test_eulerZYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 183, "test_eulerZYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYZ(); }
+} testDescription_suite_Rotation3DTestSuite_test_eulerZYZ;
+
+#include "math/utils.h"
+
+static MathUtilsTestSuite suite_MathUtilsTestSuite;
+
+static CxxTest::List Tests_MathUtilsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MathUtilsTestSuite( "test/math/utils.h", 7, "MathUtilsTestSuite", suite_MathUtilsTestSuite, Tests_MathUtilsTestSuite );
+
+static class TestDescription_suite_MathUtilsTestSuite_test_rad2deg : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MathUtilsTestSuite_test_rad2deg() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 10, "test_rad2deg" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_rad2deg(); }
+} testDescription_suite_MathUtilsTestSuite_test_rad2deg;
+
+static class TestDescription_suite_MathUtilsTestSuite_test_deg2rad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MathUtilsTestSuite_test_deg2rad() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 23, "test_deg2rad" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_deg2rad(); }
+} testDescription_suite_MathUtilsTestSuite_test_deg2rad;
+
+#include "math/vector3d.h"
+
+static Vector3dTestSuite suite_Vector3dTestSuite;
+
+static CxxTest::List Tests_Vector3dTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Vector3dTestSuite( "test/math/vector3d.h", 5, "Vector3dTestSuite", suite_Vector3dTestSuite, Tests_Vector3dTestSuite );
+
+static class TestDescription_suite_Vector3dTestSuite_test_Vector3d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_Vector3d() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 8, "test_Vector3d" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_Vector3d(); }
+} testDescription_suite_Vector3dTestSuite_test_Vector3d;
+
+static class TestDescription_suite_Vector3dTestSuite_test_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_set() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 28, "test_set" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_set(); }
+} testDescription_suite_Vector3dTestSuite_test_set;
+
+static class TestDescription_suite_Vector3dTestSuite_test_crossProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_crossProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 37, "test_crossProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_crossProduct(); }
+} testDescription_suite_Vector3dTestSuite_test_crossProduct;
+
+static class TestDescription_suite_Vector3dTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_length() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 48, "test_length" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_length(); }
+} testDescription_suite_Vector3dTestSuite_test_length;
+
+static class TestDescription_suite_Vector3dTestSuite_test_interpolate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_interpolate() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 59, "test_interpolate" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_interpolate(); }
+} testDescription_suite_Vector3dTestSuite_test_interpolate;
+
+static class TestDescription_suite_Vector3dTestSuite_test_setValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_setValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 72, "test_setValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_setValue(); }
+} testDescription_suite_Vector3dTestSuite_test_setValue;
+
+static class TestDescription_suite_Vector3dTestSuite_test_getValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_getValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 87, "test_getValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_getValue(); }
+} testDescription_suite_Vector3dTestSuite_test_getValue;
+
+static class TestDescription_suite_Vector3dTestSuite_test_dotProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_dotProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 95, "test_dotProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProduct(); }
+} testDescription_suite_Vector3dTestSuite_test_dotProduct;
+
+static class TestDescription_suite_Vector3dTestSuite_test_dotProductOrthogonal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_dotProductOrthogonal() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 104, "test_dotProductOrthogonal" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProductOrthogonal(); }
+} testDescription_suite_Vector3dTestSuite_test_dotProductOrthogonal;
+
+static class TestDescription_suite_Vector3dTestSuite_test_normalizeTrivial : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_normalizeTrivial() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 113, "test_normalizeTrivial" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalizeTrivial(); }
+} testDescription_suite_Vector3dTestSuite_test_normalizeTrivial;
+
+static class TestDescription_suite_Vector3dTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 126, "test_normalize" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalize(); }
+} testDescription_suite_Vector3dTestSuite_test_normalize;
+
+static class TestDescription_suite_Vector3dTestSuite_test_magnitude : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_Vector3dTestSuite_test_magnitude() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 138, "test_magnitude" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_magnitude(); }
+} testDescription_suite_Vector3dTestSuite_test_magnitude;
+
+#include "/root/repo/test/image/blending.h"
+
+static BlendBlitUnfilteredTestSuite suite_BlendBlitUnfilteredTestSuite;
+
+static CxxTest::List Tests_BlendBlitUnfilteredTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BlendBlitUnfilteredTestSuite( "test/image/blending.h", 798, "BlendBlitUnfilteredTestSuite", suite_BlendBlitUnfilteredTestSuite, Tests_BlendBlitUnfilteredTestSuite );
+
+static class TestDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_speed() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 812, "test_blend_speed" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_speed(); }
+} testDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_speed;
+
+static class TestDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 919, "test_blend_blit_unfiltered" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_blit_unfiltered(); }
+} testDescription_suite_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered;
+
+#include "image/gif.h"
+
+static GIFDecoderTestSuite suite_GIFDecoderTestSuite;
+
+static CxxTest::List Tests_GIFDecoderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GIFDecoderTestSuite( "test/image/gif.h", 11, "GIFDecoderTestSuite", suite_GIFDecoderTestSuite, Tests_GIFDecoderTestSuite );
+
+static class TestDescription_suite_GIFDecoderTestSuite_test_load_gif_2x2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GIFDecoderTestSuite_test_load_gif_2x2() : CxxTest::RealTestDescription( Tests_GIFDecoderTestSuite, suiteDescription_GIFDecoderTestSuite, 13, "test_load_gif_2x2" ) {}
+ void runTest() { suite_GIFDecoderTestSuite.test_load_gif_2x2(); }
+} testDescription_suite_GIFDecoderTestSuite_test_load_gif_2x2;
+
+#include "/root/repo/test/gui/themecache.h"
+
+static ThemeCacheTestSuite suite_ThemeCacheTestSuite;
+
+static CxxTest::List Tests_ThemeCacheTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThemeCacheTestSuite( "test/gui/themecache.h", 28, "ThemeCacheTestSuite", suite_ThemeCacheTestSuite, Tests_ThemeCacheTestSuite );
+
+static class TestDescription_suite_ThemeCacheTestSuite_test_hit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThemeCacheTestSuite_test_hit() : CxxTest::RealTestDescription( Tests_ThemeCacheTestSuite, suiteDescription_ThemeCacheTestSuite, 86, "test_hit" ) {}
+ void runTest() { suite_ThemeCacheTestSuite.test_hit(); }
+} testDescription_suite_ThemeCacheTestSuite_test_hit;
+
+static class TestDescription_suite_ThemeCacheTestSuite_test_invalidation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThemeCacheTestSuite_test_invalidation() : CxxTest::RealTestDescription( Tests_ThemeCacheTestSuite, suiteDescription_ThemeCacheTestSuite, 110, "test_invalidation" ) {}
+ void runTest() { suite_ThemeCacheTestSuite.test_invalidation(); }
+} testDescription_suite_ThemeCacheTestSuite_test_invalidation;
+
+static class TestDescription_suite_ThemeCacheTestSuite_test_eviction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThemeCacheTestSuite_test_eviction() : CxxTest::RealTestDescription( Tests_ThemeCacheTestSuite, suiteDescription_ThemeCacheTestSuite, 127, "test_eviction" ) {}
+ void runTest() { suite_ThemeCacheTestSuite.test_eviction(); }
+} testDescription_suite_ThemeCacheTestSuite_test_eviction;
+
+static class TestDescription_suite_ThemeCacheTestSuite_test_replay : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThemeCacheTestSuite_test_replay() : CxxTest::RealTestDescription( Tests_ThemeCacheTestSuite, suiteDescription_ThemeCacheTestSuite, 149, "test_replay" ) {}
+ void runTest() { suite_ThemeCacheTestSuite.test_replay(); }
+} testDescription_suite_ThemeCacheTestSuite_test_replay;
+
+#include "/root/repo/test/graphics/vectorrenderer.h"
+
+static VectorRendererSpansTestSuite suite_VectorRendererSpansTestSuite;
+
+static CxxTest::List Tests_VectorRendererSpansTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VectorRendererSpansTestSuite( "test/graphics/vectorrenderer.h", 43, "VectorRendererSpansTestSuite", suite_VectorRendererSpansTestSuite, Tests_VectorRendererSpansTestSuite );
+
+static class TestDescription_suite_VectorRendererSpansTestSuite_test_blend32_generic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VectorRendererSpansTestSuite_test_blend32_generic() : CxxTest::RealTestDescription( Tests_VectorRendererSpansTestSuite, suiteDescription_VectorRendererSpansTestSuite, 122, "test_blend32_generic" ) {}
+ void runTest() { suite_VectorRendererSpansTestSuite.test_blend32_generic(); }
+} testDescription_suite_VectorRendererSpansTestSuite_test_blend32_generic;
+
+static class TestDescription_suite_VectorRendererSpansTestSuite_test_spans_simd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VectorRendererSpansTestSuite_test_spans_simd() : CxxTest::RealTestDescription( Tests_VectorRendererSpansTestSuite, suiteDescription_VectorRendererSpansTestSuite, 145, "test_spans_simd" ) {}
+ void runTest() { suite_VectorRendererSpansTestSuite.test_spans_simd(); }
+} testDescription_suite_VectorRendererSpansTestSuite_test_spans_simd;
+
+static class TestDescription_suite_VectorRendererSpansTestSuite_test_render_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VectorRendererSpansTestSuite_test_render_speed() : CxxTest::RealTestDescription( Tests_VectorRendererSpansTestSuite, suiteDescription_VectorRendererSpansTestSuite, 175, "test_render_speed" ) {}
+ void runTest() { suite_VectorRendererSpansTestSuite.test_render_speed(); }
+} testDescription_suite_VectorRendererSpansTestSuite_test_render_speed;
+
+#include "/root/repo/test/backends/saves/default-saves.h"
+
+static DefaultSaveFileManagerTestSuite suite_DefaultSaveFileManagerTestSuite;
+
+static CxxTest::List Tests_DefaultSaveFileManagerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DefaultSaveFileManagerTestSuite( "test/backends/saves/default-saves.h", 32, "DefaultSaveFileManagerTestSuite", suite_DefaultSaveFileManagerTestSuite, Tests_DefaultSaveFileManagerTestSuite );
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_queue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_queue() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 96, "test_queue" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_queue(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_queue;
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_replace() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 129, "test_replace" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_replace(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_replace;
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_wait : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_wait() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 149, "test_wait" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_wait(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_wait;
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_revision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_revision() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 181, "test_revision" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_revision(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_revision;
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_file_revision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_file_revision() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 208, "test_file_revision" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_file_revision(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_file_revision;
+
+static class TestDescription_suite_DefaultSaveFileManagerTestSuite_test_delta : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultSaveFileManagerTestSuite_test_delta() : CxxTest::RealTestDescription( Tests_DefaultSaveFileManagerTestSuite, suiteDescription_DefaultSaveFileManagerTestSuite, 232, "test_delta" ) {}
+ void runTest() { suite_DefaultSaveFileManagerTestSuite.test_delta(); }
+} testDescription_suite_DefaultSaveFileManagerTestSuite_test_delta;
+
+#include "/root/repo/test/graphics/ttf.h"
+
+static TTFFontTestSuite suite_TTFFontTestSuite;
+
+static CxxTest::List Tests_TTFFontTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TTFFontTestSuite( "test/graphics/ttf.h", 38, "TTFFontTestSuite", suite_TTFFontTestSuite, Tests_TTFFontTestSuite );
+
+static class TestDescription_suite_TTFFontTestSuite_test_atlas : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TTFFontTestSuite_test_atlas() : CxxTest::RealTestDescription( Tests_TTFFontTestSuite, suiteDescription_TTFFontTestSuite, 79, "test_atlas" ) {}
+ void runTest() { suite_TTFFontTestSuite.test_atlas(); }
+} testDescription_suite_TTFFontTestSuite_test_atlas;
+
+static class TestDescription_suite_TTFFontTestSuite_test_run_cache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TTFFontTestSuite_test_run_cache() : CxxTest::RealTestDescription( Tests_TTFFontTestSuite, suiteDescription_TTFFontTestSuite, 112, "test_run_cache" ) {}
+ void runTest() { suite_TTFFontTestSuite.test_run_cache(); }
+} testDescription_suite_TTFFontTestSuite_test_run_cache;
+
+static class TestDescription_suite_TTFFontTestSuite_test_wrap_cache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TTFFontTestSuite_test_wrap_cache() : CxxTest::RealTestDescription( Tests_TTFFontTestSuite, suiteDescription_TTFFontTestSuite, 158, "test_wrap_cache" ) {}
+ void runTest() { suite_TTFFontTestSuite.test_wrap_cache(); }
+} testDescription_suite_TTFFontTestSuite_test_wrap_cache;
+
+#include "/root/repo/test/engines/sci/entry_table.h"
+
+static SciEntryTableTestSuite suite_SciEntryTableTestSuite;
+
+static CxxTest::List Tests_SciEntryTableTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SciEntryTableTestSuite( "test/engines/sci/entry_table.h", 9, "SciEntryTableTestSuite", suite_SciEntryTableTestSuite, Tests_SciEntryTableTestSuite );
+
+static class TestDescription_suite_SciEntryTableTestSuite_test_reuse_freed_entries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciEntryTableTestSuite_test_reuse_freed_entries() : CxxTest::RealTestDescription( Tests_SciEntryTableTestSuite, suiteDescription_SciEntryTableTestSuite, 35, "test_reuse_freed_entries" ) {}
+ void runTest() { suite_SciEntryTableTestSuite.test_reuse_freed_entries(); }
+} testDescription_suite_SciEntryTableTestSuite_test_reuse_freed_entries;
+
+static class TestDescription_suite_SciEntryTableTestSuite_test_entry_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciEntryTableTestSuite_test_entry_data() : CxxTest::RealTestDescription( Tests_SciEntryTableTestSuite, suiteDescription_SciEntryTableTestSuite, 56, "test_entry_data" ) {}
+ void runTest() { suite_SciEntryTableTestSuite.test_entry_data(); }
+} testDescription_suite_SciEntryTableTestSuite_test_entry_data;
+
+static class TestDescription_suite_SciEntryTableTestSuite_test_allocated_since_gc : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciEntryTableTestSuite_test_allocated_since_gc() : CxxTest::RealTestDescription( Tests_SciEntryTableTestSuite, suiteDescription_SciEntryTableTestSuite, 68, "test_allocated_since_gc" ) {}
+ void runTest() { suite_SciEntryTableTestSuite.test_allocated_since_gc(); }
+} testDescription_suite_SciEntryTableTestSuite_test_allocated_since_gc;
+
+static class TestDescription_suite_SciEntryTableTestSuite_test_invalid_entries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciEntryTableTestSuite_test_invalid_entries() : CxxTest::RealTestDescription( Tests_SciEntryTableTestSuite, suiteDescription_SciEntryTableTestSuite, 85, "test_invalid_entries" ) {}
+ void runTest() { suite_SciEntryTableTestSuite.test_invalid_entries(); }
+} testDescription_suite_SciEntryTableTestSuite_test_invalid_entries;
+
+#include "/root/repo/test/engines/sci/kpathing.h"
+
+static SciPathfindingTestSuite suite_SciPathfindingTestSuite;
+
+static CxxTest::List Tests_SciPathfindingTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SciPathfindingTestSuite( "test/engines/sci/kpathing.h", 10, "SciPathfindingTestSuite", suite_SciPathfindingTestSuite, Tests_SciPathfindingTestSuite );
+
+static class TestDescription_suite_SciPathfindingTestSuite_test_obstacle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciPathfindingTestSuite_test_obstacle() : CxxTest::RealTestDescription( Tests_SciPathfindingTestSuite, suiteDescription_SciPathfindingTestSuite, 175, "test_obstacle" ) {}
+ void runTest() { suite_SciPathfindingTestSuite.test_obstacle(); }
+} testDescription_suite_SciPathfindingTestSuite_test_obstacle;
+
+static class TestDescription_suite_SciPathfindingTestSuite_test_cached_queries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciPathfindingTestSuite_test_cached_queries() : CxxTest::RealTestDescription( Tests_SciPathfindingTestSuite, suiteDescription_SciPathfindingTestSuite, 188, "test_cached_queries" ) {}
+ void runTest() { suite_SciPathfindingTestSuite.test_cached_queries(); }
+} testDescription_suite_SciPathfindingTestSuite_test_cached_queries;
+
+static class TestDescription_suite_SciPathfindingTestSuite_test_lazy_graph : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciPathfindingTestSuite_test_lazy_graph() : CxxTest::RealTestDescription( Tests_SciPathfindingTestSuite, suiteDescription_SciPathfindingTestSuite, 217, "test_lazy_graph" ) {}
+ void runTest() { suite_SciPathfindingTestSuite.test_lazy_graph(); }
+} testDescription_suite_SciPathfindingTestSuite_test_lazy_graph;
+
+static class TestDescription_suite_SciPathfindingTestSuite_test_random_rooms : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciPathfindingTestSuite_test_random_rooms() : CxxTest::RealTestDescription( Tests_SciPathfindingTestSuite, suiteDescription_SciPathfindingTestSuite, 264, "test_random_rooms" ) {}
+ void runTest() { suite_SciPathfindingTestSuite.test_random_rooms(); }
+} testDescription_suite_SciPathfindingTestSuite_test_random_rooms;
+
+static class TestDescription_suite_SciPathfindingTestSuite_test_aligned_rooms : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SciPathfindingTestSuite_test_aligned_rooms() : CxxTest::RealTestDescription( Tests_SciPathfindingTestSuite, suiteDescription_SciPathfindingTestSuite, 295, "test_aligned_rooms" ) {}
+ void runTest() { suite_SciPathfindingTestSuite.test_aligned_rooms(); }
+} testDescription_suite_SciPathfindingTestSuite_test_aligned_rooms;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
@@ -4,11 +4,6 @@
 #define NULL_DRIVER_USE_FOR_TEST 1
 #include "null_osystem.h"
 #include "../backends/platform/null/null.cpp"
-#ifdef USE_CLOUD
-#undef USE_CLOUD
-#endif
-#include "../backends/saves/savefile.cpp"
-
 //#define DISPLAY_ERROR_MESSAGES
 
 void Common::install_null_g_system() {